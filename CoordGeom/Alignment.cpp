@@ -362,6 +362,12 @@ WBFL::Geometry::Point2d Alignment::LocatePoint(const Station& station, OffsetTyp
    return m_Path->LocatePoint(distFromStart, offsetType, offset, dir);
 }
 
+void Alignment::LocatePoints(std::span<const Station> vStations, OffsetType offsetType, std::span<const Float64> vOffsets, const Direction& dir, std::span<WBFL::Geometry::Point2d> vPoints) const
+{
+   auto vDistFromStart = StationsToPathDistances(vStations);
+   m_Path->LocatePoints(vDistFromStart, offsetType, vOffsets, dir, vPoints);
+}
+
 std::pair<bool, WBFL::Geometry::Point2d> Alignment::Intersect(const WBFL::Geometry::Line2d& line, const WBFL::Geometry::Point2d& nearest, bool bProjectBack, bool bProjectAhead) const
 {
    return m_Path->Intersect(line, nearest, bProjectBack, bProjectAhead);
@@ -373,6 +379,12 @@ Direction Alignment::GetBearing(const Station& station) const
    return m_Path->GetBearing(distFromStart);
 }
 
+void Alignment::GetBearings(std::span<const Station> vStations, std::span<Direction> vBearings) const
+{
+   auto vDistFromStart = StationsToPathDistances(vStations);
+   m_Path->GetBearings(vDistFromStart, vBearings);
+}
+
 Direction Alignment::GetNormal(const Station& station) const
 {
    Float64 distFromStart = StationToPathDistance(station);
@@ -566,6 +578,14 @@ Float64 Alignment::StationToPathDistance(const Station& station) const
    return normalized_station.GetValue() - m_ReferenceStation;
 }
 
+std::vector<Float64> Alignment::StationsToPathDistances(std::span<const Station> vStations) const
+{
+   std::vector<Float64> vDistFromStart;
+   vDistFromStart.reserve(vStations.size());
+   std::transform(vStations.begin(), vStations.end(), std::back_inserter(vDistFromStart), [this](const auto& station) {return ConvertToNormalizedStation(station).GetValue() - m_ReferenceStation; });
+   return vDistFromStart;
+}
+
 Station Alignment::CreateStation(Float64 normalizedStation) const
 {
    return ConvertFromNormalizedStation(normalizedStation);
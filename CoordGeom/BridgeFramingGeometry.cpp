@@ -33,6 +33,40 @@
 
 using namespace WBFL::COGO;
 
+namespace
+{
+   template <class C, class F>
+   void BuildIndex(const C& container, std::unordered_map<IDType, IndexType>& index, F getID)
+   {
+      index.clear();
+      index.reserve(container.size());
+      IndexType idx = 0;
+      for (const auto& item : container)
+      {
+         index.emplace(getID(item), idx++); // if there are duplicate IDs, the first one is kept
+      }
+   }
+
+   bool Intersects(const std::set<IDType>& set1, const std::set<IDType>& set2)
+   {
+      return std::any_of(set1.begin(), set1.end(), [&set2](auto id) {return set2.contains(id); });
+   }
+
+   // Returns true if two layout line paths have the same geometry
+   bool IsSamePath(const Path& path1, const Path& path2)
+   {
+      const auto& elements1 = path1.GetPathElements();
+      const auto& elements2 = path2.GetPathElements();
+      if (elements1.size() != elements2.size()) return false;
+
+      return std::equal(elements1.begin(), elements1.end(), elements2.begin(), [](const auto& element1, const auto& element2)
+         {
+            return element1->GetStartPoint() == element2->GetStartPoint() &&
+               element1->GetEndPoint() == element2->GetEndPoint() &&
+               IsEqual(element1->GetLength(), element2->GetLength());
+         });
+   }
+};
 
 
 BridgeFramingGeometry::BridgeFramingGeometry(IDType bridgeAlignmentID, std::shared_ptr<const Alignment> alignment) :
@@ -185,8 +219,44 @@ void BridgeFramingGeometry::InvalidateState(Int8 state) const
    m_CurrentState = min(m_CurrentState, max(All,state - 1));
 }
 
+template <class F>
+auto BridgeFramingGeometry::RecordDependencies(Dependencies& dependencies, F create) const
+{
+   dependencies = Dependencies();
+   auto* pOldDependencies = m_pDependencies;
+   m_pDependencies = &dependencies;
+   try
+   {
+      auto result = create();
+      m_pDependencies = pOldDependencies;
+      return result;
+   }
+   catch (...)
+   {
+      m_pDependencies = pOldDependencies;
+      throw;
+   }
+}
+
+void BridgeFramingGeometry::InvalidatePierLine(PierIDType id)
+{
+   if (m_CurrentState < PierLineState) return; // pier lines will be created from scratch - nothing to do
+   m_InvalidPierLines.insert(id);
+}
+
+void BridgeFramingGeometry::InvalidateLayoutLine(IDType id)
+{
+   if (m_CurrentState < LayoutLineState) return; // layout lines will be created from scratch - nothing to do
+   m_InvalidLayoutLines.insert(id);
+}
+
 void BridgeFramingGeometry::ValidateState(Int8 state) const
 {
+   if (!m_InvalidPierLines.empty() || !m_InvalidLayoutLines.empty())
+   {
+      UpdateInvalidElements();
+   }
+
    if (state <= m_CurrentState) return; // already up to date - nothing to do
 
    if (m_CurrentState < PierLineState)
@@ -199,46 +269,165 @@ void BridgeFramingGeometry::ValidateState(Int8 state) const
       {
          pier_line->SetIndex(idx++);
       }
+      BuildIndex(m_PierLines, m_PierLineIndex, [](const auto& pier_line) {return pier_line->GetID(); });
 
       m_CurrentState = PierLineState;
    }
 
    if (m_CurrentState < LayoutLineState)
    {
-      m_LayoutLines = m_LayoutLineFactory->Create(shared_from_this());
+      m_LayoutLines = RecordDependencies(m_LayoutLineDependencies, [this] {return m_LayoutLineFactory->Create(shared_from_this()); });
+      BuildIndex(m_LayoutLines, m_LayoutLineIndex, [](const auto& layout_line) {return layout_line.first; });
       m_CurrentState = LayoutLineState;
    }
 
    if (m_CurrentState < GirderLineState)
    {
       m_GirderLines = m_GirderLineFactory->Create(shared_from_this());
+      BuildIndex(m_GirderLines, m_GirderLineIndex, [](const auto& girder_line) {return girder_line->GetID(); });
       m_CurrentState = GirderLineState;
    }
 
    if (m_CurrentState < DiaphragmLineState)
    {
       m_DiaphragmLines = m_DiaphragmLineFactory->Create(shared_from_this());
+      BuildIndex(m_DiaphragmLines, m_DiaphragmLineIndex, [](const auto& diaphragm_line) {return diaphragm_line->GetID(); });
       m_CurrentState = DiaphragmLineState;
    }
 
    if (m_CurrentState < DeckBoundaryState)
    {
-      if (m_DeckBoundaryFactory) m_DeckBoundary = m_DeckBoundaryFactory->Create(shared_from_this());
+      if (m_DeckBoundaryFactory) m_DeckBoundary = RecordDependencies(m_DeckBoundaryDependencies, [this] {return m_DeckBoundaryFactory->Create(shared_from_this()); });
       m_CurrentState = DeckBoundaryState;
    }
 }
 
-std::shared_ptr<const Path> BridgeFramingGeometry::FindLayoutLine(IDType id) const
+void BridgeFramingGeometry::UpdateInvalidElements() const
 {
-   ValidateState(LayoutLineState);
+   // Take the invalid elements so requests for geometry made while elements are being updated don't come back here
+   std::set<IDType> changed_pier_lines;
+   std::set<IDType> changed_layout_lines;
+   std::swap(changed_pier_lines, m_InvalidPierLines);
+   std::swap(changed_layout_lines, m_InvalidLayoutLines);
+
+   auto self = shared_from_this();
+
+   if (PierLineState <= m_CurrentState && !changed_pier_lines.empty())
+   {
+      // Factories create all of their pier lines. Keep the existing pier lines that haven't changed so elements that refer to them remain valid.
+      auto pier_lines = m_PierLineFactory->Create(self);
+      if (pier_lines.size() != m_PierLines.size())
+      {
+         // pier lines were added or removed - everything must be recomputed
+         InvalidateState(PierLineState);
+         return;
+      }
+
+      for (auto& pier_line : pier_lines)
+      {
+         auto found = m_PierLineIndex.find(pier_line->GetID());
+         if (found == m_PierLineIndex.end())
+         {
+            InvalidateState(PierLineState);
+            return;
+         }
+
+         if (changed_pier_lines.contains(pier_line->GetID()))
+         {
+            pier_line->SetIndex(found->second);
+            m_PierLines[found->second] = pier_line;
+         }
+      }
+
+      // Elements such as the deck boundary refer to pier lines by position. If a pier line moved past another one, everything must be recomputed
+      auto bridge_alignment = GetBridgeAlignment();
+      if (!std::is_sorted(m_PierLines.begin(), m_PierLines.end(), [bridge_alignment](auto& pierline1, auto& pierline2) {return bridge_alignment->CompareStations(pierline1->GetStation(), pierline2->GetStation()) == 1; }))
+      {
+         InvalidateState(PierLineState);
+         return;
+      }
+   }
+
+   if (LayoutLineState <= m_CurrentState && (!changed_layout_lines.empty() || Intersects(changed_pier_lines, m_LayoutLineDependencies.PierLines)))
+   {
+      // Layout lines can be located relative to pier lines. Recreate all the layout lines and keep the ones that have the same geometry.
+      Dependencies dependencies;
+      auto layout_lines = RecordDependencies(dependencies, [this, &self] {return m_LayoutLineFactory->Create(self); });
+      if (layout_lines.size() != m_LayoutLines.size())
+      {
+         InvalidateState(LayoutLineState);
+         return;
+      }
+
+      for (auto& [id, path] : layout_lines)
+      {
+         auto found = m_LayoutLineIndex.find(id);
+         if (found == m_LayoutLineIndex.end())
+         {
+            InvalidateState(LayoutLineState);
+            return;
+         }
+
+         auto& layout_line = m_LayoutLines[found->second];
+         if (changed_layout_lines.contains(id) || !IsSamePath(*layout_line.second, *path))
+         {
+            layout_line.second = path;
+            changed_layout_lines.insert(id);
+         }
+      }
+
+      m_LayoutLineDependencies = dependencies;
+   }
+
+   std::set<IDType> changed_girder_lines;
+   if (GirderLineState <= m_CurrentState && (!changed_pier_lines.empty() || !changed_layout_lines.empty()))
+   {
+      for (auto& girder_line : m_GirderLines)
+      {
+         if (changed_layout_lines.contains(girder_line->m_LayoutLineID) ||
+            changed_pier_lines.contains(girder_line->m_PierID[+EndType::Start]) ||
+            changed_pier_lines.contains(girder_line->m_PierID[+EndType::End]))
+         {
+            // Don't modify the existing girder line because it may be referenced outside of this object
+            auto new_girder_line = GirderLine::Create(*girder_line);
+            new_girder_line->UpdateGeometry();
+            girder_line = new_girder_line;
+            changed_girder_lines.insert(girder_line->GetID());
+         }
+      }
+   }
 
-   for (const auto& [ID,path] : m_LayoutLines)
+   if (DiaphragmLineState <= m_CurrentState && !changed_girder_lines.empty())
    {
-      if (ID == id)
-         return path;
+      for (auto& diaphragm_line : m_DiaphragmLines)
+      {
+         // Diaphragm lines intersect all the girder lines from the left girder line to the right girder line
+         auto [first_girder_line, last_girder_line] = std::minmax(diaphragm_line->m_GirderLineID[+SideType::Left], diaphragm_line->m_GirderLineID[+SideType::Right]);
+         auto found = changed_girder_lines.lower_bound(first_girder_line);
+         if (found != changed_girder_lines.end() && *found <= last_girder_line)
+         {
+            auto new_diaphragm_line = DiaphragmLine::Create(*diaphragm_line);
+            new_diaphragm_line->UpdateGeometry();
+            diaphragm_line = new_diaphragm_line;
+         }
+      }
    }
 
-   return std::shared_ptr<const Path>();
+   if (DeckBoundaryState <= m_CurrentState && m_DeckBoundaryFactory &&
+      (Intersects(changed_pier_lines, m_DeckBoundaryDependencies.PierLines) || Intersects(changed_layout_lines, m_DeckBoundaryDependencies.LayoutLines)))
+   {
+      m_DeckBoundary = RecordDependencies(m_DeckBoundaryDependencies, [this, &self] {return m_DeckBoundaryFactory->Create(self); });
+   }
+}
+
+std::shared_ptr<const Path> BridgeFramingGeometry::FindLayoutLine(IDType id) const
+{
+   ValidateState(LayoutLineState);
+
+   if (m_pDependencies) m_pDependencies->LayoutLines.insert(id);
+
+   auto found = m_LayoutLineIndex.find(id);
+   return found == m_LayoutLineIndex.end() ? std::shared_ptr<const Path>() : m_LayoutLines[found->second].second;
 }
 
 IndexType BridgeFramingGeometry::GetLayoutLineCount() const
@@ -252,6 +441,8 @@ std::shared_ptr<const Path> BridgeFramingGeometry::GetLayoutLine(IndexType idx)
 {
    ValidateState(LayoutLineState);
 
+   if (m_pDependencies) m_pDependencies->LayoutLines.insert(m_LayoutLines[idx].first);
+
    return m_LayoutLines[idx].second;
 }
 
@@ -265,6 +456,8 @@ std::shared_ptr<const PierLine> BridgeFramingGeometry::GetPierLine(PierIndexType
 {
    ValidateState(PierLineState);
 
+   if (m_pDependencies) m_pDependencies->PierLines.insert(m_PierLines[idx]->GetID());
+
    return m_PierLines[idx];
 }
 
@@ -272,13 +465,10 @@ std::shared_ptr<const PierLine> BridgeFramingGeometry::FindPierLine(PierIDType i
 {
    ValidateState(PierLineState);
 
-   for (auto& p : m_PierLines)
-   {
-      if (p->GetID() == id)
-         return p;
-   }
+   if (m_pDependencies) m_pDependencies->PierLines.insert(id);
 
-   return std::shared_ptr<PierLine>();
+   auto found = m_PierLineIndex.find(id);
+   return found == m_PierLineIndex.end() ? std::shared_ptr<PierLine>() : m_PierLines[found->second];
 }
 
 IndexType BridgeFramingGeometry::GetGirderLineCount() const
@@ -292,13 +482,8 @@ std::shared_ptr<const GirderLine> BridgeFramingGeometry::FindGirderLine(IDType i
 {
    ValidateState(GirderLineState);
 
-   for (const auto& girder_line : m_GirderLines)
-   {
-      if (girder_line->GetID() == id)
-         return girder_line;
-   }
-
-   return std::shared_ptr<const GirderLine>();
+   auto found = m_GirderLineIndex.find(id);
+   return found == m_GirderLineIndex.end() ? std::shared_ptr<const GirderLine>() : m_GirderLines[found->second];
 }
 
 std::shared_ptr<const GirderLine> BridgeFramingGeometry::GetGirderLine(IndexType idx) const
@@ -319,13 +504,8 @@ std::shared_ptr<const DiaphragmLine> BridgeFramingGeometry::FindDiaphragmLine(ID
 {
    ValidateState(DiaphragmLineState);
 
-   for (const auto& diaphragm_line : m_DiaphragmLines)
-   {
-      if (diaphragm_line->GetID() == id)
-         return diaphragm_line;
-   }
-
-   return std::shared_ptr<const DiaphragmLine>();
+   auto found = m_DiaphragmLineIndex.find(id);
+   return found == m_DiaphragmLineIndex.end() ? std::shared_ptr<const DiaphragmLine>() : m_DiaphragmLines[found->second];
 }
 
 std::shared_ptr<const DiaphragmLine> BridgeFramingGeometry::GetDiaphragmLine(IndexType idx) const
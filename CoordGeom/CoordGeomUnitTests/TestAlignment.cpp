@@ -854,6 +854,39 @@ namespace CoordGeomUnitTest
       }
 
 
+      TEST_METHOD(BatchLocatePoints)
+      {
+         auto alignment = Alignment::Create();
+         alignment->SetReferenceStation(100);
+         alignment->AddStationEquation(300, 500);
+
+         WBFL::Geometry::Point2d pbt(0, 1000);
+         WBFL::Geometry::Point2d pi(700, 1000);
+         WBFL::Geometry::Point2d pft(1000, 700);
+         alignment->AddPathElement(PathSegment::Create(-100, 1000, 0, 1000));
+         alignment->AddPathElement(CompoundCurve::Create(pbt, pi, pft, 500, 100, TransitionCurveType::Clothoid, 200, TransitionCurveType::Clothoid));
+         alignment->AddPathElement(PathSegment::Create(1000, 700, 1100, 600));
+
+         std::vector<Station> vStations;
+         std::vector<Float64> vOffsets;
+         for (Float64 ns = 0; ns < 1500; ns += 25)
+         {
+            vStations.push_back(alignment->ConvertFromNormalizedStation(ns));
+            vOffsets.push_back(ns / 100);
+         }
+
+         std::vector<WBFL::Geometry::Point2d> vPoints(vStations.size());
+         std::vector<Direction> vBearings(vStations.size());
+         alignment->LocatePoints(vStations, OffsetType::Normal, vOffsets, 0.0, vPoints);
+         alignment->GetBearings(vStations, vBearings);
+
+         for (IndexType i = 0; i < vStations.size(); i++)
+         {
+            Assert::IsTrue(vPoints[i] == alignment->LocatePoint(vStations[i], OffsetType::Normal, vOffsets[i], 0.0));
+            Assert::IsTrue(vBearings[i] == alignment->GetBearing(vStations[i]));
+         }
+      }
+
       TEST_METHOD(Subalignment1)
       {
          // Test sub-path with empty alignment
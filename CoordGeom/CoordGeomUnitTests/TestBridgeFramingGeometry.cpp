@@ -446,5 +446,81 @@ namespace CoordGeomUnitTest
             //std::_tcout << point.X() << _T(", ") << point.Y() << std::endl;
          }
       }
+
+      TEST_METHOD(InvalidatePierLine)
+      {
+         auto alignment = CreateStraightAlignment(0.00, 10.0, 10.0, M_PI / 4);
+         auto bridge = BridgeFramingGeometry::Create(g_AlignmentID, alignment);
+
+         ConnectionGeometry connection_geometry{ 2.5,MeasurementType::NormalToItem,1.0,MeasurementType::NormalToItem,MeasurementLocation::CenterlineBearing };
+         std::vector<std::shared_ptr<SinglePierLineFactory>> pier_line_factories;
+         for (IDType id = 100; id <= 300; id += 100)
+         {
+            auto factory = std::make_shared<SinglePierLineFactory>(id, g_AlignmentID, (Float64)id, _T("NORMAL"), 20.0, 10.0, connection_geometry, connection_geometry);
+            bridge->AddPierLineFactory(factory);
+            pier_line_factories.emplace_back(factory);
+         }
+
+         auto layout_line_factory = std::make_shared<AlignmentOffsetLayoutLineFactory>();
+         layout_line_factory->SetAlignmentID(g_AlignmentID);
+         layout_line_factory->SetLayoutLineID(100);
+         layout_line_factory->SetLayoutLineIDIncrement(1);
+         layout_line_factory->SetLayoutLineCount(2);
+         layout_line_factory->SetOffset(-5.0);
+         layout_line_factory->SetOffsetIncrement(10.0);
+         bridge->AddLayoutLineFactory(layout_line_factory);
+
+         auto girder_line_factory = std::make_shared<SimpleGirderLineFactory>();
+         girder_line_factory->SetGirderLineID(500);
+         girder_line_factory->SetGirderLineIDIncrement(1);
+         girder_line_factory->SetLayoutLineID(SideType::Left, 100);
+         girder_line_factory->SetLayoutLineID(SideType::Right, 101);
+         girder_line_factory->SetLayoutLineIDIncrement(1);
+         girder_line_factory->SetGirderLineType(GirderLineType::Chord);
+         girder_line_factory->SetPierID(EndType::Start, 100);
+         girder_line_factory->SetPierID(EndType::End, 300);
+         girder_line_factory->SetPierIDIncrement(100);
+         girder_line_factory->IsContinuous(false);
+         bridge->AddGirderLineFactory(girder_line_factory);
+
+         Assert::AreEqual((IndexType)4, bridge->GetGirderLineCount());
+         std::vector<std::shared_ptr<const GirderLine>> girder_lines;
+         for (IndexType idx = 0; idx < bridge->GetGirderLineCount(); idx++)
+         {
+            girder_lines.emplace_back(bridge->GetGirderLine(idx));
+         }
+         auto pier1 = bridge->FindPierLine(100);
+         auto pier2 = bridge->FindPierLine(200);
+         auto layout_line = bridge->FindLayoutLine(100);
+
+         // move the last pier
+         pier_line_factories.back()->SetStation(320.0);
+         bridge->InvalidatePierLine(300);
+
+         // girder lines in the first span and the unchanged piers and layout lines are retained
+         Assert::IsTrue(pier1 == bridge->FindPierLine(100));
+         Assert::IsTrue(pier2 == bridge->FindPierLine(200));
+         Assert::IsTrue(layout_line == bridge->FindLayoutLine(100));
+         for (IndexType idx = 0; idx < bridge->GetGirderLineCount(); idx++)
+         {
+            auto girder_line = bridge->GetGirderLine(idx);
+            bool bSecondSpan = girder_line->GetPierLine(EndType::End)->GetID() == 300;
+            Assert::AreEqual(bSecondSpan, girder_line != girder_lines[idx]);
+            Assert::IsTrue(IsEqual(girder_line->GetLayoutLength(), bSecondSpan ? 120.0 : 100.0));
+            Assert::IsTrue(girder_line == bridge->FindGirderLine(girder_line->GetID()));
+         }
+
+         // the previously created girder lines are unchanged
+         Assert::IsTrue(IsEqual(girder_lines.back()->GetLayoutLength(), 100.0));
+
+         Assert::IsTrue(bridge->FindGirderLine(999) == nullptr);
+         Assert::IsTrue(bridge->FindPierLine(999) == nullptr);
+
+         // moving a pier past another pier rebuilds everything
+         pier_line_factories.front()->SetStation(250.0);
+         bridge->InvalidatePierLine(100);
+         Assert::IsTrue(pier2 != bridge->FindPierLine(200));
+         Assert::AreEqual((IDType)200, bridge->GetPierLine(0)->GetID());
+      }
 	};
 }
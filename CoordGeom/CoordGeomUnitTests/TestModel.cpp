@@ -431,6 +431,59 @@ namespace CoordGeomUnitTest
          Assert::IsTrue(model.GetPoint(358) == WBFL::Geometry::Point2d(922.13512, 777.86488));
       }
 
+      TEST_METHOD(CreationCache)
+      {
+         Model model;
+
+         model.StorePoint(1, 0, 1000);
+         model.StorePoint(2, 700, 1000);
+         model.StorePoint(3, 1000, 700);
+         model.StoreCircularCurve(1, 1, 2, 3, 500);
+         model.StoreAlignment(1);
+         model.AppendElementToAlignment(1, Model::PathElementType::CircularCurve, 1);
+
+         // first request creates the objects, later requests share them
+         auto alignment = model.GetCachedAlignment(1);
+         auto curve = model.GetCachedCircularCurve(1);
+         Assert::IsTrue(alignment == model.GetCachedAlignment(1));
+         Assert::IsTrue(curve == model.GetCachedCircularCurve(1));
+         Assert::AreEqual((IndexType)2, model.GetCacheStatistics().Misses);
+         Assert::AreEqual((IndexType)2, model.GetCacheStatistics().Hits);
+         Assert::AreEqual((IndexType)0, model.GetCacheStatistics().Invalidations);
+
+         // storing a new definition doesn't invalidate anything
+         model.StorePoint(4, 100, 100);
+         Assert::IsTrue(alignment == model.GetCachedAlignment(1));
+
+         // changing a point the curve depends on invalidates the curve and the alignment
+         model.ReplacePoint(3, 1000, 600);
+         auto new_alignment = model.GetCachedAlignment(1);
+         auto new_curve = model.GetCachedCircularCurve(1);
+         Assert::IsTrue(alignment != new_alignment);
+         Assert::IsTrue(curve != new_curve);
+         Assert::AreEqual((IndexType)2, model.GetCacheStatistics().Invalidations);
+         Assert::IsTrue(new_curve->GetPFT() == WBFL::Geometry::Point2d(1000, 600));
+
+         // the previously returned objects are unchanged
+         Assert::IsTrue(curve->GetPFT() == WBFL::Geometry::Point2d(1000, 700));
+
+         // changing a profile definition doesn't invalidate the curve
+         model.StoreProfilePoint(1, 0.0, 100.0);
+         model.ClearProfilePoints();
+         Assert::IsTrue(new_curve == model.GetCachedCircularCurve(1));
+         Assert::IsTrue(new_alignment != model.GetCachedAlignment(1));
+
+         model.ResetCacheStatistics();
+         Assert::AreEqual((IndexType)0, model.GetCacheStatistics().Hits);
+
+         // undefined objects throw and are not cached
+         Assert::ExpectException<XCoordGeom>([&model]() {model.GetCachedAlignment(2); });
+         Assert::AreEqual((IndexType)1, model.GetCacheStatistics().Misses);
+
+         model.Clear();
+         Assert::ExpectException<XCoordGeom>([&model]() {model.GetCachedAlignment(1); });
+      }
+
       TEST_METHOD(Tangent)
       {
          Model model;
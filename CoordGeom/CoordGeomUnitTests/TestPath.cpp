@@ -651,6 +651,58 @@ namespace CoordGeomUnitTest
       }
 
 
+      TEST_METHOD(ProjectPointManyElements)
+      {
+         // path consisting of many elements along a gently curving line
+         // ProjectPoint uses a bounding box hierarchy to limit the number of elements
+         // that are evaluated. Make sure the projections are the same as locating the points.
+         auto path = Path::Create();
+         const IndexType nSegments = 200;
+         const Float64 dx = 10.0;
+         for (IndexType i = 0; i < nSegments; i++)
+         {
+            Float64 x1 = i * dx;
+            Float64 x2 = (i + 1) * dx;
+            path->AddPathElement(PathSegment::Create(x1, 100 * sin(x1 / 500), x2, 100 * sin(x2 / 500)));
+         }
+
+         WBFL::Geometry::Point2d pbt(nSegments * dx, 100 * sin(nSegments * dx / 500));
+         auto bearing = path->GetBearing(path->GetLength());
+         WBFL::Geometry::Point2d pi = COGO::LocateByDistanceAndDirection(pbt, 200.0, bearing, 0.0);
+         WBFL::Geometry::Point2d pft = COGO::LocateByDistanceAndDirection(pi, 200.0, bearing.IncrementBy(Angle(M_PI / 8)), 0.0);
+         path->AddPathElement(CompoundCurve::Create(pbt, pi, pft, 500, 50, TransitionCurveType::Clothoid, 50, TransitionCurveType::Clothoid));
+
+         // locate points at the middle of each element, and on the back and ahead tangents
+         std::vector<Float64> vDistFromStart{ -100.0 };
+         Float64 start = 0;
+         for (const auto& element : path->GetPathElements())
+         {
+            Float64 length = element->GetLength();
+            vDistFromStart.push_back(start + length / 2);
+            start += length;
+         }
+         vDistFromStart.push_back(path->GetLength() + 100.0);
+
+         for (auto dist_from_start : vDistFromStart)
+         {
+            for (Float64 path_offset : {-5.0, 0.0, 5.0})
+            {
+               auto pnt = path->LocatePoint(dist_from_start, OffsetType::AlongDirection, path_offset, path->GetNormal(dist_from_start));
+               auto [dist, offset] = path->DistanceAndOffset(pnt);
+               Assert::AreEqual(dist_from_start, dist, 0.0001);
+               Assert::AreEqual(path_offset, offset, 0.0001);
+            }
+         }
+
+         // change the path and make sure the projections are updated
+         path->Offset(1000, 1000);
+         auto pnt = path->LocatePoint(500.0, OffsetType::AlongDirection, 0.0, path->GetNormal(500.0));
+         auto [newPnt, dist, bOnProjection] = path->ProjectPoint(pnt);
+         Assert::IsTrue(newPnt == pnt);
+         Assert::AreEqual(500.0, dist, 0.0001);
+         Assert::IsFalse(bOnProjection);
+      }
+
       TEST_METHOD(SubPath1)
       {
          // Test sub-path with empty alignment
@@ -40,6 +40,31 @@ namespace CoordGeomUnitTest
          //std::cout << std::endl;
       }
 
+      void TestElevationGrid(const Profile& profile, IDType surfaceID, long minStation = 440, long maxStation = 1560, long inc = 40)
+      {
+         auto alignment = profile.GetAlignment();
+         std::vector<Station> vStations;
+         for (long i = minStation; i <= maxStation; i += inc)
+         {
+            vStations.emplace_back(alignment->ConvertFromNormalizedStation((Float64)i));
+         }
+
+         std::vector<Float64> vOffsets{ -20, -15, -5, -2, 0, 2, 5, 15, 20 };
+
+         for (auto bParallel : { false, true })
+         {
+            auto vElevations = profile.ElevationGrid(surfaceID, vStations, vOffsets, bParallel);
+            Assert::AreEqual(vStations.size() * vOffsets.size(), vElevations.size());
+            for (IndexType i = 0; i < vStations.size(); i++)
+            {
+               for (IndexType j = 0; j < vOffsets.size(); j++)
+               {
+                  Assert::IsTrue(IsEqual(vElevations[i * vOffsets.size() + j], profile.Elevation(surfaceID, vStations[i], vOffsets[j])));
+               }
+            }
+         }
+      }
+
       void TestCrownSlopes(const Profile& profile, IndexType surfaceIdx, IndexType ridgePointIdx, Float64 results[][2], long minStation = 440, long maxStation = 1560, long inc = 160)
       {
          auto alignment = profile.GetAlignment();
@@ -166,6 +191,29 @@ namespace CoordGeomUnitTest
          Float64 Grades[] = { 5.0000, 5.0000, 4.2000, 2.06667, -0.06667, -2.2000, -3.0000, -3.0000 };
          TestGrade(*profile, Grades);
 
+         // batch evaluation, crossing the station equations
+         std::vector<Station> vStations;
+         for (long i = 440; i <= 1560; i += 160)
+         {
+            vStations.push_back(alignment->ConvertFromNormalizedStation((Float64)i));
+         }
+         std::vector<Float64> vElevations(vStations.size());
+         std::vector<Float64> vGrades(vStations.size());
+         profile->GradesAndElevations(vStations, vElevations, vGrades);
+         for (IndexType i = 0; i < vStations.size(); i++)
+         {
+            Assert::IsTrue(IsEqual(vGrades[i] * 100, Grades[i]));
+            Assert::IsTrue(IsEqual(vElevations[i], profile->Elevation(vStations[i])));
+         }
+
+         // stations out of order still give the correct result
+         std::reverse(vStations.begin(), vStations.end());
+         profile->GradesAndElevations(vStations, vElevations);
+         for (IndexType i = 0; i < vStations.size(); i++)
+         {
+            Assert::IsTrue(IsEqual(vElevations[i], profile->Elevation(vStations[i])));
+         }
+
          Float64 CrownSlopes1[][2] = { { 0.0200, -0.0200}, { 0.0200, -0.0200}, { 0.0040, -0.0280}, { -0.03867, -0.04933}, { -0.03333,-0.06533}, { 0.0200, -0.07600}, { 0.0400, -0.0800}, { 0.0400, -0.0800} };
          TestCrownSlopes(*profile, 0, 2, CrownSlopes1);
 
@@ -380,6 +428,71 @@ namespace CoordGeomUnitTest
          TestElevation(*profile, 0, 2, ElevR);
          TestElevation(*profile, 0, 5, ElevS);
          TestElevation(*profile, 0, 15, ElevT);
+
+         TestElevationGrid(*profile, 0);
+      }
+
+      TEST_METHOD(ElevationGridFirstQuery)
+      {
+         // Same profile and surface as Test3. The parallel elevation grid is the first query on the
+         // surface so none of its lazily computed data has been created before the concurrent evaluation.
+         auto alignment = Alignment::Create();
+         auto profile = Profile::Create();
+         alignment->AddProfile(0, profile);
+
+         auto vc = VerticalCurve::Create(ProfilePoint(700, 85), ProfilePoint(1000, 100), ProfilePoint(1300, 91), 300, 300);
+         auto seg = ProfileSegment::Create();
+         seg->Move(ProfilePoint(1300, 91), ProfilePoint(1400, 88));
+
+         profile->AddProfileElement(vc);
+         profile->AddProfileElement(seg);
+
+         auto surface = Surface::Create();
+         profile->AddSurface(0, surface);
+
+         surface->SetAlignmentPoint(3);
+         surface->SetProfileGradePoint(3);
+         surface->SetSurfaceTemplateSegmentCount(4);
+
+         Float64 slopes[][4] = { {0.02, 0.02, -0.02, -0.02}, {0.02, 0.02, -0.02, -0.02}, {-0.06, -0.06, -0.06, -0.06}, {0.04, 0.04, -0.08, -0.08}, {0.04, 0.04, -0.08, -0.08} };
+         Float64 widths[] = { 20.0, 5.0, 5.0, 20.0 };
+         Float64 template_stations[] = { 430, 700, 1000, 1300, 1600 };
+         for (IndexType i = 0; i < 5; i++)
+         {
+            auto surface_template = surface->CreateSurfaceTemplate(template_stations[i]);
+            for (IndexType j = 0; j < 4; j++)
+            {
+               surface_template->UpdateSegmentParameters(j, widths[j], slopes[i][j], SurfaceTemplateSegment::SlopeType::Horizontal);
+            }
+         }
+
+         std::vector<Station> vStations;
+         for (long i = 440; i <= 1560; i += 160)
+         {
+            vStations.emplace_back(alignment->ConvertFromNormalizedStation((Float64)i));
+         }
+
+         std::vector<Float64> vOffsets{ -15, -5, -2, 0, 5 };
+
+         auto vElevations = profile->ElevationGrid(0, vStations, vOffsets, true);
+
+         // Expected values from Test3
+         Float64 Elev[][8] = {
+            { 71.900, 79.900, 87.860, 93.40666, 95.03333, 92.740, 88.000, 83.200 },
+            { 72.100, 80.100, 87.900, 93.020, 94.700, 92.940, 88.400, 83.600 },
+            { 72.040, 80.040, 87.816, 92.872, 94.504, 92.712, 88.160, 83.360 },
+            { 72.000, 80.000, 87.760, 92.77333, 94.37333, 92.560, 88.000, 83.200 },
+            { 71.900, 79.900, 87.620, 92.52666, 94.04666, 92.180, 87.600, 82.800 }
+         };
+
+         Assert::AreEqual(vStations.size() * vOffsets.size(), vElevations.size());
+         for (IndexType i = 0; i < vStations.size(); i++)
+         {
+            for (IndexType j = 0; j < vOffsets.size(); j++)
+            {
+               Assert::IsTrue(IsEqual(vElevations[i * vOffsets.size() + j], Elev[j][i]));
+            }
+         }
       }
 
       TEST_METHOD(Test4)
@@ -1333,6 +1446,8 @@ namespace CoordGeomUnitTest
          TestElevation(*profile, 0, 0, ElevC);
          TestElevation(*profile, 0, -20, ElevB); // pivot on left edge... elevations don't change
          TestElevation(*profile, 0, 20, ElevD);
+
+         TestElevationGrid(*profile, 0);
       }
 
       TEST_METHOD(Test15)
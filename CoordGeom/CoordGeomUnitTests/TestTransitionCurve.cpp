@@ -40,7 +40,7 @@ namespace CoordGeomUnitTest
             std::make_pair(39.8977, 2.12944),
             std::make_pair(59.2271, 7.13362),
             std::make_pair(76.7848, 16.5738),
-            std::make_pair(90.4523, 31.0268)
+            std::make_pair(90.4524, 31.0268)
          };
          Verify(L, curve.get(), values1);
 
@@ -52,7 +52,7 @@ namespace CoordGeomUnitTest
             std::make_pair(39.4645,5.73933),
             std::make_pair(57.7564,13.7137),
             std::make_pair(73.2775,26.2078),
-            std::make_pair(83.8359,43.0612)
+            std::make_pair(83.8367,43.0613)
          };
 
          curve->Init(WBFL::Geometry::Point2d(0,0), 0.0, R1, R2, L, TransitionCurveType::Clothoid);
@@ -70,7 +70,7 @@ namespace CoordGeomUnitTest
             std::make_pair(39.8977, -2.12944),
             std::make_pair(59.2271, -7.13362),
             std::make_pair(76.7848, -16.5738),
-            std::make_pair(90.4523, -31.0268)
+            std::make_pair(90.4524, -31.0268)
          };
          Verify(L, curve.get(), values3);
 
@@ -81,11 +81,11 @@ namespace CoordGeomUnitTest
          std::array<std::pair<Float64, Float64>, 6> values4
          {
             std::make_pair(0, 0),
-            std::make_pair(19.5464, -3.69183),
-            std::make_pair(36.9765, -13.3656),
-            std::make_pair(51.6311, -26.9269),
-            std::make_pair(63.9511, -42.6664),
-            std::make_pair(74.9797, -59.3491)
+            std::make_pair(19.5465, -3.69195),
+            std::make_pair(36.9766, -13.3657),
+            std::make_pair(51.6311, -26.9270),
+            std::make_pair(63.9511, -42.6666),
+            std::make_pair(74.9798, -59.3492)
          };
          Verify(L, curve.get(), values4);
       }
@@ -123,5 +123,74 @@ namespace CoordGeomUnitTest
             Assert::AreEqual(-4.89967175285863E-3, sin(direction.GetValue()), 0.001);
          }
       }
+
+      TEST_METHOD(LargeAngle)
+      {
+         // The spiral coordinates are Fresnel integrals. Compare with numerical integration
+         // for a spiral that sweeps through several radians
+         Float64 R = 10;
+         Float64 L = 200; // spiral angle = L/(2R) = 10 radians
+         auto curve = TransitionCurve::Create(WBFL::Geometry::Point2d(0, 0), 0.0, 0, R, L, TransitionCurveType::Clothoid);
+
+         Float64 A2 = R * L;
+         for (Float64 s : {10.0, 50.0, 100.0, 150.0, 200.0})
+         {
+            // Simpson's rule integration of x = Integral cos(u^2/2A^2)du, y = Integral sin(u^2/2A^2)du
+            IndexType nSteps = 20000;
+            Float64 h = s / nSteps;
+            Float64 x = 0;
+            Float64 y = 0;
+            for (IndexType i = 0; i <= nSteps; i++)
+            {
+               Float64 u = i * h;
+               Float64 w = (i == 0 || i == nSteps) ? 1 : (i % 2 == 0 ? 2 : 4);
+               x += w * cos(u * u / (2 * A2));
+               y += w * sin(u * u / (2 * A2));
+            }
+            x *= h / 3;
+            y *= h / 3;
+
+            auto p = curve->PointOnCurve(s);
+            Assert::AreEqual(x, p.X(), 0.00001);
+            Assert::AreEqual(y, p.Y(), 0.00001);
+
+            auto bearing = curve->GetBearing(s);
+            Assert::AreEqual(fmod(s * s / (2 * A2), TWO_PI), bearing.GetValue(), 0.00001);
+         }
+      }
+
+      TEST_METHOD(ProjectPoint)
+      {
+         // Points offset normal to the curve must project back to where they were located.
+         // The end points are skipped because points on the normal at the ends are equally near the tangent projections
+         std::array<std::pair<Float64, Float64>, 6> radii
+         {
+            std::make_pair(0.0, 500.0),
+            std::make_pair(500.0, 0.0),
+            std::make_pair(0.0, -500.0),
+            std::make_pair(-500.0, 0.0),
+            std::make_pair(1000.0, 300.0),
+            std::make_pair(300.0, 1000.0)
+         };
+
+         Float64 L = 200;
+         for (const auto& [R1, R2] : radii)
+         {
+            auto curve = TransitionCurve::Create(WBFL::Geometry::Point2d(100, 200), Direction(M_PI / 6), R1, R2, L, TransitionCurveType::Clothoid);
+            for (Float64 distFromStart = 12.5; distFromStart < L; distFromStart += 12.5)
+            {
+               for (Float64 offset : {-20.0, -5.0, 0.0, 5.0, 20.0})
+               {
+                  auto pnt = curve->LocatePoint(distFromStart, OffsetType::AlongDirection, offset, curve->GetNormal(distFromStart));
+                  auto [prjPoint, dist, bOnProjection] = curve->ProjectPoint(pnt);
+                  Assert::AreEqual(distFromStart, dist, 0.0001);
+                  Assert::IsTrue(prjPoint == curve->PointOnCurve(distFromStart));
+                  Assert::IsFalse(bOnProjection);
+
+                  Assert::AreEqual(distFromStart, curve->DistanceFromStart(pnt), 0.0001);
+               }
+            }
+         }
+      }
    };
 }
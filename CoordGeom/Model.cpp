@@ -79,6 +79,7 @@ bool Model::ReplacePoint(IDType id, const WBFL::Geometry::Point2d& point)
    }
 
    found->second = point;
+   DefinitionChanged(DefinitionType::Points);
    return true;
 }
 
@@ -89,7 +90,9 @@ bool Model::ReplacePoint(IDType id, Float64 x, Float64 y)
 
 bool Model::RemovePoint(IDType id)
 {
-   return RemoveItem(m_Points, id);
+   if (!RemoveItem(m_Points, id)) return false;
+   DefinitionChanged(DefinitionType::Points);
+   return true;
 }
 
 WBFL::Geometry::Point2d Model::GetPoint(IDType id)
@@ -118,6 +121,7 @@ const std::map<IDType, WBFL::Geometry::Point2d>& Model::GetPoints() const
 void Model::ClearPoints()
 {
    m_Points.clear();
+   DefinitionChanged(DefinitionType::Points);
 }
 
 bool Model::StorePathSegment(IDType id, IDType startID, IDType endID)
@@ -134,7 +138,9 @@ bool Model::StorePathSegment(IDType id, const PathSegmentDefinition& definition)
 
 bool Model::RemovePathSegment(IDType id)
 {
-   return RemoveItem(m_Segments, id);
+   if (!RemoveItem(m_Segments, id)) return false;
+   DefinitionChanged(DefinitionType::PathElements);
+   return true;
 }
 
 const Model::PathSegmentDefinition& Model::GetPathSegment(IDType id) const
@@ -169,6 +175,7 @@ const std::map<IDType, Model::PathSegmentDefinition>& Model::GetPathSegments() c
 void Model::ClearPathSegments()
 {
    m_Segments.clear();
+   DefinitionChanged(DefinitionType::PathElements);
 }
 
 bool Model::StoreCompoundCurve(IDType id, IDType pbtID, IDType piID, IDType pftID, Float64 radius, Float64 lsEntry, TransitionCurveType lsEntryType, Float64 lsExit, TransitionCurveType lsExitType)
@@ -185,7 +192,9 @@ bool Model::StoreCompoundCurve(IDType id, CompoundCurveDefinition& definition)
 
 bool Model::RemoveCompoundCurve(IDType id)
 {
-   return RemoveItem(m_CompoundCurves, id);
+   if (!RemoveItem(m_CompoundCurves, id)) return false;
+   DefinitionChanged(DefinitionType::PathElements);
+   return true;
 }
 
 const Model::CompoundCurveDefinition& Model::GetCompoundCurve(IDType id) const
@@ -218,6 +227,7 @@ const std::map<IDType, Model::CompoundCurveDefinition>& Model::GetCompoundCurves
 void Model::ClearCompoundCurves()
 {
    m_CompoundCurves.clear();
+   DefinitionChanged(DefinitionType::PathElements);
 }
 
 bool Model::StoreCircularCurve(IDType id, IDType pbtID, IDType piID, IDType pftID, Float64 radius)
@@ -234,7 +244,9 @@ bool Model::StoreCircularCurve(IDType id, const CircularCurveDefinition& definit
 
 bool Model::RemoveCircularCurve(IDType id)
 {
-   return RemoveItem(m_CircularCurves, id);
+   if (!RemoveItem(m_CircularCurves, id)) return false;
+   DefinitionChanged(DefinitionType::PathElements);
+   return true;
 }
 
 const Model::CircularCurveDefinition& Model::GetCircularCurve(IDType id) const
@@ -267,6 +279,7 @@ const std::map<IDType, Model::CircularCurveDefinition>& Model::GetCircularCurves
 void Model::ClearCircularCurves()
 {
    m_CircularCurves.clear();
+   DefinitionChanged(DefinitionType::PathElements);
 }
 
 bool Model::StoreTransitionCurve(IDType id, IDType startID, const Direction& direction, Float64 r1, Float64 r2, Float64 L, TransitionCurveType transitionType)
@@ -283,7 +296,9 @@ bool Model::StoreTransitionCurve(IDType id, const TransitionCurveDefinition& def
 
 bool Model::RemoveTransitionCurve(IDType id)
 {
-   return RemoveItem(m_TransitionCurves, id);
+   if (!RemoveItem(m_TransitionCurves, id)) return false;
+   DefinitionChanged(DefinitionType::PathElements);
+   return true;
 }
 
 const Model::TransitionCurveDefinition& Model::GetTransitionCurve(IDType id) const
@@ -314,6 +329,7 @@ const std::map<IDType, Model::TransitionCurveDefinition>& Model::GetTransitionCu
 void Model::ClearTransitionCurves()
 {
    m_TransitionCurves.clear();
+   DefinitionChanged(DefinitionType::PathElements);
 }
 
 bool Model::StoreCubicSpline(IDType id, const std::vector<IDType>& vPointIDs)
@@ -324,7 +340,9 @@ bool Model::StoreCubicSpline(IDType id, const std::vector<IDType>& vPointIDs)
 
 bool Model::RemoveCubicSpline(IDType id)
 {
-   return RemoveItem(m_CubicSplines,id);
+   if (!RemoveItem(m_CubicSplines, id)) return false;
+   DefinitionChanged(DefinitionType::PathElements);
+   return true;
 }
 
 const std::vector<IDType>& Model::GetCubicSpline(IDType id) const
@@ -360,6 +378,7 @@ const std::map<IDType, std::vector<IDType>>& Model::GetCubicSplines()
 void Model::ClearCubicSplines()
 {
    m_CubicSplines.clear();
+   DefinitionChanged(DefinitionType::PathElements);
 }
 
 bool Model::StoreAlignment(IDType alignmentID)
@@ -385,12 +404,15 @@ bool Model::AppendElementToAlignment(IDType alignmentID, const PathElementDefini
    if (found == m_Alignments.end()) return false;
 
    found->second.emplace_back(item);
+   DefinitionChanged(DefinitionType::Alignments);
    return true;
 }
 
 bool Model::RemoveAlignment(IDType alignmentID)
 {
-   return RemoveItem(m_Alignments, alignmentID);
+   if (!RemoveItem(m_Alignments, alignmentID)) return false;
+   DefinitionChanged(DefinitionType::Alignments);
+   return true;
 }
 
 const std::vector<Model::PathElementDefinition>& Model::GetAlignment(IDType alignmentID) const
@@ -446,17 +468,21 @@ void Model::ClearAlignments(bool bClearRefStations)
 {
    m_Alignments.clear();
    if (bClearRefStations) m_AlignmentReferenceStations.clear();
+   DefinitionChanged(DefinitionType::Alignments);
 }
 
 bool Model::SetAlignmentReferenceStation(IDType alignmentID, const Station& station)
 {
    auto result = m_AlignmentReferenceStations.emplace(alignmentID, station);
+   if (result.second) DefinitionChanged(DefinitionType::Alignments);
    return result.second;
 }
 
 bool Model::RemoveAlignmentReferenceStation(IDType alignmentID)
 {
-   return RemoveItem(m_AlignmentReferenceStations, alignmentID);
+   if (!RemoveItem(m_AlignmentReferenceStations, alignmentID)) return false;
+   DefinitionChanged(DefinitionType::Alignments);
+   return true;
 }
 
 const Station& Model::GetAlignmentReferenceStation(IDType alignmentID) const
@@ -485,6 +511,7 @@ bool Model::AddStationEquation(IDType alignmentID, const StationEquationDefiniti
    }
 
    found->second.emplace_back(definition);
+   DefinitionChanged(DefinitionType::Alignments);
    return true;
 }
 
@@ -516,6 +543,7 @@ void Model::ClearStationEquations(IDType alignmentID)
 
       found->second.clear();
    }
+   DefinitionChanged(DefinitionType::Alignments);
 }
 
 bool Model::StorePath(IDType id)
@@ -541,12 +569,15 @@ bool Model::AppendElementToPath(IDType pathID, const PathElementDefinition& item
    if (found == m_Paths.end()) return false;
 
    found->second.emplace_back(item);
+   DefinitionChanged(DefinitionType::Paths);
    return true;
 }
 
 bool Model::RemovePath(IDType id)
 {
-   return RemoveItem(m_Paths, id);
+   if (!RemoveItem(m_Paths, id)) return false;
+   DefinitionChanged(DefinitionType::Paths);
+   return true;
 }
 
 const std::vector<Model::PathElementDefinition>& Model::GetPath(IDType id) const
@@ -573,6 +604,7 @@ const std::map<IDType, std::vector<Model::PathElementDefinition>>& Model::GetPat
 void Model::ClearPaths()
 {
    m_Paths.clear();
+   DefinitionChanged(DefinitionType::Paths);
 }
 
 bool Model::StoreProfilePoint(IDType id, const ProfilePoint& profilePoint)
@@ -595,6 +627,7 @@ bool Model::ReplaceProfilePoint(IDType id, const ProfilePoint& profilePoint)
    }
 
    found->second = profilePoint;
+   DefinitionChanged(DefinitionType::ProfileElements);
    return true;
 }
 
@@ -605,7 +638,9 @@ bool Model::ReplaceProfilePoint(IDType id, const Station& station, Float64 eleva
 
 bool Model::RemoveProfilePoint(IDType id)
 {
-   return m_ProfilePoints.erase(id) == 1 ? true : false;
+   if (m_ProfilePoints.erase(id) != 1) return false;
+   DefinitionChanged(DefinitionType::ProfileElements);
+   return true;
 }
 
 ProfilePoint Model::GetProfilePoint(IDType id)
@@ -634,6 +669,7 @@ const std::map<IDType, ProfilePoint>& Model::GetProfilePoints() const
 void Model::ClearProfilePoints()
 {
    m_ProfilePoints.clear();
+   DefinitionChanged(DefinitionType::ProfileElements);
 }
 
 bool Model::StoreProfileSegment(IDType id, IDType startID, IDType endID)
@@ -655,6 +691,7 @@ bool Model::RemoveProfileSegment(IDType id)
       return false;
 
    m_ProfileSegments.erase(found);
+   DefinitionChanged(DefinitionType::ProfileElements);
    return true;
 }
 
@@ -685,6 +722,7 @@ const std::map<IDType, Model::ProfileSegmentDefinition>& Model::GetProfileSegmen
 void Model::ClearProfileSegments()
 {
    m_ProfileSegments.clear();
+   DefinitionChanged(DefinitionType::ProfileElements);
 }
 
 bool Model::StoreVerticalCurve(IDType id, IDType pbgID, IDType pviID, IDType pftID, Float64 l1_or_g1, Float64 l2_or_g2)
@@ -706,6 +744,7 @@ bool Model::RemoveVerticalCurve(IDType id)
       return false;
 
    m_VerticalCurves.erase(found);
+   DefinitionChanged(DefinitionType::ProfileElements);
    return true;
 }
 
@@ -748,6 +787,7 @@ const std::map<IDType, Model::VerticalCurveDefinition>& Model::GetVerticalCurves
 void Model::ClearVerticalCurves()
 {
    m_VerticalCurves.clear();
+   DefinitionChanged(DefinitionType::ProfileElements);
 }
 
 bool Model::StoreProfile(IDType id)
@@ -767,6 +807,7 @@ bool Model::AppendElementToProfile(IDType profileID, ProfileElementType type, ID
    if (found == m_Profiles.end()) return false;
 
    found->second.emplace_back(type, elementID);
+   DefinitionChanged(DefinitionType::Profiles);
    return true;
 }
 
@@ -782,6 +823,7 @@ bool Model::RemoveProfile(IDType id)
    if (found2 != m_ProfileAlignmentAssociations.end())
       m_ProfileAlignmentAssociations.erase(found2);
 
+   DefinitionChanged(DefinitionType::Profiles);
    return true;
 }
 
@@ -810,6 +852,7 @@ void Model::ClearProfiles()
 {
    m_Profiles.clear();
    m_ProfileAlignmentAssociations.clear();
+   DefinitionChanged(DefinitionType::Profiles);
 }
 
 bool Model::StoreSurface(IDType surfaceID, IndexType nSegments, IndexType alignmentPointIdx, IndexType profilePointIdx)
@@ -861,13 +904,14 @@ bool Model::AddSurfaceTemplate(IDType surfaceID, const Station& station)
 
       // put the collection of surface templates for this surface into the surface templates storage
       auto [iter,bSuccess] = m_SurfaceTemplates.emplace(surfaceID, vSurfaceTemplates);
-      return bSuccess;
+      if (!bSuccess) return false;
    }
    else
    {
       // a surface template has already been defined. append the new surface template to the existing collection
       found->second.emplace_back(std::make_pair(station, vSurfaceTemplateSegments));
    }
+   DefinitionChanged(DefinitionType::Surfaces);
    return true;
 }
 
@@ -886,6 +930,7 @@ bool Model::CopySurfaceTemplate(IDType surfaceID, IndexType templateIdx, const S
    auto& this_surface_template = surface_templates.back();
    this_surface_template = surface_template;
    this_surface_template.first = station; // the assignment on the line above changes the station - put it back to the correct value
+   DefinitionChanged(DefinitionType::Surfaces);
    return true;
 }
 
@@ -898,6 +943,7 @@ bool Model::MoveSurfaceTemplate(IDType surfaceID, IndexType templateIdx, const S
    if (surface_templates.size() <= templateIdx) return false;
 
    surface_templates[templateIdx].first = station;
+   DefinitionChanged(DefinitionType::Surfaces);
    return true;
 }
 
@@ -956,6 +1002,7 @@ bool Model::UpdateSurfaceTemplateSegment(IDType surfaceID, IndexType templateIdx
       THROW_COGO(WBFL_COGO_E_INVALIDARG);
 
    surface_templates[templateIdx].second[segmentIdx] = surfaceTemplateSegment;
+   DefinitionChanged(DefinitionType::Surfaces);
    return true;
 }
 
@@ -980,6 +1027,7 @@ bool Model::StoreSuperelevation(IDType surfaceID, const SuperelevationDefinition
    }
 
    found->second.emplace_back(definition);
+   DefinitionChanged(DefinitionType::Surfaces);
 
    return true;
 }
@@ -1009,12 +1057,14 @@ bool Model::ClearSuperelevations(IDType surfaceID)
 
    auto& [id, definitions] = *found;
    definitions.clear();
+   DefinitionChanged(DefinitionType::Surfaces);
    return true;
 }
 
 void Model::ClearSuperelevations()
 {
    m_Superelevations.clear();
+   DefinitionChanged(DefinitionType::Surfaces);
 }
 
 bool Model::StoreWidening(IDType surfaceID, const Station& beginTrasitionStation, const Station& beginFullWidening, const Station& endFullWidening, const Station& endTrasitionStation, Float64 widening, IndexType segment1, IndexType segment2)
@@ -1037,6 +1087,7 @@ bool Model::StoreWidening(IDType surfaceID, const WideningDefinition& definition
 
    auto& [id, widenings] = *found;
    widenings.emplace_back(definition);
+   DefinitionChanged(DefinitionType::Surfaces);
 
    return true;
 }
@@ -1064,12 +1115,14 @@ bool Model::ClearWidenings(IDType surfaceID)
    }
 
    found->second.clear();
+   DefinitionChanged(DefinitionType::Surfaces);
    return true;
 }
 
 void Model::ClearWidenings()
 {
    m_Widenings.clear();
+   DefinitionChanged(DefinitionType::Surfaces);
 }
 
 std::shared_ptr<Surface> Model::CreateSurface(IDType surfaceID) const
@@ -1110,6 +1163,7 @@ bool Model::RemoveSurface(IDType surfaceID, bool bClearModifiers)
       }
    }
 
+   DefinitionChanged(DefinitionType::Surfaces);
    return true;
 }
 
@@ -1124,16 +1178,20 @@ void Model::ClearSurfaces(bool bClearModifiers)
       m_Superelevations.clear();
       m_Widenings.clear();
    }
+
+   DefinitionChanged(DefinitionType::Surfaces);
 }
 
 void Model::AttachProfileToAlignment(IDType profileID, IDType alignmentID)
 {
-   m_ProfileAlignmentAssociations.emplace(profileID, alignmentID);
+   auto result = m_ProfileAlignmentAssociations.emplace(profileID, alignmentID);
+   if (result.second) DefinitionChanged(DefinitionType::Profiles);
 }
 
 void Model::AttachSurfaceToProfile(IDType surfaceID, IDType profileID)
 {
-   m_SurfaceProfileAssociations.emplace(surfaceID, profileID);
+   auto result = m_SurfaceProfileAssociations.emplace(surfaceID, profileID);
+   if (result.second) DefinitionChanged(DefinitionType::Surfaces);
 }
 
 void Model::Clear()
@@ -1151,6 +1209,72 @@ void Model::Clear()
    ClearProfiles();
    ClearStationEquations();
    ClearSurfaces(); // clears surface profile associations and surface modifiers
+   ClearCache();
+}
+
+std::shared_ptr<const CompoundCurve> Model::GetCachedCompoundCurve(IDType id) const
+{
+   return GetCachedItem(m_CompoundCurveCache, id, { DefinitionType::Points, DefinitionType::PathElements }, [this](IDType id) {return CreateCompoundCurve(id); });
+}
+
+std::shared_ptr<const CircularCurve> Model::GetCachedCircularCurve(IDType id) const
+{
+   return GetCachedItem(m_CircularCurveCache, id, { DefinitionType::Points, DefinitionType::PathElements }, [this](IDType id) {return CreateCircularCurve(id); });
+}
+
+std::shared_ptr<const TransitionCurve> Model::GetCachedTransitionCurve(IDType id) const
+{
+   return GetCachedItem(m_TransitionCurveCache, id, { DefinitionType::Points, DefinitionType::PathElements }, [this](IDType id) {return CreateTransitionCurve(id); });
+}
+
+std::shared_ptr<const CubicSpline> Model::GetCachedCubicSpline(IDType id) const
+{
+   return GetCachedItem(m_CubicSplineCache, id, { DefinitionType::Points, DefinitionType::PathElements }, [this](IDType id) {return CreateCubicSpline(id); });
+}
+
+std::shared_ptr<const Path> Model::GetCachedPath(IDType pathID) const
+{
+   return GetCachedItem(m_PathCache, pathID, { DefinitionType::Points, DefinitionType::PathElements, DefinitionType::Paths }, [this](IDType id) {return CreatePath(id); });
+}
+
+std::shared_ptr<const Alignment> Model::GetCachedAlignment(IDType alignmentID) const
+{
+   // alignments carry their associated profiles, and the profiles carry their associated surfaces, so an alignment depends on every type of definition
+   return GetCachedItem(m_AlignmentCache, alignmentID,
+      { DefinitionType::Points, DefinitionType::PathElements, DefinitionType::Paths, DefinitionType::Alignments, DefinitionType::ProfileElements, DefinitionType::Profiles, DefinitionType::Surfaces },
+      [this](IDType id) {return CreateAlignment(id); });
+}
+
+std::shared_ptr<const Profile> Model::GetCachedProfile(IDType profileID) const
+{
+   return GetCachedItem(m_ProfileCache, profileID, { DefinitionType::ProfileElements, DefinitionType::Profiles, DefinitionType::Surfaces }, [this](IDType id) {return CreateProfile(id); });
+}
+
+std::shared_ptr<const Surface> Model::GetCachedSurface(IDType surfaceID) const
+{
+   return GetCachedItem(m_SurfaceCache, surfaceID, { DefinitionType::Surfaces }, [this](IDType id) {return CreateSurface(id); });
+}
+
+const Model::CacheStatistics& Model::GetCacheStatistics() const
+{
+   return m_CacheStatistics;
+}
+
+void Model::ResetCacheStatistics()
+{
+   m_CacheStatistics = CacheStatistics();
+}
+
+void Model::ClearCache()
+{
+   m_CompoundCurveCache.clear();
+   m_CircularCurveCache.clear();
+   m_TransitionCurveCache.clear();
+   m_CubicSplineCache.clear();
+   m_PathCache.clear();
+   m_AlignmentCache.clear();
+   m_ProfileCache.clear();
+   m_SurfaceCache.clear();
 }
 
 Angle Model::MeasureAngle(IDType fromID, IDType vertexID, IDType toID) const
@@ -1405,7 +1529,7 @@ bool Model::IntersectPathSegmentAndCircle(IDType newID, IDType lsID, Float64 off
 
 bool Model::ProjectPointOnCompoundCurve(IDType newID, IDType fromID, IDType curveID)
 {
-   auto curve = CreateCompoundCurve(curveID);
+   auto curve = GetCachedCompoundCurve(curveID);
    const auto& point = GetPoint(fromID);
    try
    {
@@ -1420,7 +1544,7 @@ bool Model::ProjectPointOnCompoundCurve(IDType newID, IDType fromID, IDType curv
 
 bool Model::ProjectPointOnTransitionCurve(IDType newID, IDType fromID, IDType curveID)
 {
-   auto curve = CreateTransitionCurve(curveID);
+   auto curve = GetCachedTransitionCurve(curveID);
    const auto& point = GetPoint(fromID);
    try
    {
@@ -1435,7 +1559,7 @@ bool Model::ProjectPointOnTransitionCurve(IDType newID, IDType fromID, IDType cu
 
 bool Model::ProjectPointOnCircularCurve(IDType newID, IDType fromID, IDType curveID)
 {
-   auto curve = CreateCircularCurve(curveID);
+   auto curve = GetCachedCircularCurve(curveID);
    const auto& point = GetPoint(fromID);
    try
    {
@@ -1450,7 +1574,7 @@ bool Model::ProjectPointOnCircularCurve(IDType newID, IDType fromID, IDType curv
 
 bool Model::ProjectPointOnPath(IDType newID, IDType fromID, IDType pathID)
 {
-   auto path = CreatePath(pathID);
+   auto path = GetCachedPath(pathID);
    const auto& point = GetPoint(fromID);
    try
    {
@@ -1465,7 +1589,7 @@ bool Model::ProjectPointOnPath(IDType newID, IDType fromID, IDType pathID)
 
 bool Model::ProjectPointOnAlignment(IDType newID, IDType fromID, IDType alignmentID)
 {
-   auto alignment = CreateAlignment(alignmentID);
+   auto alignment = GetCachedAlignment(alignmentID);
    const auto& point = GetPoint(fromID);
    try
    {
@@ -1566,7 +1690,7 @@ bool Model::DivideCompoundCurve(IDType firstID, IDType idInc, IDType curveID, In
 {
    if (nParts == INVALID_INDEX) return false;
 
-   auto curve = CreateCompoundCurve(curveID);
+   auto curve = GetCachedCompoundCurve(curveID);
 
    try
    {
@@ -1583,7 +1707,7 @@ bool Model::DivideTransitionCurve(IDType firstID, IDType idInc, IDType curveID,
 {
    if (nParts == INVALID_INDEX) return false;
 
-   auto curve = CreateTransitionCurve(curveID);
+   auto curve = GetCachedTransitionCurve(curveID);
    
    try
    {
@@ -1600,7 +1724,7 @@ bool Model::DivideCircularCurve(IDType firstID, IDType idInc, IDType curveID, In
 {
    if (nParts == INVALID_INDEX) return false;
 
-   auto curve = CreateCircularCurve(curveID);
+   auto curve = GetCachedCircularCurve(curveID);
    try
    {
       auto points = curve->Divide(nParts);
@@ -1616,7 +1740,7 @@ bool Model::DividePath(IDType firstID, IDType idInc, IDType pathID, IndexType nP
 {
    if (nParts == INVALID_INDEX) return false;
 
-   auto path = CreatePath(pathID);
+   auto path = GetCachedPath(pathID);
    
    try
    {
@@ -1633,7 +1757,7 @@ bool Model::DivideAlignment(IDType firstID, IDType idInc, IDType alignmentID, In
 {
    if (nParts == INVALID_INDEX) return false;
 
-   auto alignment = CreateAlignment(alignmentID);
+   auto alignment = GetCachedAlignment(alignmentID);
    
    try
    {
@@ -1981,6 +2105,36 @@ std::shared_ptr<Surface> Model::CreateSurface(IDType surfaceID,std::shared_ptr<P
    return surface;
 }
 
+void Model::DefinitionChanged(DefinitionType type)
+{
+   m_DefinitionRevisions[(size_t)type] = ++m_Revision;
+}
+
+template <class T, class F>
+std::shared_ptr<const T> Model::GetCachedItem(Cache<T>& cache, IDType id, std::initializer_list<DefinitionType> dependencies, F create) const
+{
+   auto found = cache.find(id);
+   if (found != cache.end())
+   {
+      auto& [revision, item] = found->second;
+      bool bIsCurrent = std::all_of(std::begin(dependencies), std::end(dependencies), [this, revision = revision](auto type) {return m_DefinitionRevisions[(size_t)type] <= revision; });
+      if (bIsCurrent)
+      {
+         m_CacheStatistics.Hits++;
+         return item;
+      }
+
+      // a definition this item depends on has changed since the item was created
+      cache.erase(found);
+      m_CacheStatistics.Invalidations++;
+   }
+
+   m_CacheStatistics.Misses++;
+   std::shared_ptr<const T> item = create(id); // throws if the definition is invalid, in which case nothing is cached
+   cache.emplace(id, std::make_pair(m_Revision, item));
+   return item;
+}
+
 template <class C> 
 bool Model::RemoveItem(C& container,IDType id)
 {
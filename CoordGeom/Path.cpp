@@ -29,6 +29,7 @@
 #include <CoordGeom/COGO.h>
 
 #include <xutility>
+#include <algorithm>
 
 using namespace WBFL::COGO;
 
@@ -194,6 +195,39 @@ std::pair<bool,WBFL::Geometry::Point2d> Path::Intersect(const WBFL::Geometry::Li
    return result;
 }
 
+void Path::LocatePoints(std::span<const Float64> vDistFromStart, OffsetType offsetType, std::span<const Float64> vOffsets, const Direction& direction, std::span<WBFL::Geometry::Point2d> vPoints) const
+{
+   PRECONDITION(vDistFromStart.size() == vOffsets.size());
+   PRECONDITION(vDistFromStart.size() == vPoints.size());
+
+   const auto& vElements = GetConnectedPathElements();
+   IndexType cursor = 0;
+   auto nPoints = vDistFromStart.size();
+   for (IndexType i = 0; i < nPoints; i++)
+   {
+      auto distFromStart = vDistFromStart[i];
+      cursor = MarchElement(distFromStart, cursor);
+      const auto& element(vElements[cursor]);
+      vPoints[i] = element.element->LocatePoint(distFromStart - element.start, offsetType, vOffsets[i], direction);
+   }
+}
+
+void Path::GetBearings(std::span<const Float64> vDistFromStart, std::span<Direction> vBearings) const
+{
+   PRECONDITION(vDistFromStart.size() == vBearings.size());
+
+   const auto& vElements = GetConnectedPathElements();
+   IndexType cursor = 0;
+   auto nPoints = vDistFromStart.size();
+   for (IndexType i = 0; i < nPoints; i++)
+   {
+      auto distFromStart = vDistFromStart[i];
+      cursor = MarchElement(distFromStart, cursor);
+      const auto& element(vElements[cursor]);
+      vBearings[i] = element.element->GetBearing(distFromStart - element.start);
+   }
+}
+
 //
 // PathElement methods
 //
@@ -278,20 +312,21 @@ Direction Path::GetBearing(Float64 distFromStart) const
 std::tuple<WBFL::Geometry::Point2d, Float64, bool> Path::ProjectPoint(const WBFL::Geometry::Point2d& point) const
 {
    Float64 shortestDistance = Float64_Max;
+   IndexType shortestElementIdx = INVALID_INDEX;
    WBFL::Geometry::Point2d the_point;
    Float64 the_distance = -99999.;
    bool the_projection = false;
 
    const auto& vElements = GetConnectedPathElements();
+   const auto& vNodes = GetBoundingTree();
 
-   auto nElements = vElements.size();
-   auto first = vElements.begin();
-   auto iter = first;
-   auto end = vElements.end();
-   auto last = end - 1;
-   for (; iter != end; iter++)
+   IndexType nElements = vElements.size();
+   IndexType first = 0;
+   IndexType last = nElements - 1;
+
+   auto evaluate = [&](IndexType idx)
    {
-      auto path_element(*iter);
+      const auto& path_element(vElements[idx]);
 
       WBFL::Geometry::Point2d prjPoint;
       Float64 dist_from_start_of_element;
@@ -302,29 +337,71 @@ std::tuple<WBFL::Geometry::Point2d, Float64, bool> Path::ProjectPoint(const WBFL
       }
       catch (...)
       {
+         return;
       }
 
-      bool bValidProjection = true;
       if (
-         (iter != first && iter != last && bOnProjection == true) // don't consider projections on internal elements
+         (idx != first && idx != last && bOnProjection == true) // don't consider projections on internal elements
          ||
-         (iter == first && bOnProjection == true && 0 < dist_from_start_of_element && 1 < nElements) // don't consider projections after the end of the first element if there are more than 1 elements
+         (idx == first && bOnProjection == true && 0 < dist_from_start_of_element && 1 < nElements) // don't consider projections after the end of the first element if there are more than 1 elements
          ||
-         (iter == last && bOnProjection == true && dist_from_start_of_element < 0 && 1 < nElements) // don't consider projects before the start of the last element if there are more than 1 elements
+         (idx == last && bOnProjection == true && dist_from_start_of_element < 0 && 1 < nElements) // don't consider projects before the start of the last element if there are more than 1 elements
          )
       {
-         bValidProjection = false;
+         return;
       }
 
-      if (bValidProjection)
+      // ties go to the element nearest the start of the path
+      Float64 dist_from_element_to_point = point.Distance(prjPoint);
+      if (dist_from_element_to_point < shortestDistance || (dist_from_element_to_point == shortestDistance && idx < shortestElementIdx))
       {
-         Float64 dist_from_element_to_point = point.Distance(prjPoint);
-         if (dist_from_element_to_point < shortestDistance)
+         shortestDistance = dist_from_element_to_point;
+         shortestElementIdx = idx;
+         the_point = prjPoint;
+         the_distance = path_element.start + dist_from_start_of_element;
+         the_projection = bOnProjection;
+      }
+   };
+
+   // The first and last elements can project onto the back and ahead tangents which are
+   // not bounded so they are always evaluated. This also establishes an initial
+   // shortest distance for pruning the search.
+   evaluate(first);
+   if (first != last) evaluate(last);
+
+   // Search the bounding box hierarchy, nearest box first. A projection onto an element
+   // can't be closer than the distance to the element's bounding box so once the nearest
+   // remaining box is farther away than the shortest distance found so far, the search is complete.
+   using Candidate = std::pair<Float64, IndexType>; // (distance to box, node index)
+   std::vector<Candidate> vCandidates;
+   auto compare = [](const auto& a, const auto& b) { return b.first < a.first; }; // min-heap
+   auto root = vNodes.size() - 1;
+   vCandidates.emplace_back(vNodes[root].Distance(point), root);
+   while (!vCandidates.empty())
+   {
+      std::pop_heap(vCandidates.begin(), vCandidates.end(), compare);
+      auto [box_distance, nodeIdx] = vCandidates.back();
+      vCandidates.pop_back();
+
+      if (shortestDistance < box_distance)
+         break;
+
+      const auto& node = vNodes[nodeIdx];
+      if (node.IsLeaf())
+      {
+         if (node.element != first && node.element != last)
+            evaluate(node.element);
+      }
+      else
+      {
+         for (auto childIdx : { node.leftChild, node.rightChild })
          {
-            shortestDistance = dist_from_element_to_point;
-            the_point = prjPoint;
-            the_distance = path_element.start + dist_from_start_of_element;
-            the_projection = bOnProjection;
+            auto child_distance = vNodes[childIdx].Distance(point);
+            if (child_distance <= shortestDistance)
+            {
+               vCandidates.emplace_back(child_distance, childIdx);
+               std::push_heap(vCandidates.begin(), vCandidates.end(), compare);
+            }
          }
       }
    }
@@ -492,6 +569,24 @@ std::pair<std::shared_ptr<const PathElement>,Float64> Path::FindElement(Float64
    return std::make_pair(element.element, element.start);
 }
 
+IndexType Path::MarchElement(Float64 distFromStart, IndexType cursor) const
+{
+   const auto& vElements = GetConnectedPathElements();
+   IndexType nElements = vElements.size();
+
+   if (nElements <= cursor || distFromStart < vElements[cursor].start)
+      cursor = 0; // the distance is behind the cursor, start over
+
+   // Same test as the binary search in FindElement. Move ahead until the element ends after distFromStart.
+   // Distances beyond the end of the path are on the last element.
+   while (cursor < nElements - 1 && IsLE(vElements[cursor].end, distFromStart))
+   {
+      cursor++;
+   }
+
+   return cursor;
+}
+
 const std::vector<Path::Element>& Path::GetConnectedPathElements() const
 {
    if (m_ConnectedPathElements.empty())
@@ -609,8 +704,79 @@ const std::vector<Path::Element>& Path::GetConnectedPathElements() const
    return m_ConnectedPathElements;
 }
 
+const std::vector<Path::BoundingNode>& Path::GetBoundingTree() const
+{
+   if (m_BoundingTree.empty())
+   {
+      const auto& vElements = GetConnectedPathElements();
+      m_BoundingTree.reserve(2 * vElements.size() - 1);
+      BuildBoundingTree(0, vElements.size() - 1);
+   }
+   return m_BoundingTree;
+}
+
+IndexType Path::BuildBoundingTree(IndexType first, IndexType last) const
+{
+   BoundingNode node;
+   if (first == last)
+   {
+      // Leaf node. The bounding box is built from points sampled along the element. Every point on the element
+      // is within half of the sample spacing, measured along the element, of a sample point so inflating
+      // the box by that amount makes it a conservative bound of the element.
+      const auto& element = m_ConnectedPathElements[first].element;
+      const auto& start_point = element->GetStartPoint();
+      node.left = start_point.X();
+      node.right = start_point.X();
+      node.bottom = start_point.Y();
+      node.top = start_point.Y();
+
+      bool bIsSegment = (std::dynamic_pointer_cast<PathSegment>(element) != nullptr);
+      IndexType nSamples = (bIsSegment ? 1 : 16);
+      Float64 step = element->GetLength() / nSamples;
+      for (IndexType i = 1; i <= nSamples; i++)
+      {
+         auto point = (i == nSamples ? element->GetEndPoint() : element->PointOnCurve(i * step));
+         node.left = Min(node.left, point.X());
+         node.right = Max(node.right, point.X());
+         node.bottom = Min(node.bottom, point.Y());
+         node.top = Max(node.top, point.Y());
+      }
+
+      Float64 inflate = (bIsSegment ? 0.0 : step / 2);
+      node.left -= inflate;
+      node.right += inflate;
+      node.bottom -= inflate;
+      node.top += inflate;
+
+      node.element = first;
+   }
+   else
+   {
+      auto mid = first + (last - first) / 2;
+      node.leftChild = BuildBoundingTree(first, mid);
+      node.rightChild = BuildBoundingTree(mid + 1, last);
+      const auto& left_node = m_BoundingTree[node.leftChild];
+      const auto& right_node = m_BoundingTree[node.rightChild];
+      node.left = Min(left_node.left, right_node.left);
+      node.right = Max(left_node.right, right_node.right);
+      node.bottom = Min(left_node.bottom, right_node.bottom);
+      node.top = Max(left_node.top, right_node.top);
+   }
+
+   m_BoundingTree.emplace_back(node);
+   return m_BoundingTree.size() - 1;
+}
+
+Float64 Path::BoundingNode::Distance(const WBFL::Geometry::Point2d& point) const
+{
+   Float64 dx = Max(left - point.X(), 0.0, point.X() - right);
+   Float64 dy = Max(bottom - point.Y(), 0.0, point.Y() - top);
+   return sqrt(dx * dx + dy * dy);
+}
+
 void Path::OnPathChanged()
 {
    // the path was changed so clear out the cached data
    m_ConnectedPathElements.clear();
+   m_BoundingTree.clear();
 }
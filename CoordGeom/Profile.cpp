@@ -155,6 +155,11 @@ Float64 Profile::Elevation(const Station& station) const
    return m_pImpl->Elevation(station);
 }
 
+void Profile::GradesAndElevations(std::span<const Station> vStations, std::span<Float64> vElevations, std::span<Float64> vGrades) const
+{
+   m_pImpl->GradesAndElevations(vStations, vElevations, vGrades);
+}
+
 Float64 Profile::Elevation(IDType surfaceID, const Station& station, Float64 offset) const
 {
    return m_pImpl->Elevation(surfaceID, station, offset);
@@ -165,6 +170,16 @@ Float64 Profile::Elevation(std::shared_ptr<const Surface> surface, const Station
    return m_pImpl->Elevation(surface, station, offset);
 }
 
+std::vector<Float64> Profile::ElevationGrid(IDType surfaceID, std::span<const Station> vStations, std::span<const Float64> vOffsets, bool bParallel) const
+{
+   return m_pImpl->ElevationGrid(surfaceID, vStations, vOffsets, bParallel);
+}
+
+std::vector<Float64> Profile::ElevationGrid(std::shared_ptr<const Surface> surface, std::span<const Station> vStations, std::span<const Float64> vOffsets, bool bParallel) const
+{
+   return m_pImpl->ElevationGrid(surface, vStations, vOffsets, bParallel);
+}
+
 Float64 Profile::Grade(const Station& station) const
 {
    return m_pImpl->Grade(station);
@@ -29,6 +29,7 @@
 #include <CoordGeom/ProfileSegment.h>
 #include <CoordGeom/ProfileElement.h>
 #include <CoordGeom/XCoordGeom.h>
+#include <System/TaskPool.h>
 
 using namespace WBFL::COGO;
 
@@ -164,6 +165,67 @@ Float64 ProfileImpl::Elevation(const Station& station) const
    return Elevation(nullptr, station, 0.0);
 }
 
+void ProfileImpl::GradesAndElevations(std::span<const Station> vStations, std::span<Float64> vElevations, std::span<Float64> vGrades) const
+{
+   PRECONDITION(vStations.size() == vElevations.size());
+   PRECONDITION(vGrades.empty() || vStations.size() == vGrades.size());
+
+   auto nStations = vStations.size();
+   bool bGrades = !vGrades.empty();
+
+   if (m_Elements.size() == 0)
+   {
+      std::fill(vElevations.begin(), vElevations.end(), 0.0);
+      std::fill(vGrades.begin(), vGrades.end(), 0.0);
+      return;
+   }
+
+   auto alignment = GetAlignment();
+   const auto& vElements = GetConnectedProfileElements();
+   IndexType nElements = vElements.size();
+
+   // Normalize the profile limits once for the batch
+   Float64 profile_start = alignment->ConvertToNormalizedStation(m_Elements.front()->GetStartPoint().GetStation()).GetValue();
+   Float64 profile_end = alignment->ConvertToNormalizedStation(m_Elements.back()->GetEndPoint().GetStation()).GetValue();
+
+   IndexType cursor = 0;
+   for (IndexType i = 0; i < nStations; i++)
+   {
+      // Profile elements are evaluated with normalized stations so they don't have to deal with station equations
+      Station station(alignment->ConvertToNormalizedStation(vStations[i]).GetValue());
+      Float64 ns = station.GetValue();
+
+      std::shared_ptr<const ProfileElement> element;
+      if (ns < profile_start)
+      {
+         // Station is before the first station defined for the alignment
+         element = m_Elements.front();
+      }
+      else if (profile_end < ns)
+      {
+         // Station is after the last station defined for the alignment
+         element = m_Elements.back();
+      }
+      else
+      {
+         // Station is somewhere in the middle of the alignment. March the cursor to the element containing
+         // the station using the same test as the binary search in FindElement
+         if (ns < vElements[cursor].start_station)
+            cursor = 0; // station is behind the cursor, start over
+
+         while (cursor < nElements - 1 && IsLE(vElements[cursor].end_station, ns))
+         {
+            cursor++;
+         }
+         element = vElements[cursor].element;
+      }
+
+      auto [grade, elevation] = element->ComputeGradeAndElevation(station);
+      vElevations[i] = elevation;
+      if (bGrades) vGrades[i] = grade;
+   }
+}
+
 Float64 ProfileImpl::Elevation(IDType surfaceID, const Station& station, Float64 offset) const
 {
    return Elevation(GetSurface(surfaceID), station, offset);
@@ -175,6 +237,66 @@ Float64 ProfileImpl::Elevation(std::shared_ptr<const Surface> surface, const Sta
    return elevation;
 }
 
+std::vector<Float64> ProfileImpl::ElevationGrid(IDType surfaceID, std::span<const Station> vStations, std::span<const Float64> vOffsets, bool bParallel) const
+{
+   return ElevationGrid(GetSurface(surfaceID), vStations, vOffsets, bParallel);
+}
+
+std::vector<Float64> ProfileImpl::ElevationGrid(std::shared_ptr<const Surface> surface, std::span<const Station> vStations, std::span<const Float64> vOffsets, bool bParallel) const
+{
+   auto nStations = vStations.size();
+   auto nOffsets = vOffsets.size();
+   std::vector<Float64> vElevations(nStations * nOffsets);
+   if (nStations == 0 || nOffsets == 0)
+      return vElevations;
+
+   // Profile elevations for all stations in one pass through the profile elements.
+   // This also brings the lazily computed profile data up to date before any concurrent evaluation
+   std::vector<Float64> vProfileElevations(nStations);
+   GradesAndElevations(vStations, vProfileElevations, {});
+
+   if (surface == nullptr)
+   {
+      for (IndexType i = 0; i < nStations; i++)
+      {
+         std::fill_n(vElevations.begin() + i * nOffsets, nOffsets, vProfileElevations[i]);
+      }
+      return vElevations;
+   }
+
+   auto alignmentPointIdx = surface->GetAlignmentPoint();
+
+   // Evaluates the stations in the range [firstStationIdx,lastStationIdx]. Each station writes to its own row of vElevations.
+   auto evaluate = [&](IndexType firstStationIdx, IndexType lastStationIdx)
+   {
+      for (IndexType i = firstStationIdx; i <= lastStationIdx; i++)
+      {
+         auto [surface_template, alignmentElev] = SectionCutAtAlignment(surface, vStations[i], vProfileElevations[i]);
+         auto* pElevations = &vElevations[i * nOffsets];
+         for (IndexType j = 0; j < nOffsets; j++)
+         {
+            pElevations[j] = alignmentElev + surface_template->GetElevationChange(alignmentPointIdx, vOffsets[j]);
+         }
+      }
+   };
+
+   if (bParallel)
+   {
+      // The surface lazily creates its ridge lines, and the ridge line paths lazily build their connected elements
+      // and bounding trees, on the first section cut. Every section cut intersects all of the ridge lines so
+      // evaluating the first station serially brings all of this data up to date before the remaining stations
+      // are evaluated concurrently.
+      evaluate(0, 0);
+      WBFL::System::TaskPool::ParallelFor(1, nStations, [&evaluate](IndexType beginStationIdx, IndexType endStationIdx) {evaluate(beginStationIdx, endStationIdx - 1); });
+   }
+   else
+   {
+      evaluate(0, nStations - 1);
+   }
+
+   return vElevations;
+}
+
 Float64 ProfileImpl::Grade(const Station& station) const
 {
    auto [grade, elevation, slope] = GradeAndElevation(nullptr, station, 0.0);
@@ -303,13 +425,26 @@ std::pair<Float64, Float64> ProfileImpl::AdjustForOffset(std::shared_ptr<const S
 
    if (surface == nullptr) return std::make_pair(adjElevation,slope);
 
+   auto [surface_template, alignmentElev] = SectionCutAtAlignment(surface, station, profileElevation);
+   auto alignmentPointIdx = surface->GetAlignmentPoint();
+
+   // Adjust elevation for offset from alignment
+   Float64 delta = surface_template->GetElevationChange(alignmentPointIdx, offset);
+   adjElevation = alignmentElev + delta;
+
+   // get the cross slope
+   slope = surface_template->GetSlope(alignmentPointIdx, offset);
+
+   return std::make_pair(adjElevation, slope);
+}
+
+std::pair<std::shared_ptr<const SurfaceTemplate>, Float64> ProfileImpl::SectionCutAtAlignment(std::shared_ptr<const Surface> surface, const Station& station, Float64 profileElevation) const
+{
    auto surface_template = GetProfile()->CreateSurfaceTemplateSectionCut(surface, station, false/*don't apply superelevation*/);
 
    auto alignmentPointIdx = surface->GetAlignmentPoint();
    auto profileGradePointIdx = surface->GetProfileGradePoint();
 
-   Float64 elevation = 0.0;
-
    auto superelevation = surface->FindSuperelevation(station);
    if (superelevation)
    {
@@ -329,12 +464,8 @@ std::pair<Float64, Float64> ProfileImpl::AdjustForOffset(std::shared_ptr<const S
 
       Float64 alignmentElev = pivotElevation + delta;
 
-      // adjust elevation for offset from alignment
-      delta = superelevated_surface_template->GetElevationChange(alignmentPointIdx, offset);
-      elevation = alignmentElev + delta;
-
-      // get the cross slope
-      slope = superelevated_surface_template->GetSlope(alignmentPointIdx, offset);
+      // offsets from the alignment are measured on the superelevated section
+      return std::make_pair(superelevated_surface_template, alignmentElev);
    }
    else
    {
@@ -342,17 +473,8 @@ std::pair<Float64, Float64> ProfileImpl::AdjustForOffset(std::shared_ptr<const S
       Float64 delta = surface_template->GetRidgePointElevationChange(profileGradePointIdx, alignmentPointIdx);
       Float64 alignmentElev = profileElevation + delta;
 
-      // Adjust elevation for offset from alignment
-      delta = surface_template->GetElevationChange(alignmentPointIdx, offset);
-      elevation = alignmentElev + delta;
-
-      // get the cross slope
-      slope = surface_template->GetSlope(alignmentPointIdx, offset);
+      return std::make_pair(surface_template, alignmentElev);
    }
-
-   adjElevation = elevation;
-
-   return std::make_pair(adjElevation, slope);
 }
 
 const std::vector<ProfileImpl::Element>& ProfileImpl::GetConnectedProfileElements() const
@@ -27,6 +27,7 @@
 #include <CoordGeom/Surface.h>
 #include <map>
 #include <memory>
+#include <span>
 
 namespace WBFL
 {
@@ -99,6 +100,12 @@ namespace WBFL
          /// @return 
          Float64 Elevation(const Station& station) const;
 
+         /// @brief Computes the profile elevation and grade at a sequence of stations
+         /// @param vStations Stations where the elevation is to be computed
+         /// @param vElevations Caller-owned array that receives the elevations
+         /// @param vGrades Caller-owned array that receives the grades. Can be empty
+         void GradesAndElevations(std::span<const Station> vStations, std::span<Float64> vElevations, std::span<Float64> vGrades) const;
+
          /// @brief Returns the surface elevation at the specified station and offset
          /// @param station Station where the elevation is to be computed
          /// @param surfaceID ID of surface from which the elevation is calculated
@@ -113,6 +120,15 @@ namespace WBFL
          /// @return 
          Float64 Elevation(std::shared_ptr<const Surface> surface, const Station& station, Float64 offset) const;
 
+         /// @brief Computes surface elevations on a grid of stations and offsets
+         /// @param surfaceID ID of surface from which the elevations are calculated
+         /// @param vStations Stations where the elevations are to be computed
+         /// @param vOffsets Offsets from the alignment
+         /// @param bParallel If true, stations are evaluated concurrently
+         /// @return Elevation matrix, in station major order
+         std::vector<Float64> ElevationGrid(IDType surfaceID, std::span<const Station> vStations, std::span<const Float64> vOffsets, bool bParallel) const;
+         std::vector<Float64> ElevationGrid(std::shared_ptr<const Surface> surface, std::span<const Station> vStations, std::span<const Float64> vOffsets, bool bParallel) const;
+
          /// @brief Returns the profile grade at the specified station
          /// @param station 
          /// @return 
@@ -180,6 +196,10 @@ namespace WBFL
 
          // Returns (AdjustedElevation,Slope)
          std::pair<Float64,Float64> AdjustForOffset(std::shared_ptr<const Surface> surface, const Station& station, Float64 offset, Float64 profileElevation) const;
+
+         // Returns (SurfaceTemplate,AlignmentElevation) where SurfaceTemplate is the section cut used to adjust
+         // elevations for offset from the alignment and AlignmentElevation is the surface elevation at the alignment
+         std::pair<std::shared_ptr<const SurfaceTemplate>, Float64> SectionCutAtAlignment(std::shared_ptr<const Surface> surface, const Station& station, Float64 profileElevation) const;
       };
    };
 };
@@ -30,6 +30,8 @@
 #include <GeomModel/GeomOp2d.h>
 #include <GeomModel/Circle2d.h>
 
+#include <complex>
+
 
 #define BACK_TANGENT    0x0001
 #define TRANSITION_CURVE  0x0002
@@ -38,6 +40,7 @@
 // References
 // 1) "Calculating coordinates along a clothoid between 2 curves", https://math.stackexchange.com/questions/1785816/calculating-coordinates-along-a-clothoid-betwen-2-curves
 // 2) "How to calculate the length of a clothoid segment?", https://math.stackexchange.com/questions/3287710/how-to-calculate-length-of-clothoid-segment
+// 3) Press, W.H., et. al., "Numerical Recipes", Section 6.8, Fresnel Integrals
 
 using namespace WBFL::COGO;
 
@@ -112,8 +115,7 @@ void TransitionCurve::Init(const WBFL::Geometry::Point2d& start, const Direction
    Float64 l2 = 2 * t2 * Max(m_Rs, m_Re);
    CHECK(IsEqual(l2, sqrt(2 * m_A * m_A * t2)));
 
-   Float64 x_ = (m_R1 < m_R2) ? SpiralX(l1, t1) : SpiralX(l2, t2);
-   Float64 y_ = (m_R1 < m_R2) ? SpiralY(l1, t1) : SpiralY(l2, t2);
+   auto [x_, y_] = (m_R1 < m_R2) ? SpiralXY(l1, t1) : SpiralXY(l2, t2);
    y_ *= m_Sign * m_SignY;
 
    // start of transition curve in global coordinates
@@ -223,12 +225,14 @@ Float64 TransitionCurve::GetRadius(Float64 distFromStart) const
 
 Float64 TransitionCurve::GetX() const
 {
-   return SpiralX(m_L, m_SpiralAngle);
+   auto [x, y] = SpiralXY(m_L, m_SpiralAngle);
+   return x;
 }
 
 Float64 TransitionCurve::GetY() const
 {
-   return SpiralY(m_L, m_SpiralAngle);
+   auto [x, y] = SpiralXY(m_L, m_SpiralAngle);
+   return y;
 }
 
 Float64 TransitionCurve::GetLongTangent() const
@@ -282,10 +286,10 @@ WBFL::Geometry::Point2d TransitionCurve::PointOnCurve(Float64 distFromStart) con
    else
    {
       auto s = DistanceFromStartOfSpiral(distFromStart);
-      auto sweepAngle = pow(s / m_Ls, 2) * m_SpiralAngle;
+      auto sweepAngle = SweepAngle(s);
 
-      Float64 x_ = SpiralX(s, sweepAngle);
-      Float64 y_ = m_Sign * m_SignY * SpiralY(s, sweepAngle);
+      auto [x_, y_] = SpiralXY(s, sweepAngle);
+      y_ *= m_Sign * m_SignY;
 
       pnt.Move(x_, y_);
 
@@ -386,7 +390,7 @@ Direction TransitionCurve::GetBearing(Float64 distFromStart) const
       return m_EndDirection;
 
    auto s = DistanceFromStartOfSpiral(distFromStart);
-   auto sweepAngle = pow(s / m_Ls, 2) * m_SpiralAngle;
+   auto sweepAngle = SweepAngle(s);
 
    if (m_R1 < m_R2)
    {
@@ -762,14 +766,79 @@ int TransitionCurve::ProjectionRegion(const WBFL::Geometry::Point2d& point) cons
    return result;
 }
 
-Float64 TransitionCurve::SpiralX(Float64 ls, Float64 angle) const
+std::pair<Float64,Float64> TransitionCurve::SpiralXY(Float64 ls, Float64 angle) const
 {
-   return ls * (1 - pow(angle, 2) / 10 + pow(angle, 4) / 216 - pow(angle, 6) / 9360);
+   // The spiral coordinates are Fresnel integrals
+   // X = ls * Integral(0,1) cos(angle*v^2) dv
+   // Y = ls * Integral(0,1) sin(angle*v^2) dv
+   // Both integrals are evaluated to full double precision for any angle.
+   Float64 theta = fabs(angle);
+   Float64 x = 0;
+   Float64 y = 0;
+   if (theta < 4.0)
+   {
+      // The power series converges quickly for small angles. This is the same series that
+      // was traditionally truncated after four terms (X = ls(1 - angle^2/10 + angle^4/216 - ...)).
+      // The k-th term is angle^k/(k!(2k+1)), alternating between X and Y with sign pattern ++--
+      Float64 p = 1.0; // angle^k/k!
+      for (int k = 0; k < 100; k++)
+      {
+         Float64 term = p / (2 * k + 1);
+         switch (k % 4)
+         {
+         case 0: x += term; break;
+         case 1: y += term; break;
+         case 2: x -= term; break;
+         case 3: y -= term; break;
+         }
+
+         if (theta < k && term < 1e-17)
+            break;
+
+         p *= theta / (k + 1);
+      }
+   }
+   else
+   {
+      // For larger angles, the power series suffers from cancellation. Use the continued fraction
+      // for the complementary error function, evaluated with the modified Lentz method (reference 3)
+      // C(z) + iS(z) = (1+i)/2 [1 - (1-i) z e^(i*angle) F] where z = sqrt(2*angle/PI) and F is the continued fraction
+      // X/ls = C(z)/z and Y/ls = S(z)/z
+      std::complex<Float64> b(1.0, -2 * theta);
+      std::complex<Float64> c(1.0 / Float64_Min, 0.0);
+      std::complex<Float64> d = 1.0 / b;
+      std::complex<Float64> F = d;
+      Float64 n = -1;
+      for (int k = 0; k < 200; k++)
+      {
+         n += 2;
+         Float64 a = -n * (n + 1);
+         b += 4.0;
+         d = 1.0 / (a * d + b);
+         c = b + a / c;
+         auto delta = c * d;
+         F *= delta;
+         if (std::abs(delta - 1.0) < 1e-16)
+            break;
+      }
+
+      Float64 z = sqrt(2 * theta / M_PI);
+      auto cs = std::complex<Float64>(0.5, 0.5) * (1.0 / z - std::polar(1.0, theta) * std::complex<Float64>(1.0, -1.0) * F);
+      x = cs.real();
+      y = cs.imag();
+   }
+
+   if (angle < 0)
+      y *= -1;
+
+   return std::make_pair(ls * x, ls * y);
 }
 
-Float64 TransitionCurve::SpiralY(Float64 ls, Float64 angle) const
+Float64 TransitionCurve::SweepAngle(Float64 s) const
 {
-   return ls * (angle / 3 - pow(angle, 3) / 42 + pow(angle, 5) / 1320 - pow(angle, 7) / 75600);
+   // angle between the tangent at the point of infinite radius and the tangent at s
+   Float64 ratio = s / m_Ls;
+   return ratio * ratio * m_SpiralAngle;
 }
 
 
@@ -792,9 +861,77 @@ Float64 TransitionCurve::DistanceFromStartOfSpiral(Float64 distance) const
 
 std::pair<Float64,WBFL::Geometry::Point2d> TransitionCurve::DoProjectPoint(const WBFL::Geometry::Point2d& point) const
 {
-   CSpiralFunction function(this, point);
-   WBFL::Math::BrentsRootFinder rootFinder;
-   Float64 dist = rootFinder.FindRootInRange(function, m_StartDist, m_Ls, 0.00001); // dist from end
+   // Work in the spiral coordinate system where s is the distance from the point of infinite radius.
+   // The projected point is where the vector from the curve to the point is normal to the curve,
+   // g(s) = (P(s) - Q).T(s) = 0, where T(s) is the unit tangent.
+   // The derivative is g'(s) = 1 - (P(s) - Q).N(s)k(s), where k(s) is the curvature, so
+   // Newton's method can be used. Bisection keeps the iterations inside the curve.
+   auto target = WBFL::Geometry::GeometricOperations::GlobalToLocal(m_SpiralOrigin, m_SpiralRotation, point);
+   Float64 sign = m_Sign * m_SignY;
+
+   auto g = [this, sign, &target](Float64 s, Float64& dg)
+   {
+      Float64 angle = SweepAngle(s);
+      auto [x, y] = SpiralXY(s, angle);
+      y *= sign;
+
+      Float64 cos_angle = cos(sign * angle);
+      Float64 sin_angle = sin(sign * angle);
+      Float64 dx = x - target.X();
+      Float64 dy = y - target.Y();
+      Float64 curvature = sign * 2 * s * m_SpiralAngle / (m_Ls * m_Ls); // rate of change of tangent angle
+
+      dg = 1 + (dy * cos_angle - dx * sin_angle) * curvature;
+      return dx * cos_angle + dy * sin_angle;
+   };
+
+   // s at the start and end of the curve
+   Float64 sLo = DistanceFromStartOfSpiral(0.0);
+   Float64 sHi = DistanceFromStartOfSpiral(m_L);
+   if (sHi < sLo) std::swap(sLo, sHi);
+
+   Float64 dg;
+   Float64 gLo = g(sLo, dg);
+   Float64 gHi = g(sHi, dg);
+
+   Float64 s;
+   if (0 < gLo * gHi)
+   {
+      // the point does not project onto the curve, use the nearest end
+      s = (fabs(gLo) < fabs(gHi) ? sLo : sHi);
+   }
+   else
+   {
+      const Float64 tolerance = 1.0e-9;
+      s = IsEqual(gLo, gHi) ? sLo : sLo - gLo * (sHi - sLo) / (gHi - gLo); // initial guess by linear interpolation
+      for (int i = 0; i < 100; i++)
+      {
+         Float64 gs = g(s, dg);
+         if (IsZero(gs, tolerance))
+            break;
+
+         // keep the root bracketed
+         if (0 < gs * gLo)
+            sLo = s;
+         else
+            sHi = s;
+
+         Float64 sNext = s - gs / dg;
+         if (dg <= 0 || sNext <= sLo || sHi <= sNext)
+         {
+            // Newton step leaves the bracket, bisect instead
+            sNext = 0.5 * (sLo + sHi);
+         }
+
+         bool bDone = IsZero(sNext - s, tolerance);
+         s = sNext;
+         if (bDone)
+            break;
+      }
+   }
+
+   // convert s into distance from the start of the curve
+   Float64 dist = (m_R1 < m_R2) ? m_Ls - s : s - m_StartDist;
    return std::make_pair(dist, PointOnCurve(dist));
 }
 
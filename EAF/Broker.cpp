@@ -92,9 +92,6 @@ HRESULT Integrate(bool bIntegrating, bool bIntegrateWithUI, bool bIntegrateWithR
    return S_OK;
 }
 
-bool Broker::InterfaceItem::operator<(const InterfaceItem& other) const { return iid < other.iid; }
-bool Broker::InterfaceItem::operator==(const InterfaceItem& other) const { return iid == other.iid ? true : false; }
-
 bool Broker::Key::operator<(const Key& key) const
 {
    if (first == key.first)
@@ -167,7 +164,7 @@ bool BrokerChecker::CheckFinal()
 
 
 Broker::Broker(std::shared_ptr<BrokerChecker> checker) : 
-   m_Checker(checker), m_MostFrequentlyUsed(10)
+   m_Checker(checker)
 {
 }
 
@@ -216,7 +213,6 @@ void Broker::ShutDown()
 #endif // _DEBUG
 
    m_Interfaces.clear();
-   m_MostFrequentlyUsed.clear();
 
    m_bAgentsInitialized = true;
 
@@ -309,8 +305,7 @@ bool Broker::RegisterInterface(const IID& iid, std::shared_ptr<Agent> agent)
    os << _T("Registering interface Agent: ") << agent->GetName() << _T(" IID: ") << EAFStringFromIID(iid);
    WBFL::System::Logger::Debug(os.str());
 
-   InterfaceItem item(iid, agent);
-   auto result = m_Interfaces.insert(item);
+   auto result = m_Interfaces.emplace(iid, InterfaceItem(agent));
    CHECK(result.second); // if this fires, the interface was already registered
    return result.second;
 }
@@ -809,36 +804,34 @@ std::_tstring Broker::TranslateCLSID(LPCTSTR strCLSID)
 void Broker::ListInterfaceUsage()
 {
    USES_CONVERSION;
+   // fill up a temporary vector so we can sort and report
+   std::vector<std::pair<IID, InterfaceItem>> interfaces(m_Interfaces.begin(), m_Interfaces.end());
+
    WATCHX(Broker, 0, _T("Most frequently used interfaces"));
-   for(auto& item : m_MostFrequentlyUsed)
+   std::sort(interfaces.begin(), interfaces.end(), [](const auto& a, const auto& b) {return b.second.usage_count < a.second.usage_count; });
+   IndexType nMostFrequentlyUsed = Min((IndexType)interfaces.size(), (IndexType)10);
+   for (IndexType i = 0; i < nMostFrequentlyUsed; i++)
    {
+      const auto& [iid, item] = interfaces[i];
       OLECHAR szGUID[39];
-      ::StringFromGUID2(item.iid, szGUID, 39);
-      WATCHX(Broker, 0, item.agent->GetName() << _T(": IID = ") << OLE2T(szGUID) << _T(" Usage Count = ") << (*item.usage_count));
-
+      ::StringFromGUID2(iid, szGUID, 39);
+      WATCHX(Broker, 0, item.agent->GetName() << _T(": IID = ") << OLE2T(szGUID) << _T(" Usage Count = ") << item.usage_count);
    }
 
    WATCHX(Broker, 0, _T(""));
    WATCHX(Broker, 0, _T("Total interface usage count"));
 
-   // fill up a temporary vector so we can sort and report by CLSID
-   std::vector<InterfaceItem> interfaces;
-   for(auto& item : m_Interfaces)
-   {
-      interfaces.push_back(item);
-   }
-
-   std::sort(interfaces.begin(), interfaces.end(), [](const auto& a, const auto& b) {return a.agent->GetCLSID() < b.agent->GetCLSID(); });
+   std::sort(interfaces.begin(), interfaces.end(), [](const auto& a, const auto& b) {return a.second.agent->GetCLSID() < b.second.agent->GetCLSID(); });
 
    IndexType count = 0;
-   for(auto& item : interfaces)
+   for(auto& [iid, item] : interfaces)
    {
       OLECHAR szGUID[39];
-      ::StringFromGUID2(item.iid, szGUID, 39);
+      ::StringFromGUID2(iid, szGUID, 39);
 
-      WATCHX(Broker, 0, item.agent->GetName() << _T(" IID = ") << OLE2T(szGUID) << _T(" Usage Count = ") << (*item.usage_count));
+      WATCHX(Broker, 0, item.agent->GetName() << _T(" IID = ") << OLE2T(szGUID) << _T(" Usage Count = ") << item.usage_count);
 
-      count += (*item.usage_count);
+      count += item.usage_count;
    }
    WATCHX(Broker, 0, _T("Total count = ") << count);
 }
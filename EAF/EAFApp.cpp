@@ -172,6 +172,7 @@ BOOL CEAFApp::InitInstance()
    if (m_LogFile.is_open() && !m_LogFile.bad())
    {
       WBFL::System::Logger::SetOutput(&m_LogFile);
+      WBFL::System::Logger::EnableAsync(true); // logging doesn't block the UI or analysis threads
    }
 
    // Log product and version number
@@ -393,6 +394,10 @@ int CEAFApp::ExitInstance()
 
    ::OleUninitialize();
 
+   // write any queued log messages and stop the logging thread before the log file is closed
+   WBFL::System::Logger::EnableAsync(false);
+   WBFL::System::Logger::SetOutput(nullptr);
+
    return result;
 
 }
@@ -5,6 +5,8 @@
 #include <EAF\Agent.h>
 #include <EAF\EventSinkManager.h>
 #include <AgentTools.h>
+#include <chrono>
+#include <utility>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace WBFL::EAF;
@@ -195,6 +197,47 @@ public:
 	}
 };
 
+// Interfaces for measuring interface lookup performance. The IIDs differ only by Data1
+template <int N>
+class BenchmarkInterface
+{
+public:
+	static constexpr IID iid = { 0x6a1f0000 + N, 0x1b2c, 0x4d3e, { 0x9f, 0x8a, 0x7b, 0x6c, 0x5d, 0x4e, 0x3f, 0x20 } };
+	virtual int Value() = 0;
+};
+
+// {0E3A8C51-4F7B-4B8E-9C2D-61A7E5F3B9D4}
+DEFINE_GUID(CLSID_BenchmarkAgent,
+	0xe3a8c51, 0x4f7b, 0x4b8e, 0x9c, 0x2d, 0x61, 0xa7, 0xe5, 0xf3, 0xb9, 0xd4);
+template <int... N>
+class BenchmarkAgent : public Agent, public BenchmarkInterface<N>...
+{
+public:
+	std::_tstring GetName() const override { return _T("BenchmarkAgent"); }
+
+	bool RegisterInterfaces() override
+	{
+		auto agent = std::dynamic_pointer_cast<Agent>(shared_from_this());
+		return (m_pBroker->RegisterInterface(BenchmarkInterface<N>::iid, agent) && ...);
+	}
+
+	CLSID GetCLSID() const override { return CLSID_BenchmarkAgent; }
+
+	int Value() override { return 1; }
+};
+
+template <int... N>
+std::shared_ptr<Agent> CreateBenchmarkAgent(std::integer_sequence<int, N...>)
+{
+	return std::make_shared<BenchmarkAgent<N...>>();
+}
+
+template <int... N>
+int GetBenchmarkInterfaces(Broker* broker, std::integer_sequence<int, N...>)
+{
+	return (broker->GetInterface<BenchmarkInterface<N>>(BenchmarkInterface<N>::iid)->Value() + ...);
+}
+
 TEST_CLASS(TestBroker)
 	{
 	public:
@@ -268,5 +311,35 @@ TEST_CLASS(TestBroker)
 			   Assert::IsTrue(ac.second->bDestroyed);
 			}
 		}
+
+		TEST_METHOD(GetInterfacePerformance)
+		{
+			// One million interface requests over an application sized set of interfaces
+			constexpr int nInterfaces = 100;
+			constexpr int nRepeat = 10000;
+			using Sequence = std::make_integer_sequence<int, nInterfaces>;
+
+			auto checker = std::make_shared<BrokerChecker>();
+			auto broker = std::make_shared<Broker>(checker);
+			auto agent = CreateBenchmarkAgent(Sequence{});
+			Assert::IsTrue(broker->AddAgent(agent).first);
+			Assert::IsTrue(broker->InitAgents());
+
+			auto start = std::chrono::steady_clock::now();
+			int count = 0;
+			for (int i = 0; i < nRepeat; i++)
+			{
+				count += GetBenchmarkInterfaces(broker.get(), Sequence{});
+			}
+			auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+			Assert::AreEqual(nInterfaces * nRepeat, count);
+
+			std::wostringstream os;
+			os << nInterfaces * nRepeat << L" interface requests: " << duration.count() << L" microseconds" << std::endl;
+			Logger::WriteMessage(os.str().c_str());
+
+			broker->ShutDown();
+		}
 	};
 }
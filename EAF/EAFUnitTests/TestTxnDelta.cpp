@@ -0,0 +1,54 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace EAFUnitTests
+{
+	TEST_CLASS(TestTxnDelta)
+	{
+	public:
+		
+		TEST_METHOD(Test)
+		{
+         std::string before(10000, 'a');
+         for (std::size_t i = 0; i < before.size(); i++) before[i] = (char)(i % 251);
+
+         // no change
+         WBFL::EAF::TxnDelta delta(before, before);
+         Assert::IsTrue(delta.IsEmpty());
+         Assert::IsTrue(before == delta.Undo(before));
+
+         // scattered changes that don't change the length
+         std::string after(before);
+         after[0] = 'x';
+         after[10] = 'x';
+         after[5000] = 'x';
+         after[5001] = 'x';
+         after[9999] = 'x';
+         delta.Capture(before, after);
+         Assert::IsFalse(delta.IsEmpty());
+         Assert::IsTrue(delta.GetMemoryFootprint() < 1000);
+         Assert::IsTrue(before == delta.Undo(after));
+         Assert::IsTrue(after == delta.Redo(before));
+
+         // change the length
+         after = before;
+         after.insert(4000, "inserted text");
+         after.erase(6000, 100);
+         delta.Capture(before, after);
+         Assert::IsTrue(before == delta.Undo(after));
+         Assert::IsTrue(after == delta.Redo(before));
+
+         after = before + "appended";
+         delta.Capture(before, after);
+         Assert::IsTrue(delta.GetMemoryFootprint() < 1000);
+         Assert::IsTrue(before == delta.Undo(after));
+         Assert::IsTrue(after == delta.Redo(before));
+
+         delta.Capture(std::string(), before);
+         Assert::IsTrue(delta.Undo(before).empty());
+         Assert::IsTrue(before == delta.Redo(std::string()));
+      }
+	};
+}
@@ -2,10 +2,96 @@
 #include "CppUnitTest.h"
 #include "TxnTestClass.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
 namespace EAFUnitTests
 {
+   // A large object, like a girder or library entry, that is edited by transactions
+   class testEditableObject
+   {
+   public:
+      testEditableObject() : m_Values(1000) {}
+      std::string GetState() const { return std::string((const char*)m_Values.data(), m_Values.size() * sizeof(Float64)); }
+      void SetState(const std::string& state) { memcpy(m_Values.data(), state.data(), state.size()); }
+      std::vector<Float64> m_Values;
+   };
+
+   // Keeps copies of the object before and after the edit
+   class testCopyEditTxn : public WBFL::EAF::Transaction
+   {
+   public:
+      testCopyEditTxn(testEditableObject* pObject, IndexType idx, Float64 value) : m_pObject(pObject), m_Index(idx), m_Value(value) {}
+      virtual bool Execute() override
+      {
+         if (!m_bExecuted) { m_Before = m_pObject->m_Values; m_pObject->m_Values[m_Index] = m_Value; m_After = m_pObject->m_Values; m_bExecuted = true; }
+         else m_pObject->m_Values = m_After;
+         return true;
+      }
+      virtual void Undo() override { m_pObject->m_Values = m_Before; }
+      virtual std::unique_ptr<WBFL::EAF::Transaction> CreateClone() const override { return std::make_unique<testCopyEditTxn>(m_pObject, m_Index, m_Value); }
+      virtual std::_tstring Name() const override { return _T("Copy Edit"); }
+      virtual bool IsUndoable() const override { return true; }
+      virtual std::size_t GetMemoryFootprint() const override { return sizeof(*this) + (m_Before.capacity() + m_After.capacity()) * sizeof(Float64); }
+
+   private:
+      testEditableObject* m_pObject;
+      IndexType m_Index;
+      Float64 m_Value;
+      bool m_bExecuted{ false };
+      std::vector<Float64> m_Before, m_After;
+   };
+
+   // Keeps only the difference between the object before and after the edit
+   class testDeltaEditTxn : public WBFL::EAF::Transaction
+   {
+   public:
+      testDeltaEditTxn(testEditableObject* pObject, IndexType idx, Float64 value) : m_pObject(pObject), m_Index(idx), m_Value(value) {}
+      virtual bool Execute() override
+      {
+         std::string before = m_pObject->GetState();
+         if (!m_bExecuted) { m_pObject->m_Values[m_Index] = m_Value; m_Delta.Capture(before, m_pObject->GetState()); m_bExecuted = true; }
+         else m_pObject->SetState(m_Delta.Redo(before));
+         return true;
+      }
+      virtual void Undo() override { m_pObject->SetState(m_Delta.Undo(m_pObject->GetState())); }
+      virtual std::unique_ptr<WBFL::EAF::Transaction> CreateClone() const override { return std::make_unique<testDeltaEditTxn>(m_pObject, m_Index, m_Value); }
+      virtual std::_tstring Name() const override { return _T("Delta Edit"); }
+      virtual bool IsUndoable() const override { return true; }
+      virtual std::size_t GetMemoryFootprint() const override { return sizeof(*this) + m_Delta.GetMemoryFootprint(); }
+
+   private:
+      testEditableObject* m_pObject;
+      IndexType m_Index;
+      Float64 m_Value;
+      bool m_bExecuted{ false };
+      WBFL::EAF::TxnDelta m_Delta;
+   };
+
+   // Executes a long editing session with occasional undo and redo and returns the largest size of the transaction history
+   template <class T>
+   std::size_t ReplayEditSession(testEditableObject& object, IndexType nEdits)
+   {
+      auto& txn_mgr = WBFL::EAF::TxnManager::GetInstance();
+      std::size_t max_size = 0;
+      for (IndexType i = 0; i < nEdits; i++)
+      {
+         txn_mgr.Execute(std::make_unique<T>(&object, (i * 7919) % object.m_Values.size(), (Float64)i));
+         if (i % 10 == 9)
+         {
+            txn_mgr.Undo();
+            txn_mgr.Undo();
+            txn_mgr.Redo();
+            txn_mgr.ClearUndoHistory();
+         }
+         if (i % 100 == 0) max_size = std::max(max_size, txn_mgr.GetHistorySize());
+      }
+      return max_size;
+   }
+
 	TEST_CLASS(TestTxnManager)
 	{
 	public:
@@ -170,5 +256,101 @@ namespace EAFUnitTests
          Assert::IsFalse(txn_mgr.IsRedoMode());
          Assert::IsTrue(txn_mgr.IsRepeatMode());
       }
+
+		TEST_METHOD(HistoryLimits)
+		{
+         testUndoableTxn txn;
+         auto& txn_mgr = WBFL::EAF::TxnManager::GetInstance();
+         txn_mgr.Clear();
+
+         // limit by count
+         txn_mgr.SetHistoryLimits(5, 0);
+         for (int i = 0; i < 10; i++) txn_mgr.Execute(txn);
+         Assert::AreEqual((IndexType)5, txn_mgr.GetTxnCount());
+         txn_mgr.Undo();
+         txn_mgr.Undo();
+         Assert::AreEqual((IndexType)3, txn_mgr.GetTxnCount());
+         Assert::AreEqual((IndexType)2, txn_mgr.GetUndoCount());
+
+         // undone transactions can't be redone after an execute so they are discarded before executed transactions
+         txn_mgr.Execute(txn);
+         Assert::AreEqual((IndexType)4, txn_mgr.GetTxnCount());
+         Assert::AreEqual((IndexType)1, txn_mgr.GetUndoCount());
+         txn_mgr.Execute(txn);
+         Assert::AreEqual((IndexType)5, txn_mgr.GetTxnCount());
+         Assert::AreEqual((IndexType)0, txn_mgr.GetUndoCount());
+         Assert::AreEqual(5 * txn.GetMemoryFootprint(), txn_mgr.GetHistorySize());
+
+         // limit by size. the most recent transaction is always kept
+         txn_mgr.SetHistoryLimits(INVALID_INDEX, 3 * txn.GetMemoryFootprint());
+         Assert::AreEqual((IndexType)3, txn_mgr.GetTxnCount());
+         Assert::AreEqual((IndexType)0, txn_mgr.GetUndoCount());
+
+         // in redo mode, executed transactions are discarded before undone transactions
+         txn_mgr.Undo();
+         Assert::IsTrue(txn_mgr.IsRedoMode());
+         txn_mgr.SetHistoryLimits(INVALID_INDEX, 2 * txn.GetMemoryFootprint());
+         Assert::AreEqual((IndexType)1, txn_mgr.GetTxnCount());
+         Assert::AreEqual((IndexType)1, txn_mgr.GetUndoCount());
+         Assert::IsTrue(txn_mgr.IsRedoMode());
+
+         txn_mgr.SetHistoryLimits(INVALID_INDEX, 1);
+         Assert::AreEqual((IndexType)1, txn_mgr.GetTxnCount());
+         Assert::AreEqual((IndexType)0, txn_mgr.GetUndoCount());
+         Assert::IsTrue(txn_mgr.IsRepeatMode());
+         Assert::IsTrue(txn_mgr.CanUndo());
+
+         IndexType maxCount;
+         std::size_t maxSize;
+         txn_mgr.GetHistoryLimits(&maxCount, &maxSize);
+         Assert::AreEqual((IndexType)INVALID_INDEX, maxCount);
+         Assert::AreEqual((std::size_t)1, maxSize);
+
+         txn_mgr.SetHistoryLimits(INVALID_INDEX, 0);
+         txn_mgr.Clear();
+      }
+
+		TEST_METHOD(EditSessionBenchmark)
+		{
+         // Replays a long editing session of a large object with transactions that keep
+         // complete copies of the object and with transactions that keep only the changes
+         const IndexType nEdits = 2000;
+         auto& txn_mgr = WBFL::EAF::TxnManager::GetInstance();
+         txn_mgr.Clear();
+
+         std::wostringstream os;
+         for (int bounded = 0; bounded < 2; bounded++)
+         {
+            if (bounded) txn_mgr.SetHistoryLimits(1000, 8 * 1024 * 1024);
+
+            testEditableObject copy_object;
+            auto start = std::chrono::steady_clock::now();
+            std::size_t copy_size = ReplayEditSession<testCopyEditTxn>(copy_object, nEdits);
+            auto copy_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+            txn_mgr.Clear();
+
+            testEditableObject delta_object;
+            start = std::chrono::steady_clock::now();
+            std::size_t delta_size = ReplayEditSession<testDeltaEditTxn>(delta_object, nEdits);
+            auto delta_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+            // the two editing sessions end with the same object
+            Assert::IsTrue(copy_object.m_Values == delta_object.m_Values);
+            Assert::IsTrue(delta_size < copy_size);
+            if (bounded) Assert::IsTrue(copy_size <= 8 * 1024 * 1024);
+
+            // undo everything that is left in the history
+            while (txn_mgr.CanUndo()) txn_mgr.Undo();
+            if (!bounded) Assert::IsTrue(std::all_of(delta_object.m_Values.begin(), delta_object.m_Values.end(), [](Float64 value) {return value == 0.0; }));
+            txn_mgr.Clear();
+
+            os << (bounded ? L"Bounded" : L"Unbounded") << L" history, " << nEdits << L" edits" << std::endl;
+            os << L"   Copies: " << copy_size / 1024 << L" KB, " << copy_duration.count() << L" ms" << std::endl;
+            os << L"   Deltas: " << delta_size / 1024 << L" KB, " << delta_duration.count() << L" ms" << std::endl;
+         }
+         Logger::WriteMessage(os.str().c_str());
+
+         txn_mgr.SetHistoryLimits(INVALID_INDEX, 0);
+      }
 	};
 }
@@ -159,6 +159,13 @@ bool MacroTxn::IsRepeatable() const
    return is_repeatable;
 }
 
+std::size_t MacroTxn::GetMemoryFootprint() const
+{
+   std::size_t size = sizeof(MacroTxn) + m_Name.capacity()*sizeof(TCHAR) + m_Transactions.capacity()*sizeof(TxnContainer::value_type);
+   std::for_each(std::begin(m_Transactions), std::end(m_Transactions), [&size](const auto& txn) {size += txn->GetMemoryFootprint(); });
+   return size;
+}
+
 IndexType MacroTxn::GetTxnCount() const
 {
    return m_Transactions.size();
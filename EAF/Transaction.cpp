@@ -51,3 +51,8 @@ bool Transaction::IsRepeatable() const
 {
    return false;
 }
+
+std::size_t Transaction::GetMemoryFootprint() const
+{
+   return sizeof(Transaction);
+}
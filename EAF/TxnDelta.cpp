@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////
+// EAF - Extensible Application Framework
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include <EAF\TxnDelta.h>
+#include <algorithm>
+
+using namespace WBFL::EAF;
+
+// Differences separated by fewer than this many equal bytes are kept in a single hunk
+// because each hunk has some overhead
+static constexpr std::size_t MinGap = 32;
+
+TxnDelta::TxnDelta(const std::string& before, const std::string& after)
+{
+   Capture(before, after);
+}
+
+void TxnDelta::Capture(const std::string& before, const std::string& after)
+{
+   m_Hunks.clear();
+   m_BeforeSize = before.size();
+   m_AfterSize = after.size();
+
+   // skip the bytes that are the same at the start and end of the states
+   std::size_t min_size = std::min(before.size(), after.size());
+   std::size_t prefix = 0;
+   while (prefix < min_size && before[prefix] == after[prefix]) prefix++;
+
+   if (prefix == before.size() && prefix == after.size())
+   {
+      return; // no change
+   }
+
+   std::size_t suffix = 0;
+   while (suffix < min_size - prefix && before[before.size() - suffix - 1] == after[after.size() - suffix - 1]) suffix++;
+
+   std::size_t before_end = before.size() - suffix;
+   std::size_t after_end = after.size() - suffix;
+
+   if (before_end - prefix != after_end - prefix)
+   {
+      // the length changed so the bytes that follow the change are not aligned. keep the entire changed range.
+      m_Hunks.push_back({ prefix, before.substr(prefix, before_end - prefix), after.substr(prefix, after_end - prefix) });
+   }
+   else
+   {
+      // the changed range has the same length in both states. this is common for binary
+      // data where numbers are replaced with other numbers. keep only the runs of bytes that are different.
+      std::size_t i = prefix;
+      while (i < before_end)
+      {
+         std::size_t start = i;
+         std::size_t end = i + 1;
+         std::size_t j = end;
+         while (j < before_end && j - end < MinGap)
+         {
+            if (before[j] != after[j])
+            {
+               end = j + 1;
+            }
+            j++;
+         }
+
+         m_Hunks.push_back({ start, before.substr(start, end - start), after.substr(start, end - start) });
+
+         // find the start of the next difference
+         i = end;
+         while (i < before_end && before[i] == after[i]) i++;
+      }
+   }
+}
+
+std::string TxnDelta::Undo(const std::string& after) const
+{
+   return Apply(m_Hunks, after, &Hunk::after, &Hunk::before, m_AfterSize, m_BeforeSize);
+}
+
+std::string TxnDelta::Redo(const std::string& before) const
+{
+   return Apply(m_Hunks, before, &Hunk::before, &Hunk::after, m_BeforeSize, m_AfterSize);
+}
+
+bool TxnDelta::IsEmpty() const
+{
+   return m_Hunks.empty();
+}
+
+std::size_t TxnDelta::GetMemoryFootprint() const
+{
+   std::size_t size = sizeof(TxnDelta) + m_Hunks.capacity()*sizeof(Hunk);
+   for (const auto& hunk : m_Hunks)
+   {
+      size += hunk.before.capacity() + hunk.after.capacity();
+   }
+   return size;
+}
+
+std::string TxnDelta::Apply(const std::vector<Hunk>& hunks, const std::string& source, std::string Hunk::*from, std::string Hunk::*to, std::size_t sourceSize, std::size_t resultSize)
+{
+   PRECONDITION(source.size() == sourceSize); // source isn't the state this change was captured from
+
+   std::string result;
+   result.reserve(resultSize);
+
+   std::size_t pos = 0;
+   for (const auto& hunk : hunks)
+   {
+      CHECK(source.compare(hunk.offset, (hunk.*from).size(), hunk.*from) == 0); // source isn't the state this change was captured from
+      result.append(source, pos, hunk.offset - pos);
+      result.append(hunk.*to);
+      pos = hunk.offset + (hunk.*from).size();
+   }
+   result.append(source, pos, std::string::npos);
+
+   CHECK(result.size() == resultSize);
+   return result;
+}
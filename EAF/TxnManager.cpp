@@ -41,6 +41,7 @@ void TxnManager::Execute(std::unique_ptr<Transaction>&& txn)
    {
       m_TxnHistory.emplace_back(std::move(txn));
       m_Mode = Mode::Repeat;
+      EnforceHistoryLimits();
    }
 }
 
@@ -81,6 +82,7 @@ void TxnManager::Redo()
    if (txn->Execute())
    {
       m_TxnHistory.emplace_back(std::move(txn));
+      EnforceHistoryLimits();
    }
 }
 
@@ -222,6 +224,71 @@ void TxnManager::Clear()
    m_Mode = Mode::Repeat;
 }
 
+void TxnManager::SetHistoryLimits(IndexType maxCount, std::size_t maxSize)
+{
+   m_MaxHistoryCount = maxCount;
+   m_MaxHistorySize = maxSize;
+   EnforceHistoryLimits();
+}
+
+void TxnManager::GetHistoryLimits(IndexType* pMaxCount, std::size_t* pMaxSize) const
+{
+   *pMaxCount = m_MaxHistoryCount;
+   *pMaxSize = m_MaxHistorySize;
+}
+
+std::size_t TxnManager::GetHistorySize() const
+{
+   std::size_t size = 0;
+   auto accumulate = [&size](const auto& txn) {size += txn->GetMemoryFootprint(); };
+   std::for_each(std::begin(m_TxnHistory), std::end(m_TxnHistory), accumulate);
+   std::for_each(std::begin(m_UndoHistory), std::end(m_UndoHistory), accumulate);
+   return size;
+}
+
+void TxnManager::EnforceHistoryLimits()
+{
+   // the size of the history is only computed when there is a size limit because
+   // it requires visiting every transaction
+   std::size_t size = (m_MaxHistorySize == 0 ? 0 : GetHistorySize());
+   auto is_over_limit = [this, &size]()
+      {
+         return (m_MaxHistoryCount != INVALID_INDEX && m_MaxHistoryCount < m_TxnHistory.size() + m_UndoHistory.size()) ||
+                (m_MaxHistorySize != 0 && m_MaxHistorySize < size);
+      };
+
+   // the oldest undone transaction is the last one that would be redone
+   auto trim_undo_history = [this, &size, &is_over_limit]()
+      {
+         while (!m_UndoHistory.empty() && is_over_limit())
+         {
+            if (m_MaxHistorySize != 0) size -= m_UndoHistory.front()->GetMemoryFootprint();
+            m_UndoHistory.pop_front();
+         }
+      };
+
+   // undone transactions can't be redone after a new transaction is executed so they are discarded
+   // before any transaction that can still be undone
+   if (m_Mode == Mode::Repeat)
+   {
+      trim_undo_history();
+   }
+
+   // discard the oldest executed transactions, but keep the most recent one so the last thing done can be undone
+   while (1 < m_TxnHistory.size() && is_over_limit())
+   {
+      if (m_MaxHistorySize != 0) size -= m_TxnHistory.front()->GetMemoryFootprint();
+      m_TxnHistory.pop_front();
+   }
+
+   trim_undo_history();
+
+   if (m_UndoHistory.empty() && m_Mode == Mode::Redo)
+   {
+      m_Mode = Mode::Repeat;
+   }
+}
+
 void TxnManager::SetTransactionManagerFactory(std::unique_ptr<TxnManagerFactory>&& pFactory)
 {
    ms_pFactory = std::move(pFactory);
@@ -26,10 +26,9 @@
 #include <GeomModel/Shape.h>
 #include <GeomModel/Primitives.h>
 #include <GeomModel/ShapeProperties.h>
-#include <System/Threads.h>
+#include <System/TaskPool.h>
 
 #include <vector>
-#include <future>
 
 using namespace WBFL::EngTools;
 
@@ -85,22 +84,7 @@ std::unique_ptr<UniformFDMesh> FDMeshGenerator::GenerateMesh(const WBFL::Geometr
 
    mesh->AllocateElementRows(Ny); // preallocate the rows so we can add them in any order
 
-   IndexType nWorkerThreads, nElementsPerThread;
-   WBFL::System::Threads::GetThreadParameters(Ny, nWorkerThreads, nElementsPerThread);
-   std::vector<std::future<void>> vFutures;
-   IndexType rowStart = 0;
-   for (IndexType t = 0; t < nWorkerThreads; t++)
-   {
-      IndexType rowEnd = rowStart + nElementsPerThread;
-      vFutures.emplace_back(std::async(&FDMeshGenerator::GenerateMeshRows, rowStart, rowEnd, Nx, Dx, Dy, tlx, tly, shape, std::ref(mesh)));
-      rowStart = rowEnd;
-   }
-   GenerateMeshRows(rowStart, Ny, Nx, Dx, Dy, tlx, tly, shape, mesh);
-
-   for (auto& f : vFutures)
-   {
-      f.get();
-   }
+   WBFL::System::TaskPool::ParallelFor(0, Ny, [&](IndexType rowStart, IndexType rowEnd) {GenerateMeshRows(rowStart, rowEnd, Nx, Dx, Dy, tlx, tly, shape, mesh); });
 
    return mesh;
 }
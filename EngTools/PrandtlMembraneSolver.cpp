@@ -25,9 +25,8 @@
 #include <EngTools/EngToolsLib.h>
 #include <EngTools/PrandtlMembraneSolver.h>        // class implementation
 #include <EngTools/UniformFDMesh.h>
-#include <future>
 #include <numeric>
-#include <System/Threads.h>
+#include <System/TaskPool.h>
 #include <GeomModel/Primitives3d.h>
 #include <GeomModel/Plane3d.h>
 #include <GeomModel/Vector2d.h>
@@ -85,33 +84,23 @@ PrandtlMembraneSolution PrandtlMembraneSolver::Solve(const WBFL::Geometry::Shape
 
    auto nElements = mesh->GetElementCount();
 
-   IndexType nWorkerThreads, nElementsPerThread;
-   WBFL::System::Threads::GetThreadParameters(nElements, nWorkerThreads, nElementsPerThread);
-
-   std::vector<std::future<std::tuple<Float64,Float64,IndexType>>> vFutures;
-   IndexType startElementIdx = 0;
-   for (IndexType i = 0; i < nWorkerThreads; i++)
-   {
-      IndexType endElementIdx = startElementIdx + nElementsPerThread - 1;
-      vFutures.emplace_back(std::async(&ComputeVolumeAndMaxSlope, startElementIdx, endElementIdx, std::ref(mesh), std::ref(meshValues)));
-      startElementIdx = endElementIdx + 1;
-   }
-
-   auto result = ComputeVolumeAndMaxSlope(startElementIdx, nElements - 1, mesh, meshValues);
-   for (auto& future : vFutures)
-   {
-      auto future_result = future.get();
-      std::get<0>(result) += std::get<0>(future_result); // Add J (similar to J += future.J
-
-      // compare maximum slope (stored in element 1 of the tuple)
-      if (std::get<1>(result) < std::get<1>(future_result))
+   using Result = std::tuple<Float64, Float64, IndexType>; // J, maximum slope, index of element with maximum slope
+   auto result = WBFL::System::TaskPool::ParallelReduce(0, nElements, Result{ 0,-Float64_Max,INVALID_INDEX },
+      [&mesh, &meshValues](IndexType begin, IndexType end) {return ComputeVolumeAndMaxSlope(begin, end - 1, mesh, meshValues); },
+      [](Result result, const Result& range_result)
       {
-         // future_result has a greater maximum slope... assign it to result
-         // and assign the corresponding element index
-         std::get<1>(result) = std::get<1>(future_result);
-         std::get<2>(result) = std::get<2>(future_result);
-      }
-   }
+         std::get<0>(result) += std::get<0>(range_result); // Add J (similar to J += range.J
+
+         // compare maximum slope (stored in element 1 of the tuple)
+         if (std::get<1>(result) < std::get<1>(range_result))
+         {
+            // range_result has a greater maximum slope... assign it to result
+            // and assign the corresponding element index
+            std::get<1>(result) = std::get<1>(range_result);
+            std::get<2>(result) = std::get<2>(range_result);
+         }
+         return result;
+      });
 
    if (mesh->HasSymmetry())
    {
@@ -132,23 +121,7 @@ void BuildMatrix(const std::unique_ptr<UniformFDMesh>& mesh, WBFL::Math::Unsymme
                                                // nElements + 1 - 2 = nElements - 1
    nElements--;
 
-   IndexType nWorkerThreads, nElementsPerThread;
-   WBFL::System::Threads::GetThreadParameters(nElements, nWorkerThreads, nElementsPerThread);
-
-   IndexType startMeshRowIdx = 0;
-   std::vector<std::future<void>> vFutures;
-   for (IndexType i = 0; i < nWorkerThreads; i++)
-   {
-      IndexType endMeshRowIdx = startMeshRowIdx + nElementsPerThread - 1;
-      vFutures.emplace_back(std::async(&BuildMatrixRow, startMeshRowIdx, endMeshRowIdx, std::ref(mesh), std::ref(matrix)));
-      startMeshRowIdx = endMeshRowIdx + 1;
-   }
-
-   BuildMatrixRow(startMeshRowIdx, nElements - 1, mesh, matrix);
-   for (auto& f : vFutures)
-   {
-      f.get();
-   }
+   WBFL::System::TaskPool::ParallelFor(0, nElements, [&mesh, &matrix](IndexType begin, IndexType end) {BuildMatrixRow(begin, end - 1, mesh, matrix); });
 }
 
 void BuildMatrixRow(IndexType startMeshRowIdx, IndexType endMeshRowIdx, const std::unique_ptr<UniformFDMesh>& mesh, WBFL::Math::UnsymmetricBandedMatrix& matrix)
@@ -32,6 +32,7 @@
 #include "POICollection.h"
 #include "stlTools.h"
 #include "MathEx.h"
+#include <System\Trace.h>
 
 #include <stdlib.h> 
 
@@ -1450,6 +1451,7 @@ void CModel::CheckModel()
 // Performs a stiffness analysis.
 void CModel::StiffnessAnalysis()
 {
+   WBFL_TRACE_FUNCTION();
    ClearAnalysis();
    InitModel();
 
@@ -1498,6 +1500,8 @@ void CModel::FemAnalysis()
 
 void CModel::ComputeLoadings()
 {
+   WBFL_TRACE_FUNCTION();
+   WBFL_TRACE_COUNTER("Fem2d loadings", m_DirtyLoadings.size());
    DirtyLoadingsIterator ldIter( m_DirtyLoadings.begin() );
    DirtyLoadingsIterator ldIterEnd( m_DirtyLoadings.end() );
    while(ldIter != ldIterEnd)
@@ -43,6 +43,7 @@
 #include "TestSectionCutTool.h"
 #include "TestStrandPattern.h"
 #include "TestPrecastGirder.h"
+#include "TestStrandGridModel.h"
 
 
 CComModule _Module;
@@ -58,6 +59,7 @@ int main(int argc, TCHAR* argv[])
    CTestSectionCutTool::Test();
    CTestStrandPattern::Test();
    CTestPrecastGirder::Test();
+   CTestStrandGridModel::Test();
 
    ::CoUninitialize();
 
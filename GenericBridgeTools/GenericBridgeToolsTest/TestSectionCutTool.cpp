@@ -49,6 +49,8 @@ void CTestSectionCutTool::Test()
 {
    TestPrecastGirderBridge();
    TestSplicedGirderBridge();
+   TestSectionCache();
+   TestDeckProperties();
 }
 
 void CTestSectionCutTool::TestPrecastGirderBridge()
@@ -600,3 +602,216 @@ void CTestSectionCutTool::TestSplicedGirderBridge()
    H = Yb + Yt;
    TRY_TEST(IsEqual(H,10.0),true);
 }
+
+void CTestSectionCutTool::TestSectionCache()
+{
+   CComPtr<ISectionCutTool> tool;
+   TRY_TEST(tool.CoCreateInstance(CLSID_SectionCutTool),S_OK);
+
+   std::vector<Float64> spanLengths{ 100, 200, 100 };
+
+   CComPtr<IShape> shape;
+   shape.CoCreateInstance(CLSID_FlangedGirderSection);
+   CComQIPtr<IFlangedGirderSection> fgs(shape);
+   DimensionWFG(fgs);
+
+   CComPtr<IGenericBridge> bridge;
+   CreatePrecastGirderBridge(0.0,spanLengths,10.0,5,shape,3.0,CIP_DECK,true,&bridge);
+
+   GirderIDType ssMbrID = ::GetGirderLineID(0,1);
+
+   VARIANT_BOOL bCache;
+   TRY_TEST(tool->get_CacheSections(&bCache),S_OK);
+   TRY_TEST(bCache,VARIANT_FALSE);
+
+   // sections are not shared when caching is disabled
+   IndexType beamIdx, slabIdx;
+   CComPtr<ISection> section1, section2;
+   TRY_TEST(tool->CreateGirderSectionBySSMbr(bridge,ssMbrID,25.0,sbLeft,cstBridge,3,spmGross,hdmHaunchIsZero,FALSE,&beamIdx,&slabIdx,&section1),S_OK);
+   TRY_TEST(tool->CreateGirderSectionBySSMbr(bridge,ssMbrID,25.0,sbLeft,cstBridge,3,spmGross,hdmHaunchIsZero,FALSE,&beamIdx,&slabIdx,&section2),S_OK);
+   TRY_TEST(section1.IsEqualObject(section2),false);
+
+   TRY_TEST(tool->put_CacheSections(VARIANT_TRUE),S_OK);
+
+   section1.Release();
+   section2.Release();
+   IndexType beamIdx2, slabIdx2;
+   TRY_TEST(tool->CreateGirderSectionBySSMbr(bridge,ssMbrID,25.0,sbLeft,cstBridge,3,spmGross,hdmHaunchIsZero,FALSE,&beamIdx,&slabIdx,&section1),S_OK);
+   TRY_TEST(tool->CreateGirderSectionBySSMbr(bridge,ssMbrID,25.0,sbLeft,cstBridge,3,spmGross,hdmHaunchIsZero,FALSE,&beamIdx2,&slabIdx2,&section2),S_OK);
+   TRY_TEST(section1.IsEqualObject(section2),true);
+   TRY_TEST(beamIdx,beamIdx2);
+   TRY_TEST(slabIdx,slabIdx2);
+
+   CComPtr<IElasticProperties> eprops;
+   section2->get_ElasticProperties(&eprops);
+   Float64 value;
+   eprops->get_EI11(&value);
+   TRY_TEST(IsEqual(value,25997381.589508355),true);
+
+   // a different stage is a different section
+   section2.Release();
+   TRY_TEST(tool->CreateGirderSectionBySSMbr(bridge,ssMbrID,25.0,sbLeft,cstBridge,1,spmGross,hdmHaunchIsZero,FALSE,&beamIdx,&slabIdx,&section2),S_OK);
+   TRY_TEST(section1.IsEqualObject(section2),false);
+
+   CComPtr<ISection> deck1, deck2;
+   TRY_TEST(SUCCEEDED(tool->CreateNetDeckSection(bridge,ssMbrID,0,25.0,sbLeft,cstBridge,3,hdmHaunchIsZero,FALSE,&deck1)),true);
+   TRY_TEST(SUCCEEDED(tool->CreateNetDeckSection(bridge,ssMbrID,0,25.0,sbLeft,cstBridge,3,hdmHaunchIsZero,FALSE,&deck2)),true);
+   TRY_TEST(deck1.IsEqualObject(deck2),true);
+
+   IndexType nHits, nMisses, nSections, nEvictions;
+   TRY_TEST(tool->GetSectionCacheStatistics(&nHits,&nMisses,&nSections,&nEvictions),S_OK);
+   TRY_TEST(nHits,2);
+   TRY_TEST(nMisses,3);
+   TRY_TEST(nSections,3);
+   TRY_TEST(nEvictions,0);
+
+   // the number of cached sections is limited. the least recently used sections are evicted
+   IndexType maxSections;
+   TRY_TEST(tool->get_MaxCachedSections(&maxSections),S_OK);
+   TRY_TEST(0 < maxSections,true);
+   TRY_TEST(tool->put_MaxCachedSections(0),E_INVALIDARG);
+
+   CComPtr<ISection> section3;
+   TRY_TEST(tool->CreateGirderSectionBySSMbr(bridge,ssMbrID,25.0,sbLeft,cstBridge,3,spmGross,hdmHaunchIsZero,FALSE,&beamIdx,&slabIdx,&section3),S_OK); // stage 3 girder section is most recently used
+   TRY_TEST(section1.IsEqualObject(section3),true);
+   TRY_TEST(tool->put_MaxCachedSections(2),S_OK); // evicts the stage 1 girder section
+   TRY_TEST(tool->GetSectionCacheStatistics(&nHits,&nMisses,&nSections,&nEvictions),S_OK);
+   TRY_TEST(nSections,2);
+   TRY_TEST(nEvictions,1);
+
+   section3.Release();
+   TRY_TEST(tool->CreateGirderSectionBySSMbr(bridge,ssMbrID,50.0,sbLeft,cstBridge,3,spmGross,hdmHaunchIsZero,FALSE,&beamIdx,&slabIdx,&section3),S_OK); // evicts the net deck section
+   TRY_TEST(tool->GetSectionCacheStatistics(&nHits,&nMisses,&nSections,&nEvictions),S_OK);
+   TRY_TEST(nSections,2);
+   TRY_TEST(nEvictions,2);
+
+   section3.Release();
+   TRY_TEST(tool->CreateGirderSectionBySSMbr(bridge,ssMbrID,25.0,sbLeft,cstBridge,3,spmGross,hdmHaunchIsZero,FALSE,&beamIdx,&slabIdx,&section3),S_OK);
+   TRY_TEST(section1.IsEqualObject(section3),true); // still cached
+   deck2.Release();
+   TRY_TEST(SUCCEEDED(tool->CreateNetDeckSection(bridge,ssMbrID,0,25.0,sbLeft,cstBridge,3,hdmHaunchIsZero,FALSE,&deck2)),true);
+   TRY_TEST(deck1.IsEqualObject(deck2),false); // was evicted so it is a new section
+   TRY_TEST(tool->GetSectionCacheStatistics(&nHits,&nMisses,&nSections,&nEvictions),S_OK);
+   TRY_TEST(nHits,4);
+   TRY_TEST(nMisses,5);
+   TRY_TEST(nSections,2);
+   TRY_TEST(nEvictions,3);
+   TRY_TEST(tool->put_MaxCachedSections(maxSections),S_OK);
+
+   // sections for a different bridge clear the cache
+   CComPtr<IGenericBridge> bridge2;
+   CreatePrecastGirderBridge(0.0,spanLengths,10.0,5,shape,3.0,NO_DECK,true,&bridge2);
+   section2.Release();
+   TRY_TEST(tool->CreateGirderSectionBySSMbr(bridge2,ssMbrID,25.0,sbLeft,cstBridge,3,spmGross,hdmHaunchIsZero,FALSE,&beamIdx,&slabIdx,&section2),S_OK);
+   TRY_TEST(section1.IsEqualObject(section2),false);
+   TRY_TEST(tool->GetSectionCacheStatistics(&nHits,&nMisses,&nSections,&nEvictions),S_OK);
+   TRY_TEST(nSections,1);
+
+   TRY_TEST(tool->ClearSectionCache(),S_OK);
+   TRY_TEST(tool->GetSectionCacheStatistics(&nHits,&nMisses,&nSections,&nEvictions),S_OK);
+   TRY_TEST(nSections,0);
+}
+
+void CTestSectionCutTool::TestDeckProperties()
+{
+   CComPtr<ISectionCutTool> tool;
+   TRY_TEST(tool.CoCreateInstance(CLSID_SectionCutTool),S_OK);
+
+   std::vector<Float64> spanLengths{ 100, 200, 100 };
+
+   CComPtr<IShape> shape;
+   shape.CoCreateInstance(CLSID_FlangedGirderSection);
+   CComQIPtr<IFlangedGirderSection> fgs(shape);
+   DimensionWFG(fgs);
+
+   CComPtr<IGenericBridge> bridge;
+   CreatePrecastGirderBridge(0.0,spanLengths,10.0,5,shape,3.0,CIP_DECK,true,&bridge);
+
+   Float64 S, V, SErr, VErr;
+   TRY_TEST(tool->GetDeckPropertiesAdaptive(nullptr,1e-6,&S,&V,&SErr,&VErr),E_INVALIDARG);
+   TRY_TEST(tool->GetDeckPropertiesAdaptive(bridge,1e-6,nullptr,&V,&SErr,&VErr),E_POINTER);
+   TRY_TEST(tool->GetDeckPropertiesAdaptive(bridge,0.0,&S,&V,&SErr,&VErr),E_INVALIDARG);
+
+   // the deck is prismatic so the adaptive integration matches the fixed spacing integration
+   Float64 Sref, Vref;
+   TRY_TEST(tool->GetDeckProperties(bridge,10,&Sref,&Vref),S_OK);
+   TRY_TEST(tool->GetDeckPropertiesAdaptive(bridge,1e-6,&S,&V,&SErr,&VErr),S_OK);
+   TRY_TEST(IsEqual(S,Sref,1e-6*Sref),true);
+   TRY_TEST(IsEqual(V,Vref,1e-6*Vref),true);
+   TRY_TEST(0 <= SErr && SErr <= 1e-6*S,true);
+   TRY_TEST(0 <= VErr && VErr <= 1e-6*V,true);
+
+   // the fixed spacing integration covers the full length of every span. for a prismatic deck the
+   // results are the bridge length times the perimeter and area of a section for any number of sections
+   CComPtr<IShape> deckShape;
+   TRY_TEST(tool->CreateSlabShape(bridge,50.0,nullptr,VARIANT_TRUE,&deckShape),S_OK);
+   Float64 perimeter, area;
+   deckShape->get_Perimeter(&perimeter);
+   CComPtr<IShapeProperties> shapeProps;
+   deckShape->get_ShapeProperties(&shapeProps);
+   shapeProps->get_Area(&area);
+
+   Float64 L = 400; // bridge length
+   TRY_TEST(IsEqual(Sref,L*perimeter,1e-6*Sref),true);
+   TRY_TEST(IsEqual(Vref,L*area,1e-6*Vref),true);
+
+   Float64 S1, V1;
+   TRY_TEST(tool->GetDeckProperties(bridge,1,&S1,&V1),S_OK);
+   TRY_TEST(IsEqual(S1,L*perimeter,1e-6*S1),true);
+   TRY_TEST(IsEqual(V1,L*area,1e-6*V1),true);
+
+   // the haunch varies along each span so the deck is not prismatic. the haunch depths are piecewise linear
+   // and change slope at the third points of the span, so the adaptive integration has to refine there.
+   // the haunch is zero at the piers where the girders of adjacent spans meet.
+   CComPtr<IGenericBridge> bridge3;
+   CreatePrecastGirderBridge(0.0,spanLengths,10.0,5,shape,3.0,CIP_DECK,true,&bridge3);
+   SpanIndexType nSpans = spanLengths.size();
+   for (SpanIndexType spanIdx = 0; spanIdx < nSpans; spanIdx++)
+   {
+      for (GirderIndexType gdrIdx = 0; gdrIdx < 5; gdrIdx++)
+      {
+         CComPtr<ISuperstructureMember> ssmbr;
+         bridge3->get_SuperstructureMember(::GetGirderLineID(spanIdx,gdrIdx),&ssmbr);
+
+         CComPtr<ISuperstructureMemberSegment> segment;
+         ssmbr->get_Segment(0,&segment);
+
+         Float64 layoutLength;
+         segment->get_LayoutLength(&layoutLength);
+
+         CComPtr<IDblArray> haunchDepths;
+         haunchDepths.CoCreateInstance(CLSID_DblArray);
+         haunchDepths->Add(0.0);
+         haunchDepths->Add(2.0/12);
+         haunchDepths->Add(1.0/12);
+         haunchDepths->Add(0.0);
+
+         CComPtr<ISimpleHaunchDepthFunction> haunchFunction;
+         haunchFunction.CoCreateInstance(CLSID_SimpleHaunchDepthFunction);
+         haunchFunction->Initialize(0.0,layoutLength,haunchDepths);
+         segment->SetHaunchDepthFunction(haunchFunction);
+      }
+   }
+
+   // the slope changes are at the section locations of the fixed spacing integration so it is very accurate
+   const Float64 tolerance = 1e-4;
+   Float64 S3ref, V3ref;
+   TRY_TEST(tool->GetDeckProperties(bridge3,300,&S3ref,&V3ref),S_OK);
+   TRY_TEST(Vref < V3ref,true); // the haunch adds volume
+
+   Float64 S3, V3, S3Err, V3Err;
+   TRY_TEST(tool->GetDeckPropertiesAdaptive(bridge3,tolerance,&S3,&V3,&S3Err,&V3Err),S_OK);
+   TRY_TEST(IsEqual(S3,S3ref,tolerance*S3ref),true);
+   TRY_TEST(IsEqual(V3,V3ref,tolerance*V3ref),true);
+   TRY_TEST(0 < S3Err && S3Err <= tolerance*S3,true);
+   TRY_TEST(0 < V3Err && V3Err <= tolerance*V3,true);
+
+   // no deck
+   CComPtr<IGenericBridge> bridge2;
+   CreatePrecastGirderBridge(0.0,spanLengths,10.0,5,shape,3.0,NO_DECK,true,&bridge2);
+   TRY_TEST(tool->GetDeckPropertiesAdaptive(bridge2,1e-6,&S,&V,&SErr,&VErr),S_OK);
+   TRY_TEST(IsZero(S),true);
+   TRY_TEST(IsZero(V),true);
+   TRY_TEST(IsZero(SErr),true);
+   TRY_TEST(IsZero(VErr),true);
+}
@@ -40,6 +40,8 @@ public:
 private:
    static void TestPrecastGirderBridge();
    static void TestSplicedGirderBridge();
+   static void TestSectionCache();
+   static void TestDeckProperties();
 };
 
 #endif // INCLUDED_TESTSECTIONCUTTOOL_H_
@@ -0,0 +1,191 @@
+///////////////////////////////////////////////////////////////////////
+// GenericBridgeToolsTest - Test driver for generic bridge tools library
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the Alternate Route Library Open Source License as 
+// published by the Washington State Department of Transportation,
+// Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful,
+// but is distributed AS IS, WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR 
+// PURPOSE.  See the Alternate Route Library Open Source License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License
+// along with this program; if not, write to the Washington State
+// Department of Transportation, Bridge and Structures Office,
+// P.O. Box 47340, Olympia, WA 98503, USA or e-mail
+// Bridge_Support@wsdot.wa.gov
+
+// TestStrandGridModel.cpp: implementation of the CTestStrandGridModel class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "TestStrandGridModel.h"
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+CTestStrandGridModel::CTestStrandGridModel()
+{
+
+}
+
+CTestStrandGridModel::~CTestStrandGridModel()
+{
+
+}
+
+void CTestStrandGridModel::Test()
+{
+   TestStrandsAtSections();
+}
+
+static void AddGridPoints(IStrandGrid* grid, const std::vector<std::pair<Float64, Float64>>& points)
+{
+   for (const auto& point : points)
+   {
+      CComPtr<IPoint2d> p;
+      p.CoCreateInstance(CLSID_Point2d);
+      p->Move(point.first, point.second);
+      grid->AddGridPoint(p);
+   }
+}
+
+void CTestStrandGridModel::TestStrandsAtSections()
+{
+   std::vector<Float64> spanLengths{ 100 };
+
+   CComPtr<IShape> shape;
+   shape.CoCreateInstance(CLSID_FlangedGirderSection);
+   CComQIPtr<IFlangedGirderSection> fgs(shape);
+   DimensionWFG(fgs);
+
+   CComPtr<IGenericBridge> bridge;
+   CreatePrecastGirderBridge(0.0,spanLengths,10.0,5,shape,3.0,NO_DECK,true,&bridge);
+
+   CComPtr<ISuperstructureMember> ssmbr;
+   bridge->get_SuperstructureMember(::GetGirderLineID(0,1),&ssmbr);
+   CComPtr<ISuperstructureMemberSegment> segment;
+   ssmbr->get_Segment(0,&segment);
+   CComQIPtr<IItemData> item_data(segment);
+   CComPtr<IUnknown> punk;
+   item_data->GetItemData(CComBSTR("Precast Girder"),&punk);
+   CComQIPtr<IPrecastGirder> girder(punk);
+   CComPtr<IStrandModel> model;
+   girder->get_StrandModel(&model);
+   CComQIPtr<IStrandGridModel> strandModel(model);
+   TRY_TEST(strandModel != nullptr,true);
+
+   // strand grids, in Girder Section Coordinates
+   for (auto endType : { etStart, etEnd })
+   {
+      CComPtr<IStrandGrid> straightGrid, harpedEndGrid, harpedHpGrid, tempGrid;
+      strandModel->get_StraightStrandGrid(endType,&straightGrid);
+      strandModel->get_HarpedStrandGridEnd(endType,&harpedEndGrid);
+      strandModel->get_HarpedStrandGridHP(endType,&harpedHpGrid);
+      strandModel->get_TemporaryStrandGrid(endType,&tempGrid);
+      AddGridPoints(straightGrid,{ {2,-70},{4,-70},{2,-68} });
+      AddGridPoints(harpedEndGrid,{ {0,-10},{0,-12} });
+      AddGridPoints(harpedHpGrid,{ {0,-68},{0,-66} });
+      AddGridPoints(tempGrid,{ {3,-5} });
+   }
+
+   CComPtr<IIndexArray> fill[3]; // array index is StrandType
+   for (auto strandType : { Straight, Harped, Temporary })
+   {
+      strandModel->GetMaxStrandFill(strandType,&fill[strandType]);
+      strandModel->putref_StrandFill(strandType,fill[strandType]);
+   }
+
+   strandModel->SetEndHarpingPoints(0.1,0.1);
+   strandModel->DebondStraightStrandByGridIndex(0,10.0,10.0);
+
+   Float64 Ls;
+   segment->get_Length(&Ls);
+
+   CComPtr<IDblArray> xs;
+   xs.CoCreateInstance(CLSID_DblArray);
+   const IndexType nSections = 41;
+   for (IndexType i = 0; i < nSections; i++)
+   {
+      xs->Add(i*Ls/(nSections-1));
+   }
+
+   StrandIndexType nStrands;
+   CComPtr<IDblArray> X, Y;
+   TRY_TEST(strandModel->GetStrandPositionsAtSections(Straight,nullptr,nullptr,&nStrands,&X,&Y),E_INVALIDARG);
+   TRY_TEST(strandModel->GetStrandPositionsAtSections(Straight,xs,nullptr,nullptr,&X,&Y),E_POINTER);
+   TRY_TEST(strandModel->GetStrandPositionsAtSections(Straight,xs,nullptr,&nStrands,nullptr,&Y),E_POINTER);
+
+   // the batch results are the same as evaluating one section at a time
+   for (auto strandType : { Straight, Harped, Temporary })
+   {
+      X.Release();
+      Y.Release();
+      TRY_TEST(strandModel->GetStrandPositionsAtSections(strandType,xs,nullptr,&nStrands,&X,&Y),S_OK);
+
+      StrandIndexType nExpected;
+      strandModel->GetStrandCount(strandType,&nExpected);
+      TRY_TEST(nStrands,nExpected);
+
+      IndexType count;
+      X->get_Count(&count);
+      TRY_TEST(count,nSections*nStrands);
+
+      CComPtr<IDblArray> cgX, cgY;
+      TRY_TEST(strandModel->GetStrandCGsAtSections(strandType,xs,fill[strandType],&cgX,&cgY),S_OK);
+
+      for (IndexType sectionIdx = 0; sectionIdx < nSections; sectionIdx++)
+      {
+         Float64 Xs;
+         xs->get_Item(sectionIdx,&Xs);
+
+         CComPtr<IPoint2dCollection> points;
+         strandModel->GetStrandPositionsEx(strandType,Xs,fill[strandType],&points);
+         for (StrandIndexType strandIdx = 0; strandIdx < nStrands; strandIdx++)
+         {
+            CComPtr<IPoint2d> point;
+            points->get_Item(strandIdx,&point);
+            Float64 x, y;
+            point->Location(&x,&y);
+
+            Float64 value;
+            X->get_Item(sectionIdx*nStrands + strandIdx,&value);
+            TRY_TEST(IsEqual(x,value),true);
+            Y->get_Item(sectionIdx*nStrands + strandIdx,&value);
+            TRY_TEST(IsEqual(y,value),true);
+         }
+
+         CComPtr<IPoint2d> cg;
+         strandModel->GetStrandCGEx(strandType,Xs,fill[strandType],&cg);
+         Float64 x, y, value;
+         cg->Location(&x,&y);
+         cgX->get_Item(sectionIdx,&value);
+         TRY_TEST(IsEqual(x,value),true);
+         cgY->get_Item(sectionIdx,&value);
+         TRY_TEST(IsEqual(y,value),true);
+      }
+   }
+
+   CComPtr<IDblArray> slopes;
+   TRY_TEST(strandModel->ComputeMaxHarpedStrandSlopesAtSections(xs,fill[Harped],0.0,1.0,1.0,0.0,&slopes),S_OK);
+   for (IndexType sectionIdx = 0; sectionIdx < nSections; sectionIdx++)
+   {
+      Float64 Xs;
+      xs->get_Item(sectionIdx,&Xs);
+
+      Float64 slope, value;
+      strandModel->ComputeMaxHarpedStrandSlopeEx(Xs,fill[Harped],0.0,1.0,1.0,0.0,&slope);
+      slopes->get_Item(sectionIdx,&value);
+      TRY_TEST(IsEqual(slope,value),true);
+   }
+}
@@ -32,6 +32,7 @@
 #include "Helpers.h"
 #include <WBFLGeometry.h>
 #include <MathEx.h>
+#include <System\Trace.h>
 #include <float.h> // for DBL_MAX
 
 #include <WBFLCogo\CogoHelpers.h>
@@ -175,6 +176,7 @@ HRESULT CSectionCutTool::FinalConstruct()
 
 void CSectionCutTool::FinalRelease()
 {
+   ClearSectionCache();
    m_EffFlangeTool.Release();
    m_BridgeGeometryTool.Release();
 }
@@ -898,93 +900,209 @@ STDMETHODIMP CSectionCutTool::GetDeckProperties(IGenericBridge* bridge,IndexType
       return E_INVALIDARG;
    }
 
-   CComPtr<IBridgeDeck> deck;
-   bridge->get_Deck(&deck);
-
-   // No deck, no surface area or volume
-   if ( deck == nullptr )
+   std::vector<Float64> vPierStations;
+   if (!GetDeckPierStations(bridge, &vPierStations))
    {
+      // No deck, no surface area or volume
       *pSurfaceArea = 0;
       *pVolume = 0;
       return S_OK;
    }
 
-   CComPtr<IAlignment> alignment;
-   bridge->get_Alignment(&alignment);
+   Float64 V = 0;
+   Float64 S = 0;
 
-   CComPtr<IPierCollection> piers;
-   bridge->get_Piers(&piers);
-   PierIndexType nPiers;
-   piers->get_Count(&nPiers);
+   DeckCut prevCut = GetDeckCut(bridge, vPierStations.front());
 
-   SpanIndexType nSpans = nPiers-1;
+   SpanIndexType nSpans = vPierStations.size() - 1;
+   for ( SpanIndexType spanIdx = 0; spanIdx < nSpans; spanIdx++ )
+   {
+      Float64 startStation = vPierStations[spanIdx];
+      Float64 endStation = vPierStations[spanIdx + 1];
+      Float64 increment = (endStation - startStation)/nSectionsPerSpan;
 
-   Float64 V = 0;
-   Float64 S = 0;
+      for ( IndexType i = 1; i <= nSectionsPerSpan; i++ )
+      {
+         Float64 station = (i == nSectionsPerSpan ? endStation : startStation + i*increment);
+         DeckCut cut = GetDeckCut(bridge, station);
+
+         S += increment*(prevCut.Perimeter + cut.Perimeter)/2;
+         V += increment*(prevCut.Area + cut.Area)/2;
 
-   CComPtr<IBridgePier> startPier;
-   piers->get_Item(0,&startPier);
-   CComPtr<IStation> objStartStation;
-   startPier->get_Station(&objStartStation);
-   Float64 startStation;
-   alignment->ConvertToNormalizedStation(CComVariant(objStartStation), &startStation);
+         // The end for this loop is the previous values in the next loop
+         prevCut = cut;
+      } // next section
+   } // next span
 
-   Float64 station = startStation;
-   CComPtr<IShape> prevDeckShape;
-   CreateSlabShape(bridge,startStation,nullptr,VARIANT_TRUE/*include haunch*/,&prevDeckShape);
+   *pSurfaceArea = S;
+   *pVolume = V;
 
-   Float64 prevPerimeter;
-   prevDeckShape->get_Perimeter(&prevPerimeter);
+   return S_OK;
+}
 
-   CComPtr<IShapeProperties> shapeProps;
-   prevDeckShape->get_ShapeProperties(&shapeProps);
-   Float64 prevArea;
-   shapeProps->get_Area(&prevArea);
+STDMETHODIMP CSectionCutTool::GetDeckPropertiesAdaptive(IGenericBridge* bridge,Float64 tolerance,Float64* pSurfaceArea,Float64* pVolume,Float64* pSurfaceAreaError,Float64* pVolumeError)
+{
+   CHECK_IN(bridge);
+   CHECK_RETVAL(pSurfaceArea);
+   CHECK_RETVAL(pVolume);
+   CHECK_RETVAL(pSurfaceAreaError);
+   CHECK_RETVAL(pVolumeError);
 
-   for ( SpanIndexType spanIdx = 0; spanIdx < nSpans; spanIdx++ )
+   if (tolerance <= 0)
    {
-      PierIndexType endPierIdx = (spanIdx+1);
-      CComPtr<IBridgePier> endPier;
-      piers->get_Item(endPierIdx,&endPier);
-      CComPtr<IStation> objEndStation;
-      endPier->get_Station(&objEndStation);
-      Float64 endStation;
-      alignment->ConvertToNormalizedStation(CComVariant(objEndStation), &endStation);
+      return E_INVALIDARG;
+   }
 
-      Float64 increment = (endStation - startStation)/nSectionsPerSpan;
+   *pSurfaceArea = 0;
+   *pVolume = 0;
+   *pSurfaceAreaError = 0;
+   *pVolumeError = 0;
 
-      for ( IndexType i = 1; i < nSectionsPerSpan; i++ )
+   std::vector<Float64> vPierStations;
+   if (!GetDeckPierStations(bridge, &vPierStations))
+   {
+      // No deck, no surface area or volume
+      return S_OK;
+   }
+
+   // The spans are independent integrations, however the bridge model isn't thread safe
+   // (the COM objects are apartment threaded and cache geometry as it is computed) so
+   // the spans are evaluated one after the other. The cuts at the piers are shared by
+   // adjacent spans.
+   DeckCut startCut = GetDeckCut(bridge, vPierStations.front());
+   SpanIndexType nSpans = vPierStations.size() - 1;
+   for (SpanIndexType spanIdx = 0; spanIdx < nSpans; spanIdx++)
+   {
+      Float64 startStation = vPierStations[spanIdx];
+      Float64 endStation = vPierStations[spanIdx + 1];
+      DeckCut endCut = GetDeckCut(bridge, endStation);
+
+      // Start with a few panels so that localized changes in the deck are less likely to be missed
+      const IndexType nPanels = 4;
+      std::array<DeckCut, 2*nPanels + 1> cuts;
+      cuts.front() = startCut;
+      cuts.back() = endCut;
+      Float64 h = (endStation - startStation) / (2*nPanels);
+      for (IndexType i = 1; i < 2*nPanels; i++)
       {
-         station += increment;
+         cuts[i] = GetDeckCut(bridge, startStation + i*h);
+      }
 
-         CComPtr<IShape> deckShape;
-         CreateSlabShape(bridge,station,nullptr,VARIANT_TRUE/*include haunch*/,&deckShape);
+      // The tolerance is relative to the magnitude of the span's properties. Estimate it
+      // with Simpson's rule over the initial panels.
+      DeckCut estimate{ 0,0 };
+      for (IndexType i = 0; i < nPanels; i++)
+      {
+         estimate.Perimeter += h*(cuts[2*i].Perimeter + 4*cuts[2*i+1].Perimeter + cuts[2*i+2].Perimeter)/3;
+         estimate.Area += h*(cuts[2*i].Area + 4*cuts[2*i+1].Area + cuts[2*i+2].Area)/3;
+      }
+      DeckCut tol{ tolerance*fabs(estimate.Perimeter)/nPanels, tolerance*fabs(estimate.Area)/nPanels };
 
-         Float64 perimeter;
-         deckShape->get_Perimeter(&perimeter);
-         Float64 dS = increment*(prevPerimeter + perimeter)/2;
-         S += dS;
+      for (IndexType i = 0; i < nPanels; i++)
+      {
+         Float64 a = startStation + 2*i*h;
+         Float64 b = a + 2*h;
+         DeckCut whole{ h*(cuts[2*i].Perimeter + 4*cuts[2*i+1].Perimeter + cuts[2*i+2].Perimeter)/3, h*(cuts[2*i].Area + 4*cuts[2*i+1].Area + cuts[2*i+2].Area)/3 };
+         DeckCut result{ 0,0 }, error{ 0,0 };
+         IntegrateDeck(bridge, a, b, cuts[2*i], cuts[2*i+1], cuts[2*i+2], whole, tol, 0, &result, &error);
+         *pSurfaceArea += result.Perimeter;
+         *pVolume += result.Area;
+         *pSurfaceAreaError += error.Perimeter;
+         *pVolumeError += error.Area;
+      }
 
-         shapeProps.Release();
-         deckShape->get_ShapeProperties(&shapeProps);
+      startCut = endCut;
+   }
 
-         Float64 area;
-         shapeProps->get_Area(&area);
-         Float64 dV = increment*(prevArea + area)/2;
-         V += dV;
+   return S_OK;
+}
 
-         // The end for this loop is the previous values in the next loop
-         prevPerimeter = perimeter;
-         prevArea = area;
-      } // next section
+bool CSectionCutTool::GetDeckPierStations(IGenericBridge* bridge, std::vector<Float64>* pvStations)
+{
+   CComPtr<IBridgeDeck> deck;
+   bridge->get_Deck(&deck);
+   if (deck == nullptr)
+   {
+      return false;
+   }
 
-      startStation = endStation;
-   } // next span
+   CComPtr<IAlignment> alignment;
+   bridge->get_Alignment(&alignment);
 
-   *pSurfaceArea = S;
-   *pVolume = V;
+   CComPtr<IPierCollection> piers;
+   bridge->get_Piers(&piers);
+   PierIndexType nPiers;
+   piers->get_Count(&nPiers);
 
-   return S_OK;
+   pvStations->clear();
+   pvStations->reserve(nPiers);
+   for (PierIndexType pierIdx = 0; pierIdx < nPiers; pierIdx++)
+   {
+      CComPtr<IBridgePier> pier;
+      piers->get_Item(pierIdx, &pier);
+      CComPtr<IStation> objStation;
+      pier->get_Station(&objStation);
+      Float64 station;
+      alignment->ConvertToNormalizedStation(CComVariant(objStation), &station);
+      pvStations->push_back(station);
+   }
+
+   return true;
+}
+
+CSectionCutTool::DeckCut CSectionCutTool::GetDeckCut(IGenericBridge* bridge, Float64 station)
+{
+   CComPtr<IShape> deckShape;
+   CreateSlabShape(bridge,station,nullptr,VARIANT_TRUE/*include haunch*/,&deckShape);
+
+   DeckCut cut;
+   deckShape->get_Perimeter(&cut.Perimeter);
+
+   CComPtr<IShapeProperties> shapeProps;
+   deckShape->get_ShapeProperties(&shapeProps);
+   shapeProps->get_Area(&cut.Area);
+
+   return cut;
+}
+
+void CSectionCutTool::IntegrateDeck(IGenericBridge* bridge, Float64 a, Float64 b, const DeckCut& fa, const DeckCut& fm, const DeckCut& fb, const DeckCut& whole, const DeckCut& tol, IndexType depth, DeckCut* pResult, DeckCut* pError)
+{
+   // Adaptive Simpson's rule. The interval is split in half and the sum of Simpson's rule for the
+   // two halves is compared to Simpson's rule for the whole interval. If the difference is too
+   // large for either the perimeter or area, each half is refined independently.
+   Float64 m = (a + b)/2;
+   Float64 h = (b - a)/4;
+   DeckCut flm = GetDeckCut(bridge, (a + m)/2);
+   DeckCut frm = GetDeckCut(bridge, (m + b)/2);
+
+   DeckCut left{ h*(fa.Perimeter + 4*flm.Perimeter + fm.Perimeter)/3, h*(fa.Area + 4*flm.Area + fm.Area)/3 };
+   DeckCut right{ h*(fm.Perimeter + 4*frm.Perimeter + fb.Perimeter)/3, h*(fm.Area + 4*frm.Area + fb.Area)/3 };
+   DeckCut diff{ left.Perimeter + right.Perimeter - whole.Perimeter, left.Area + right.Area - whole.Area };
+
+   const IndexType maxDepth = 10; // limits the number of cuts where the deck geometry is discontinuous
+   if (fabs(diff.Perimeter) <= 15*tol.Perimeter && fabs(diff.Area) <= 15*tol.Area)
+   {
+      // accept with Richardson extrapolation. diff/15 is the error estimate of the refined result
+      pResult->Perimeter += left.Perimeter + right.Perimeter + diff.Perimeter/15;
+      pResult->Area += left.Area + right.Area + diff.Area/15;
+      pError->Perimeter += fabs(diff.Perimeter)/15;
+      pError->Area += fabs(diff.Area)/15;
+   }
+   else if (maxDepth <= depth)
+   {
+      // the geometry isn't smooth enough to converge, such as at an abrupt change in the deck.
+      // extrapolation isn't valid here so the error estimate is the full difference.
+      pResult->Perimeter += left.Perimeter + right.Perimeter;
+      pResult->Area += left.Area + right.Area;
+      pError->Perimeter += fabs(diff.Perimeter);
+      pError->Area += fabs(diff.Area);
+   }
+   else
+   {
+      DeckCut halfTol{ tol.Perimeter/2, tol.Area/2 };
+      IntegrateDeck(bridge, a, m, fa, flm, fm, left, halfTol, depth + 1, pResult, pError);
+      IntegrateDeck(bridge, m, b, fm, frm, fb, right, halfTol, depth + 1, pResult, pError);
+   }
 }
 
 STDMETHODIMP CSectionCutTool::GetStructuralHaunchDepth(IGenericBridge * bridge, GirderIDType ssMbrID, SegmentIndexType segIdx, Float64 Xs, HaunchDepthMethod haunchMethod, Float64 * pHaunchDepth)
@@ -1006,6 +1124,7 @@ STDMETHODIMP CSectionCutTool::putref_EffectiveFlangeWidthTool(IEffectiveFlangeWi
 {
    CHECK_IN(pTool);
    m_EffFlangeTool = pTool;
+   ClearSectionCache(); // cached sections were created with the old tool
    return S_OK;
 }
 
@@ -1017,9 +1136,128 @@ STDMETHODIMP CSectionCutTool::get_EffectiveFlangeWidthTool(IEffectiveFlangeWidth
    return S_OK;
 }
 
+STDMETHODIMP CSectionCutTool::put_CacheSections(VARIANT_BOOL bCache)
+{
+   m_bCacheSections = (bCache == VARIANT_TRUE);
+   if (!m_bCacheSections)
+   {
+      ClearSectionCache();
+   }
+   return S_OK;
+}
+
+STDMETHODIMP CSectionCutTool::get_CacheSections(VARIANT_BOOL* pbCache)
+{
+   CHECK_RETVAL(pbCache);
+   *pbCache = (m_bCacheSections ? VARIANT_TRUE : VARIANT_FALSE);
+   return S_OK;
+}
+
+STDMETHODIMP CSectionCutTool::ClearSectionCache()
+{
+   m_SectionCache.clear();
+   m_SectionCacheLRU.clear();
+   m_CachedBridge.Release();
+   return S_OK;
+}
+
+STDMETHODIMP CSectionCutTool::GetSectionCacheStatistics(IndexType* pnHits, IndexType* pnMisses, IndexType* pnSections, IndexType* pnEvictions)
+{
+   CHECK_RETVAL(pnHits);
+   CHECK_RETVAL(pnMisses);
+   CHECK_RETVAL(pnSections);
+   CHECK_RETVAL(pnEvictions);
+   *pnHits = m_nCacheHits;
+   *pnMisses = m_nCacheMisses;
+   *pnSections = m_SectionCache.size();
+   *pnEvictions = m_nCacheEvictions;
+   return S_OK;
+}
+
+STDMETHODIMP CSectionCutTool::put_MaxCachedSections(IndexType nSections)
+{
+   if (nSections < 1)
+   {
+      return E_INVALIDARG;
+   }
+
+   m_MaxCachedSections = nSections;
+   TrimSectionCache(m_MaxCachedSections);
+   return S_OK;
+}
+
+STDMETHODIMP CSectionCutTool::get_MaxCachedSections(IndexType* pnSections)
+{
+   CHECK_RETVAL(pnSections);
+   *pnSections = m_MaxCachedSections;
+   return S_OK;
+}
+
+void CSectionCutTool::TrimSectionCache(IndexType nSections)
+{
+   while (nSections < m_SectionCache.size())
+   {
+      m_SectionCache.erase(m_SectionCacheLRU.back());
+      m_SectionCacheLRU.pop_back();
+      m_nCacheEvictions++;
+   }
+}
+
+HRESULT CSectionCutTool::GetCachedSection(IGenericBridge* bridge, const SectionKey& key, IndexType* pBeamIdx, IndexType* pSlabIdx, ISection** section)
+{
+   if (m_CachedBridge != bridge)
+   {
+      // the cached sections belong to a different bridge
+      ClearSectionCache();
+      m_CachedBridge = bridge;
+   }
+
+   auto found = m_SectionCache.find(key);
+   if (found == m_SectionCache.end())
+   {
+      m_nCacheMisses++;
+
+      SectionCacheEntry entry{ S_OK, 0, INVALID_INDEX };
+      if (key.type == SectionKey::Type::Girder)
+      {
+         entry.hr = CreateCompositeSection(bridge, key.ssMbrID, key.segIdx, key.Xs, key.sectionBias, key.coordinateSystem, key.stageIdx, key.sectionPropMethod, key.haunchMethod, key.bFollowMatingSurfaceProfile, &entry.beamIdx, &entry.slabIdx, &entry.section);
+      }
+      else
+      {
+         entry.hr = CreateNetDeckSectionImpl(bridge, key.ssMbrID, key.segIdx, key.Xs, key.sectionBias, key.coordinateSystem, key.stageIdx, key.haunchMethod, key.bFollowMatingSurfaceProfile, &entry.section);
+      }
+
+      if (FAILED(entry.hr))
+      {
+         return entry.hr; // failures aren't cached
+      }
+
+      // make room for the new section
+      TrimSectionCache(m_MaxCachedSections - 1);
+
+      m_SectionCacheLRU.push_front(key);
+      entry.lruIter = m_SectionCacheLRU.begin();
+      found = m_SectionCache.emplace(key, entry).first;
+   }
+   else
+   {
+      m_nCacheHits++;
+
+      // this is now the most recently used section
+      m_SectionCacheLRU.splice(m_SectionCacheLRU.begin(), m_SectionCacheLRU, found->second.lruIter);
+   }
+
+   const auto& entry = found->second;
+   if (pBeamIdx) *pBeamIdx = entry.beamIdx;
+   if (pSlabIdx) *pSlabIdx = entry.slabIdx;
+   entry.section.CopyTo(section);
+   return entry.hr;
+}
+
 STDMETHODIMP CSectionCutTool::CreateGirderSectionBySSMbr(IGenericBridge* bridge,GirderIDType ssMbrID,Float64 Xg,SectionBias sectionBias, SectionCoordinateSystemType coordinateSystem,StageIndexType stageIdx,
                                           SectionPropertyMethod sectionPropMethod, HaunchDepthMethod haunchMethod, BOOL bFollowMatingSurfaceProfile, IndexType* pBeamIdx, IndexType* pSlabIdx,ISection** section)
 {
+   WBFL_TRACE_FUNCTION();
    CComPtr<ISuperstructureMember> ssMbr;
    bridge->get_SuperstructureMember(ssMbrID,&ssMbr);
 
@@ -1034,18 +1272,37 @@ STDMETHODIMP CSectionCutTool::CreateGirderSectionBySSMbr(IGenericBridge* bridge,
 STDMETHODIMP CSectionCutTool::CreateGirderSectionBySegment(IGenericBridge* bridge,GirderIDType ssMbrID,SegmentIndexType segIdx,Float64 Xs,SectionBias sectionBias, SectionCoordinateSystemType coordinateSystem,
    StageIndexType stageIdx,SectionPropertyMethod sectionPropMethod, HaunchDepthMethod haunchMethod, BOOL bFollowMatingSurfaceProfile, IndexType* pBeamIdx, IndexType* pSlabIdx,ISection** section)
 {
+   WBFL_TRACE_FUNCTION();
    // Validate input
    CHECK_RETOBJ(section);
    CHECK_IN(bridge);
 
+   if (m_bCacheSections)
+   {
+      SectionKey key{ SectionKey::Type::Girder,ssMbrID,segIdx,Xs,sectionBias,coordinateSystem,stageIdx,sectionPropMethod,haunchMethod,bFollowMatingSurfaceProfile };
+      return GetCachedSection(bridge,key,pBeamIdx,pSlabIdx,section);
+   }
+
    return CreateCompositeSection(bridge,ssMbrID,segIdx,Xs,sectionBias,coordinateSystem,stageIdx,sectionPropMethod,haunchMethod,bFollowMatingSurfaceProfile,pBeamIdx,pSlabIdx,section);
 }
 
 STDMETHODIMP CSectionCutTool::CreateNetDeckSection(IGenericBridge* bridge,GirderIDType ssMbrID,SegmentIndexType segIdx,Float64 Xs, SectionBias sectionBias, SectionCoordinateSystemType coordinateSystem,StageIndexType stageIdx,HaunchDepthMethod haunchMethod, BOOL bFollowMatingSurfaceProfile,ISection** section)
 {
+   WBFL_TRACE_FUNCTION();
    CHECK_IN(bridge);
    CHECK_RETOBJ(section);
 
+   if (m_bCacheSections)
+   {
+      SectionKey key{ SectionKey::Type::NetDeck,ssMbrID,segIdx,Xs,sectionBias,coordinateSystem,stageIdx,spmNet,haunchMethod,bFollowMatingSurfaceProfile };
+      return GetCachedSection(bridge,key,nullptr,nullptr,section);
+   }
+
+   return CreateNetDeckSectionImpl(bridge,ssMbrID,segIdx,Xs,sectionBias,coordinateSystem,stageIdx,haunchMethod,bFollowMatingSurfaceProfile,section);
+}
+
+HRESULT CSectionCutTool::CreateNetDeckSectionImpl(IGenericBridge* bridge,GirderIDType ssMbrID,SegmentIndexType segIdx,Float64 Xs, SectionBias sectionBias, SectionCoordinateSystemType coordinateSystem,StageIndexType stageIdx,HaunchDepthMethod haunchMethod, BOOL bFollowMatingSurfaceProfile,ISection** section)
+{
    // the girder section is required to create the deck shape
    CComPtr<ISection> ncsection;
    HRESULT hr = CreateNoncompositeSection(bridge,ssMbrID,segIdx,Xs, sectionBias,coordinateSystem,stageIdx,spmGrossNoncomposite,&ncsection);
@@ -1110,6 +1367,7 @@ STDMETHODIMP CSectionCutTool::CreateDeckAnalysisShape(IGenericBridge * bridge,IG
 
 STDMETHODIMP CSectionCutTool::CreateBridgeSection(IGenericBridge* bridge,Float64 Xb,SectionBias sectionBias,StageIndexType stageIdx,BarrierSectionCut bsc,ISection** section)
 {
+   WBFL_TRACE_FUNCTION();
    // location is measured along the alignment, from the station of the first pier. The section cut is made
    // normal to the alignment.
    HRESULT hr = S_OK;
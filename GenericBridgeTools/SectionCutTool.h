@@ -30,6 +30,9 @@
 
 #include "resource.h"       // main symbols
 #include <vector>
+#include <list>
+#include <map>
+#include <tuple>
 
 
 /////////////////////////////////////////////////////////////////////////////
@@ -109,8 +112,17 @@ public:
    STDMETHOD(CreateLongitudinalJointShapeBySegment)(/*[in]*/IGenericBridge* bridge, /*[in]*/GirderIDType ssMbrID, /*[in]*/SegmentIndexType segIdx, /*[in]*/Float64 Xs, /*[in]*/SectionCoordinateSystemType coordinateSystem, /*[out]*/IShape** ppLeftJointShape,/*[out]*/IShape** ppRightJointShape);
 
    STDMETHOD(GetDeckProperties)(/*[in]*/IGenericBridge* bridge,/*[in]*/IndexType nSectionsPerSpan,/*[out]*/Float64* pSurfaceArea,/*[out]*/Float64* pVolume) override;
+   STDMETHOD(GetDeckPropertiesAdaptive)(/*[in]*/IGenericBridge* bridge,/*[in]*/Float64 tolerance,/*[out]*/Float64* pSurfaceArea,/*[out]*/Float64* pVolume,/*[out]*/Float64* pSurfaceAreaError,/*[out]*/Float64* pVolumeError) override;
 	STDMETHOD(GetStructuralHaunchDepth)(/*[in]*/IGenericBridge* bridge,/*[in]*/GirderIDType ssMbrID,/*[in]*/SegmentIndexType segIdx,/*[in]*/Float64 Xs,/*[in]*/HaunchDepthMethod haunchMethod, /*[out,retval]*/Float64* pHaunchDepth);
 
+   // caching of girder and net deck sections
+   STDMETHOD(put_CacheSections)(/*[in]*/VARIANT_BOOL bCache) override;
+   STDMETHOD(get_CacheSections)(/*[out,retval]*/VARIANT_BOOL* pbCache) override;
+   STDMETHOD(ClearSectionCache)() override;
+   STDMETHOD(GetSectionCacheStatistics)(/*[out]*/IndexType* pnHits,/*[out]*/IndexType* pnMisses,/*[out]*/IndexType* pnSections,/*[out]*/IndexType* pnEvictions) override;
+   STDMETHOD(put_MaxCachedSections)(/*[in]*/IndexType nSections) override;
+   STDMETHOD(get_MaxCachedSections)(/*[out,retval]*/IndexType* pnSections) override;
+
    // creates the deck shape used in composite analyses
    STDMETHOD(CreateDeckAnalysisShape)(IGenericBridge* bridge,IGirderSection* pSection,GirderIDType ssMbrID,SegmentIndexType segIdx,Float64 Xs, SectionBias sectionBias, Float64 haunchDepth, BOOL bFollowMatingSurfaceProfile,StageIndexType stageIdx,IShape** shape) override;
 
@@ -119,6 +131,7 @@ private:
    STDMETHOD(CreateLeftBarrierSection)(/*[in]*/IGenericBridge* bridge,/*[in]*/ Float64 station,/*[in]*/ VARIANT_BOOL bStructuralOnly,/*[out,retval]*/ISection** section);
    STDMETHOD(CreateRightBarrierSection)(/*[in]*/IGenericBridge* bridge,/*[in]*/ Float64 station,/*[in]*/ VARIANT_BOOL bStructuralOnly,/*[out,retval]*/ISection** section);
 
+   HRESULT CreateNetDeckSectionImpl(IGenericBridge* bridge,GirderIDType ssMbrID,SegmentIndexType segIdx,Float64 Xs, SectionBias sectionBias, SectionCoordinateSystemType coordinateSystem,StageIndexType stageIdx,HaunchDepthMethod haunchMethod, BOOL bFollowMatingSurfaceProfile,ISection** section);
    HRESULT CreateCompositeSection(IGenericBridge* bridge,GirderIDType ssMbrID,SegmentIndexType segIdx,Float64 Xs,SectionBias sectionBias, SectionCoordinateSystemType coordinateSystem,StageIndexType stageIdx,SectionPropertyMethod sectionPropMethod, HaunchDepthMethod haunchMethod, BOOL bFollowMatingSurfaceProfile, IndexType* beamIdx, IndexType* slabIdx,ISection** section);
    HRESULT CreateDeckSection(IGenericBridge* bridge,GirderIDType ssMbrID,SegmentIndexType segIdx,Float64 Xs,SectionBias sectionBias,StageIndexType stageIdx,SectionPropertyMethod sectionPropMethod, HaunchDepthMethod haunchMethod, BOOL bFollowMatingSurfaceProfile,IGirderSection* pGirderSection,ISection** section);
    HRESULT CreateDeckShape(IGenericBridge* bridge,GirderIDType ssMbrID,SegmentIndexType segIdx,Float64 Xs, SectionBias sectionBias, Float64 haunchDepth, BOOL bFollowMatingSurfaceProfile,IGirderSection* pGirderSection,IShape** pShape);
@@ -148,6 +161,58 @@ private:
    };
 
    std::vector<CSectionCutTool::GirderPointRecord> GetGirderPoints(IGenericBridge* pBridge,IStation* pStation,IDirection* pDirection);
+
+   // deck surface area and volume integration
+   struct DeckCut
+   {
+      Float64 Perimeter;
+      Float64 Area;
+   };
+   bool GetDeckPierStations(IGenericBridge* bridge, std::vector<Float64>* pvStations);
+   DeckCut GetDeckCut(IGenericBridge* bridge, Float64 station);
+   void IntegrateDeck(IGenericBridge* bridge, Float64 a, Float64 b, const DeckCut& fa, const DeckCut& fm, const DeckCut& fb, const DeckCut& whole, const DeckCut& tol, IndexType depth, DeckCut* pResult, DeckCut* pError);
+
+   // Section cache. The key is all of the parameters that define a section.
+   struct SectionKey
+   {
+      enum class Type { Girder, NetDeck } type;
+      GirderIDType ssMbrID;
+      SegmentIndexType segIdx;
+      Float64 Xs;
+      SectionBias sectionBias;
+      SectionCoordinateSystemType coordinateSystem;
+      StageIndexType stageIdx;
+      SectionPropertyMethod sectionPropMethod;
+      HaunchDepthMethod haunchMethod;
+      BOOL bFollowMatingSurfaceProfile;
+
+      bool operator<(const SectionKey& other) const
+      {
+         return std::tie(type, ssMbrID, segIdx, Xs, sectionBias, coordinateSystem, stageIdx, sectionPropMethod, haunchMethod, bFollowMatingSurfaceProfile) <
+            std::tie(other.type, other.ssMbrID, other.segIdx, other.Xs, other.sectionBias, other.coordinateSystem, other.stageIdx, other.sectionPropMethod, other.haunchMethod, other.bFollowMatingSurfaceProfile);
+      }
+   };
+
+   struct SectionCacheEntry
+   {
+      HRESULT hr;
+      IndexType beamIdx;
+      IndexType slabIdx;
+      CComPtr<ISection> section;
+      std::list<SectionKey>::iterator lruIter; // position of this entry in m_SectionCacheLRU
+   };
+
+   bool m_bCacheSections = false;
+   CComPtr<IGenericBridge> m_CachedBridge; // the bridge the cached sections were created from
+   std::map<SectionKey, SectionCacheEntry> m_SectionCache;
+   std::list<SectionKey> m_SectionCacheLRU; // keys of the cached sections, most recently used first
+   IndexType m_MaxCachedSections = 10000;
+   IndexType m_nCacheHits = 0;
+   IndexType m_nCacheMisses = 0;
+   IndexType m_nCacheEvictions = 0;
+
+   HRESULT GetCachedSection(IGenericBridge* bridge, const SectionKey& key, IndexType* pBeamIdx, IndexType* pSlabIdx, ISection** section);
+   void TrimSectionCache(IndexType nSections); // evicts least recently used sections until there are no more than nSections
 };
 
 #endif //__SECTIONCUTTOOL_H_
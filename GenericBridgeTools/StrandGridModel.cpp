@@ -1868,6 +1868,151 @@ STDMETHODIMP CStrandGridModel::GetStraightStrandDebondConfigurationByRow(Float64
    return S_OK;
 }
 
+STDMETHODIMP CStrandGridModel::GetStrandPositionsAtSections(StrandType strandType, IDblArray* pXs, IIndexArray* fill, StrandIndexType* pnStrands, IDblArray** ppX, IDblArray** ppY)
+{
+   CHECK_IN(pXs);
+   CHECK_RETVAL(pnStrands);
+   CHECK_RETOBJ(ppX);
+   CHECK_RETOBJ(ppY);
+
+   std::vector<Float64> vXs;
+   GetSections(pXs, vXs);
+
+   std::vector<Float64> vX, vY;
+   HRESULT hr = GetStrandPositions(strandType, vXs, fill, pnStrands, vX, vY);
+   if (FAILED(hr))
+   {
+      return hr;
+   }
+
+   CreateDblArray(vX, ppX);
+   CreateDblArray(vY, ppY);
+   return S_OK;
+}
+
+STDMETHODIMP CStrandGridModel::GetStrandCGsAtSections(StrandType strandType, IDblArray* pXs, IIndexArray* fill, IDblArray** ppCGX, IDblArray** ppCGY)
+{
+   CHECK_IN(pXs);
+   CHECK_RETOBJ(ppCGX);
+   CHECK_RETOBJ(ppCGY);
+
+   std::vector<Float64> vXs;
+   GetSections(pXs, vXs);
+
+   StrandIndexType nStrands;
+   std::vector<Float64> vX, vY;
+   HRESULT hr = GetStrandPositions(strandType, vXs, fill, &nStrands, vX, vY);
+   if (FAILED(hr))
+   {
+      return hr;
+   }
+
+   // Debond lengths of straight strands don't change along the segment. Get them once
+   // so the bonded strands at each section can be determined without removing points
+   // from a collection (see RemoveStraightStrandDebondedStrandPositions)
+   Float64 Ls = 0;
+   std::vector<std::pair<Float64, Float64>> vDebondLengths; // empty if there aren't any debonded strands
+   if (strandType == Straight)
+   {
+      StrandIndexType nDebonded;
+      GetStraightStrandDebondCount(WDebondLocationType::wdblLeft, &nDebonded);
+      if (0 < nDebonded)
+      {
+         m_pSegment->get_Length(&Ls);
+         vDebondLengths.reserve(nStrands);
+         for (StrandIndexType strandIdx = 0; strandIdx < nStrands; strandIdx++)
+         {
+            Float64 X, Y, l1, l2;
+            GetStraightStrandDebondLengthByPositionIndex(0.0, strandIdx, &X, &Y, &l1, &l2);
+            vDebondLengths.emplace_back(l1, l2);
+         }
+      }
+   }
+
+   IndexType nSections = vXs.size();
+   std::vector<Float64> vCGX, vCGY;
+   vCGX.reserve(nSections);
+   vCGY.reserve(nSections);
+   for (IndexType sectionIdx = 0; sectionIdx < nSections; sectionIdx++)
+   {
+      Float64 Xs = vXs[sectionIdx];
+      Float64 sumX = 0;
+      Float64 sumY = 0;
+      StrandIndexType nBonded = 0;
+      for (StrandIndexType strandIdx = 0; strandIdx < nStrands; strandIdx++)
+      {
+         if (vDebondLengths.empty() || IsStraightStrandBonded(Xs, Ls, vDebondLengths[strandIdx].first, vDebondLengths[strandIdx].second))
+         {
+            sumX += vX[sectionIdx*nStrands + strandIdx];
+            sumY += vY[sectionIdx*nStrands + strandIdx];
+            nBonded++;
+         }
+      }
+
+      // same as GetCGFromPoints
+      vCGX.push_back(nBonded == 0 ? 0 : sumX / nBonded);
+      vCGY.push_back(nBonded == 0 ? 0 : sumY / nBonded);
+   }
+
+   CreateDblArray(vCGX, ppCGX);
+   CreateDblArray(vCGY, ppCGY);
+   return S_OK;
+}
+
+STDMETHODIMP CStrandGridModel::ComputeMaxHarpedStrandSlopesAtSections(IDblArray* pXs, IIndexArray* fill, Float64 startOffset, Float64 hp1Offset, Float64 hp2Offset, Float64 endOffset, IDblArray** ppSlopes)
+{
+   CHECK_IN(pXs);
+   CHECK_RETOBJ(ppSlopes);
+
+   std::vector<Float64> vXs;
+   GetSections(pXs, vXs);
+
+   Float64 leftEndHP, leftHP, rightHP, rightEndHP;
+   GetHarpingPointLocations(&leftHP, &rightHP);
+   GetEndHarpingPointLocations(&leftEndHP, &rightEndHP);
+
+   // The slope is the same at every section in a sloped region so it is only computed
+   // the first time a section in the region is encountered
+   Float64 leftSlope = DBL_MAX;
+   Float64 rightSlope = DBL_MAX;
+   bool bLeftSlope = false;
+   bool bRightSlope = false;
+
+   std::vector<Float64> vSlopes;
+   vSlopes.reserve(vXs.size());
+   for (auto Xs : vXs)
+   {
+      Float64 slope = DBL_MAX;
+      if (::IsLT(Xs, leftEndHP) || (::IsLT(leftHP, Xs) && ::IsLT(Xs, rightHP)) || ::IsLT(rightEndHP, Xs))
+      {
+         // outside of sloped region or between harp points
+         slope = DBL_MAX;
+      }
+      else if (::IsLE(Xs, leftHP))
+      {
+         if (!bLeftSlope)
+         {
+            ComputeMaxHarpedStrandSlopeEx(Xs, fill, startOffset, hp1Offset, hp2Offset, endOffset, &leftSlope);
+            bLeftSlope = true;
+         }
+         slope = leftSlope;
+      }
+      else
+      {
+         if (!bRightSlope)
+         {
+            ComputeMaxHarpedStrandSlopeEx(Xs, fill, startOffset, hp1Offset, hp2Offset, endOffset, &rightSlope);
+            bRightSlope = true;
+         }
+         slope = rightSlope;
+      }
+      vSlopes.push_back(slope);
+   }
+
+   CreateDblArray(vSlopes, ppSlopes);
+   return S_OK;
+}
+
 HRESULT CStrandGridModel::ComputeHpFill(IIndexArray* endFill, IIndexArray** hpFill)
 {
    // Fill for harped strands at harping points can be different than at girder ends
@@ -2000,31 +2145,35 @@ void CStrandGridModel::RemoveStraightStrandDebondedStrandPositions(Float64 Xs, I
       ATLASSERT(IsEqual(px, X));
       ATLASSERT(IsEqual(py, Y));
 #endif
-      if (!IsZero(l1) || !IsZero(l2))
+      if (!IsStraightStrandBonded(Xs, Ls, l1, l2))
       {
-         // this is some debonding... does it occur at this section?
-         Float64 leftBond = Xs - l1; // amount of bonded strands on the left side of distFromStart
-         Float64 rightBond = Ls - Xs - l2; // amount of bonded strand on the right side of distFromStart
-         if (IsZero(Xs) || IsEqual(Xs, Ls))
-         {
-            if (IsLT(leftBond, 0.0) || IsLT(rightBond, 0.0))
-            {
-               // strand is not bonded at this section... remove it
-               pPoints->Remove(strandIdx);
-            }
-         }
-         else
-         {
-            if (IsLE(leftBond, 0.0) || IsLE(rightBond, 0.0))
-            {
-               // strand is not bonded at this section... remove it
-               pPoints->Remove(strandIdx);
-            }
-         }
+         // strand is not bonded at this section... remove it
+         pPoints->Remove(strandIdx);
       }
    }
 }
 
+bool CStrandGridModel::IsStraightStrandBonded(Float64 Xs, Float64 Ls, Float64 l1, Float64 l2) const
+{
+   if (IsZero(l1) && IsZero(l2))
+   {
+      // strand isn't debonded
+      return true;
+   }
+
+   // this is some debonding... does it occur at this section?
+   Float64 leftBond = Xs - l1; // amount of bonded strands on the left side of distFromStart
+   Float64 rightBond = Ls - Xs - l2; // amount of bonded strand on the right side of distFromStart
+   if (IsZero(Xs) || IsEqual(Xs, Ls))
+   {
+      return !(IsLT(leftBond, 0.0) || IsLT(rightBond, 0.0));
+   }
+   else
+   {
+      return !(IsLE(leftBond, 0.0) || IsLE(rightBond, 0.0));
+   }
+}
+
 Float64 CStrandGridModel::GetSectionHeight(Float64 Xs)
 {
    Float64 Hg;
@@ -2292,6 +2441,198 @@ HRESULT CStrandGridModel::GetStrandPositions(Float64 Xs, Float64 distToStartGrid
    return S_OK;
 }
 
+HRESULT CStrandGridModel::GetStrandPositions(StrandType strandType, const std::vector<Float64>& vXs, IIndexArray* fill, StrandIndexType* pnStrands, std::vector<Float64>& vX, std::vector<Float64>& vY)
+{
+   // This is the same as GetStraightStrandPositions, GetHarpedStrandPositions, and GetTemporaryStrandPositions
+   // except that the strand grids, harp points, and section height at the start of the girder
+   // are evaluated once for all the sections
+   Float64 gdrLength;
+   m_pGirder->get_GirderLength(&gdrLength);
+
+   Float64 Hg = GetSectionHeight(0);
+
+   vX.clear();
+   vY.clear();
+
+   switch (strandType)
+   {
+   case Straight:
+   case Temporary:
+   {
+      auto& grid = (strandType == Straight ? m_StraightGrid : m_TempGrid);
+      StrandProfileType profileType = (strandType == Straight ? m_StraightStrandProfileType : m_TemporaryStrandProfileType);
+
+      CComPtr<IIndexArray> theFill(fill);
+      if (theFill == nullptr)
+      {
+         grid[etStart]->get_StrandFill(&theFill);
+      }
+
+      StrandPoints startPoints, endPoints;
+      GetGridPoints(grid[etStart], theFill, startPoints);
+      GetGridPoints(grid[etEnd], theFill, endPoints);
+
+      *pnStrands = startPoints.size();
+      vX.reserve(vXs.size()*startPoints.size());
+      vY.reserve(vXs.size()*startPoints.size());
+      for (auto Xs : vXs)
+      {
+         Float64 precamber;
+         m_pSegment->ComputePrecamber(Xs, &precamber);
+         if (profileType == Linear)
+         {
+            InterpolateStrandPositions(Xs, 0.0, gdrLength, Hg, -precamber, -precamber, precamber, startPoints, grid[etStart], endPoints, grid[etEnd], vX, vY);
+         }
+         else
+         {
+            // FollowGirder - the strands move with the precamber so it cancels out
+            InterpolateStrandPositions(Xs, 0.0, gdrLength, Hg, 0.0, 0.0, 0.0, startPoints, grid[etStart], endPoints, grid[etEnd], vX, vY);
+         }
+      }
+   }
+   break;
+
+   case Harped:
+   {
+      CComPtr<IIndexArray> theFill(fill);
+      if (theFill == nullptr)
+      {
+         m_HarpGridEnd[etStart]->get_StrandFill(&theFill);
+      }
+
+      CComPtr<IIndexArray> hpFill;
+      HRESULT hr = ComputeHpFill(theFill, &hpFill);
+      ATLASSERT(SUCCEEDED(hr));
+
+      Float64 leftEndHP, leftHP, rightHP, rightEndHP;
+      GetHarpingPointLocations(&leftHP, &rightHP);
+      GetEndHarpingPointLocations(&leftEndHP, &rightEndHP);
+
+      Float64 leftEndHPprecamber, leftHPprecamber, rightHPprecamber, rightEndHPprecamber;
+      m_pSegment->ComputePrecamber(leftEndHP, &leftEndHPprecamber);
+      m_pSegment->ComputePrecamber(leftHP, &leftHPprecamber);
+      m_pSegment->ComputePrecamber(rightHP, &rightHPprecamber);
+      m_pSegment->ComputePrecamber(rightEndHP, &rightEndHPprecamber);
+
+      StrandPoints startEndPoints, startHpPoints, endHpPoints, endEndPoints;
+      GetGridPoints(m_HarpGridEnd[etStart], theFill, startEndPoints);
+      GetGridPoints(m_HarpGridHp[etStart], hpFill, startHpPoints);
+      GetGridPoints(m_HarpGridHp[etEnd], hpFill, endHpPoints);
+      GetGridPoints(m_HarpGridEnd[etEnd], theFill, endEndPoints);
+
+      *pnStrands = startEndPoints.size();
+      vX.reserve(vXs.size()*startEndPoints.size());
+      vY.reserve(vXs.size()*startEndPoints.size());
+      for (auto Xs : vXs)
+      {
+         // harped strands always have a Linear profile so their elevation need to be adjusted for precamber effects
+         Float64 precamber;
+         m_pSegment->ComputePrecamber(Xs, &precamber);
+         if (::IsLE(Xs, leftEndHP) || ::IsGE(rightEndHP, Xs))
+         {
+            // in the end portions of the harped strands governed by the end grids
+            const auto& points = (::IsLE(Xs, leftEndHP) ? startEndPoints : endEndPoints);
+            for (const auto& point : points)
+            {
+               vX.push_back(point.X);
+               vY.push_back(point.Y - precamber);
+            }
+         }
+         else if (leftHP <= Xs && Xs <= rightHP)
+         {
+            // between harp points
+            InterpolateStrandPositions(Xs, leftHP, rightHP - leftHP, Hg, leftHPprecamber, rightHPprecamber, precamber, startHpPoints, m_HarpGridHp[etStart], endHpPoints, m_HarpGridHp[etEnd], vX, vY);
+         }
+         else if (leftEndHP < Xs && Xs < leftHP)
+         {
+            // on the sloped part of the harped strands at the left end of the girder
+            InterpolateStrandPositions(Xs, leftEndHP, leftHP - leftEndHP, Hg, leftEndHPprecamber, leftHPprecamber, precamber, startEndPoints, m_HarpGridEnd[etStart], startHpPoints, m_HarpGridHp[etStart], vX, vY);
+         }
+         else
+         {
+            // on the sloped part of the harped strands at right end of girder
+            ATLASSERT(rightHP < Xs && Xs < rightEndHP);
+            InterpolateStrandPositions(Xs, rightHP, rightEndHP - rightHP, Hg, rightHPprecamber, rightEndHPprecamber, precamber, endHpPoints, m_HarpGridHp[etEnd], endEndPoints, m_HarpGridEnd[etEnd], vX, vY);
+         }
+      }
+   }
+   break;
+
+   default:
+      ATLASSERT(false); // is there a new type?
+      return E_INVALIDARG;
+   }
+
+   return S_OK;
+}
+
+void CStrandGridModel::GetGridPoints(IStrandGridFiller* pGridFiller, IIndexArray* fill, StrandPoints& points)
+{
+   CComPtr<IPoint2dCollection> pnts;
+   pGridFiller->GetStrandPositionsEx(fill, &pnts); // in Girder Section Coordinates
+
+   IndexType nPoints;
+   pnts->get_Count(&nPoints);
+   points.clear();
+   points.reserve(nPoints);
+   for (IndexType idx = 0; idx < nPoints; idx++)
+   {
+      CComPtr<IPoint2d> pnt;
+      pnts->get_Item(idx, &pnt);
+      Float64 x, y;
+      pnt->Location(&x, &y);
+      points.push_back({ x,y });
+   }
+}
+
+void CStrandGridModel::InterpolateStrandPositions(Float64 Xs, Float64 distToStartGrid, Float64 distBetweenGrids, Float64 Hg, Float64 startPrecamber, Float64 endPrecamber, Float64 precamber, const StrandPoints& startPoints, IStrandGridFiller* pStartGridFiller, const StrandPoints& endPoints, IStrandGridFiller* pEndGridFiller, std::vector<Float64>& vX, std::vector<Float64>& vY)
+{
+   // see GetStrandPositions above. The grid points are measured from the bottom of the girder
+   // at the left end for interpolation and then put back into Girder Section Coordinates
+   ATLASSERT(startPoints.size() == endPoints.size());
+
+   Float64 Yadj = GetGirderDepthAdjustment(Xs, distToStartGrid, distBetweenGrids, pStartGridFiller, pEndGridFiller);
+
+   IndexType nPoints = startPoints.size();
+   for (IndexType idx = 0; idx < nPoints; idx++)
+   {
+      const auto& start = startPoints[idx];
+      const auto& end = endPoints[idx];
+
+      Float64 x = ::LinInterp(Xs - distToStartGrid, start.X, end.X, distBetweenGrids);
+      Float64 y = ::LinInterp(Xs - distToStartGrid, start.Y + Hg + startPrecamber, end.Y + Hg + endPrecamber, distBetweenGrids);
+
+      vX.push_back(x);
+      vY.push_back(y + Yadj - Hg - precamber);
+   }
+}
+
+void CStrandGridModel::GetSections(IDblArray* pXs, std::vector<Float64>& vXs) const
+{
+   IndexType nSections;
+   pXs->get_Count(&nSections);
+   vXs.clear();
+   vXs.reserve(nSections);
+   for (IndexType sectionIdx = 0; sectionIdx < nSections; sectionIdx++)
+   {
+      Float64 Xs;
+      pXs->get_Item(sectionIdx, &Xs);
+      vXs.push_back(Xs);
+   }
+}
+
+void CStrandGridModel::CreateDblArray(const std::vector<Float64>& values, IDblArray** ppArray) const
+{
+   CComPtr<IDblArray> array;
+   array.CoCreateInstance(CLSID_DblArray);
+   array->Reserve(values.size());
+   for (auto value : values)
+   {
+      array->Add(value);
+   }
+   array.CopyTo(ppArray);
+}
+
 HRESULT CStrandGridModel::GetStraightStrandCount(IIndexArray* fill, StrandIndexType* nStrands)
 {
    if (fill == nullptr)
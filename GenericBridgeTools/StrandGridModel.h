@@ -30,6 +30,7 @@
 #include "resource.h"       // main symbols
 #include "StrandModelBase.h"
 #include <map>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////
 // CStrandGridModel
@@ -229,8 +230,19 @@ public:
    STDMETHOD(GetStraightStrandDebondLengthByGridIndex)(EndType endType,GridIndexType grdIndex,Float64* XCoord, Float64* YCoord, Float64* l1,Float64* l2) override;
    
    STDMETHOD(GetStraightStrandBondedLengthByGridIndex)(GridIndexType grdIndex, Float64 distFromStart, Float64* XCoord, Float64* YCoord, Float64* leftBond, Float64* rightBond) override;
+
+   STDMETHOD(GetStrandPositionsAtSections)(StrandType strandType, IDblArray* pXs, IIndexArray* fill, StrandIndexType* pnStrands, IDblArray** ppX, IDblArray** ppY) override;
+   STDMETHOD(GetStrandCGsAtSections)(StrandType strandType, IDblArray* pXs, IIndexArray* fill, IDblArray** ppCGX, IDblArray** ppCGY) override;
+   STDMETHOD(ComputeMaxHarpedStrandSlopesAtSections)(IDblArray* pXs, IIndexArray* fill, Float64 startOffset, Float64 hp1Offset, Float64 hp2Offset, Float64 endOffset, IDblArray** ppSlopes) override;
    
 private:
+   struct StrandPoint
+   {
+      Float64 X;
+      Float64 Y;
+   };
+   using StrandPoints = std::vector<StrandPoint>;
+
    void GetHarpedStrandGrid(Float64 Xs, IStrandGridFiller** ppGrid);
    void RemoveStraightStrandDebondedStrandPositions(Float64 distFromStart, IPoint2dCollection* pPoints);
 
@@ -241,6 +253,14 @@ private:
    HRESULT GetTemporaryStrandPositions(Float64 Xs, IIndexArray* fill, IPoint2dCollection** points);
    HRESULT GetStrandPositions(Float64 Xs, Float64 distToStartGrid, Float64 distBetweenGrids, Float64 Lg, Float64 startPrecamber, Float64 endPrecamber, IIndexArray* startFill, IStrandGridFiller* pStartGridFiller, IIndexArray* endFill, IStrandGridFiller* pEndGridFiller, IPoint2dCollection** points);
 
+   // Strand positions at many sections without creating point objects for each section
+   HRESULT GetStrandPositions(StrandType strandType, const std::vector<Float64>& vXs, IIndexArray* fill, StrandIndexType* pnStrands, std::vector<Float64>& vX, std::vector<Float64>& vY);
+   void GetGridPoints(IStrandGridFiller* pGridFiller, IIndexArray* fill, StrandPoints& points);
+   void InterpolateStrandPositions(Float64 Xs, Float64 distToStartGrid, Float64 distBetweenGrids, Float64 Hg, Float64 startPrecamber, Float64 endPrecamber, Float64 precamber, const StrandPoints& startPoints, IStrandGridFiller* pStartGridFiller, const StrandPoints& endPoints, IStrandGridFiller* pEndGridFiller, std::vector<Float64>& vX, std::vector<Float64>& vY);
+   bool IsStraightStrandBonded(Float64 Xs, Float64 Ls, Float64 l1, Float64 l2) const;
+   void GetSections(IDblArray* pXs, std::vector<Float64>& vXs) const;
+   void CreateDblArray(const std::vector<Float64>& values, IDblArray** ppArray) const;
+
    HRESULT GetStraightStrandCount(IIndexArray* fill, StrandIndexType* nStrands);
    HRESULT GetHarpedStrandCount(IIndexArray* fill, StrandIndexType* nStrands);
    HRESULT GetTemporaryStrandCount(IIndexArray* fill, StrandIndexType* nStrands);
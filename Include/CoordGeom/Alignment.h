@@ -161,6 +161,16 @@ namespace WBFL
          /// @return The new point
          WBFL::Geometry::Point2d LocatePoint(const Station& station, OffsetType offsetType, Float64 offset, const Direction& dir) const;
 
+         /// @brief Locates points on the alignment at a sequence of stations. This is equivalent to calling LocatePoint for each station,
+         /// however the stations are normalized in a single pass and the alignment is traversed once instead of being searched for every point.
+         /// The stations should be in increasing order for best performance.
+         /// @param vStations Stations from which the points are to be located
+         /// @param offsetType Specifies how offset is measured
+         /// @param vOffsets Offsets from the alignment to the points. Must be the same size as vStations
+         /// @param dir Direction from the alignment at which to locate the points
+         /// @param vPoints Caller-owned array that receives the points. Must be the same size as vStations
+         void LocatePoints(std::span<const Station> vStations, OffsetType offsetType, std::span<const Float64> vOffsets, const Direction& dir, std::span<WBFL::Geometry::Point2d> vPoints) const;
+
          /// @brief Intersects a Line2d object with the alignment, projecting the start and end tangents if specified, returning the intersection point nearest a specified point.
          /// @param line The line to intersect with the alignment.
          /// @param nearest A point used for comparison with multiple intersection points. The resulting point is the one nearest this point.
@@ -175,6 +185,13 @@ namespace WBFL
          /// @return A Direction object representing the bearing
          Direction GetBearing(const Station& station) const;
 
+         /// @brief Computes the bearing of the alignment at a sequence of stations. This is equivalent to calling GetBearing for each station,
+         /// however the stations are normalized in a single pass and the alignment is traversed once instead of being searched for every station.
+         /// The stations should be in increasing order for best performance.
+         /// @param vStations Stations at which the bearing is to be computed
+         /// @param vBearings Caller-owned array that receives the bearings. Must be the same size as vStations
+         void GetBearings(std::span<const Station> vStations, std::span<Direction> vBearings) const;
+
          /// @brief Computes the normal to the alignment at a specified station.
          /// @image html Images/Normal.jpg
          /// @param station Station at which the normal is to be computed
@@ -280,6 +297,7 @@ namespace WBFL
          void StationEquationError() const;
 
          Float64 StationToPathDistance(const Station& station) const;
+         std::vector<Float64> StationsToPathDistances(std::span<const Station> vStations) const;
          Station CreateStation(Float64 normalizedStation) const;
       };
    };
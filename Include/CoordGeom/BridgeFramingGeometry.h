@@ -30,6 +30,8 @@
 #include <CoordGeom/DeckBoundaryFactory.h>
 #include <CoordGeom/Model.h>
 #include <array>
+#include <set>
+#include <unordered_map>
 
 namespace WBFL
 {
@@ -48,6 +50,10 @@ namespace WBFL
       /// Multiple factories of each type can be added to the model. When the factory Create method is called, all previously created geometry
       /// elements are replaced.
       /// 
+      /// When the definition of an individual pier line or layout line is changed through its factory, call InvalidatePierLine or InvalidateLayoutLine.
+      /// Only that pier line or layout line, and the girder lines, diaphragm lines and deck boundary that depend on it, are recomputed.
+      /// All other geometry elements are retained.
+      /// 
       /// The bridge geometry object manages all of the geometric object created by the factory objects.
       class COORDGEOMCLASS BridgeFramingGeometry : public std::enable_shared_from_this<BridgeFramingGeometry>
       {
@@ -141,6 +147,11 @@ namespace WBFL
          /// @param idx 
          /// @return 
          std::shared_ptr<const PierLine> GetPierLine(PierIndexType idx) const;
+
+         /// @brief Indicates the definition of a pier line has changed. The pier line and the geometry that depends on it
+         /// are recomputed the next time geometry is requested.
+         /// @param id 
+         void InvalidatePierLine(PierIDType id);
          /// @}
 
          /// @name Layout Lines
@@ -163,6 +174,11 @@ namespace WBFL
          /// @param idx 
          /// @return 
          std::shared_ptr<const Path> GetLayoutLine(IndexType idx) const;
+
+         /// @brief Indicates the definition of a layout line has changed. The layout line and the geometry that depends on it
+         /// are recomputed the next time geometry is requested.
+         /// @param id 
+         void InvalidateLayoutLine(IDType id);
          /// @}
 
          /// @name Girder Lines
@@ -245,6 +261,27 @@ namespace WBFL
          mutable std::vector<std::shared_ptr<DiaphragmLine>> m_DiaphragmLines;
          mutable std::shared_ptr<DeckBoundary> m_DeckBoundary;
 
+         // Lookup tables for finding geometry elements by ID. Key is ID, value is index into the corresponding vector
+         mutable std::unordered_map<IDType, IndexType> m_PierLineIndex;
+         mutable std::unordered_map<IDType, IndexType> m_LayoutLineIndex;
+         mutable std::unordered_map<IDType, IndexType> m_GirderLineIndex;
+         mutable std::unordered_map<IDType, IndexType> m_DiaphragmLineIndex;
+
+         // Pier lines and layout lines read by a factory while it creates geometry elements.
+         // Girder lines and diaphragm lines store the IDs of the elements they depend on so they don't need this.
+         struct Dependencies
+         {
+            std::set<IDType> PierLines;
+            std::set<IDType> LayoutLines;
+         };
+         mutable Dependencies m_LayoutLineDependencies;
+         mutable Dependencies m_DeckBoundaryDependencies;
+         mutable Dependencies* m_pDependencies = nullptr; // when not nullptr, pier line and layout line reads are recorded here
+
+         // Pier lines and layout lines whose definitions have changed since they were created
+         mutable std::set<IDType> m_InvalidPierLines;
+         mutable std::set<IDType> m_InvalidLayoutLines;
+
          const Int8 All = 0;
          const Int8 PierLineState = 1;
          const Int8 LayoutLineState = 2;
@@ -254,6 +291,8 @@ namespace WBFL
          mutable Int8 m_CurrentState = All;
          void InvalidateState(Int8 state) const;
          void ValidateState(Int8 state) const;
+         void UpdateInvalidElements() const;
+         template <class F> auto RecordDependencies(Dependencies& dependencies, F create) const;
 
          void UpdateBridgeLine() const;
       };
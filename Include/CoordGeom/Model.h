@@ -39,6 +39,8 @@
 #include <CoordGeom/Station.h>
 
 #include <GeomModel/Primitives.h>
+#include <array>
+#include <initializer_list>
 #include <map>
 
 namespace WBFL
@@ -902,6 +904,66 @@ namespace WBFL
 
          ///@}
 
+         ///@name Creation Cache
+         /// The Create functions return a new, independent object each time they are called. The GetCached functions
+         /// return a shared, immutable object that is created on the first request and reused by later requests.
+         /// 
+         /// Invalidation is tracked by category of definition (points, path elements, paths, alignments, profile elements,
+         /// profiles, and surfaces), not by ID. Replacing, modifying, or removing any definition discards every cached object
+         /// that depends on that category of definition, even if the object does not use the changed definition. For example,
+         /// replacing any point discards all cached curves, paths, and alignments. The cache is most effective when the model
+         /// is built first and then queried many times. Storing a definition with a new ID does not invalidate cached objects
+         /// because no existing object can refer to it.
+         /// 
+         /// The cache is updated by const methods, including the Project and Divide methods that use cached objects. Like the
+         /// rest of this class, these methods are not thread safe and must not be called concurrently on the same Model.
+         ///@{
+
+         /// @brief Creation cache statistics
+         struct CacheStatistics
+         {
+            IndexType Hits = 0; ///< Number of requests satisfied by a cached object
+            IndexType Misses = 0; ///< Number of requests that required a new object to be created
+            IndexType Invalidations = 0; ///< Number of cached objects that were discarded because a definition they depend on changed
+         };
+
+         /// @brief Returns a shared, immutable CompoundCurve for a previously stored compound curve definition
+         std::shared_ptr<const CompoundCurve> GetCachedCompoundCurve(IDType id) const;
+
+         /// @brief Returns a shared, immutable CircularCurve for a previously stored circular curve definition
+         std::shared_ptr<const CircularCurve> GetCachedCircularCurve(IDType id) const;
+
+         /// @brief Returns a shared, immutable TransitionCurve for a previously stored transition curve definition
+         std::shared_ptr<const TransitionCurve> GetCachedTransitionCurve(IDType id) const;
+
+         /// @brief Returns a shared, immutable CubicSpline for a previously stored cubic spline definition
+         std::shared_ptr<const CubicSpline> GetCachedCubicSpline(IDType id) const;
+
+         /// @brief Returns a shared, immutable Path for a previously stored path definition
+         std::shared_ptr<const Path> GetCachedPath(IDType pathID) const;
+
+         /// @brief Returns a shared, immutable Alignment, with its associated profiles and surfaces, for a previously stored alignment definition
+         std::shared_ptr<const Alignment> GetCachedAlignment(IDType alignmentID) const;
+
+         /// @brief Returns a shared, immutable Profile, with its associated surfaces, for a previously stored profile definition.
+         /// The profile is not associated with an alignment.
+         std::shared_ptr<const Profile> GetCachedProfile(IDType profileID) const;
+
+         /// @brief Returns a shared, immutable Surface for a previously stored surface definition.
+         /// The surface is not associated with a profile.
+         std::shared_ptr<const Surface> GetCachedSurface(IDType surfaceID) const;
+
+         /// @brief Returns the creation cache statistics
+         const CacheStatistics& GetCacheStatistics() const;
+
+         /// @brief Resets the creation cache statistics
+         void ResetCacheStatistics();
+
+         /// @brief Discards all cached objects
+         void ClearCache();
+
+         ///@}
+
          ///@name Measure
          ///@{
          
@@ -1303,6 +1365,31 @@ namespace WBFL
          std::map<IDType, Station> m_AlignmentReferenceStations; // key is alignment ID
          std::map<IDType, std::vector<StationEquationDefinition>> m_StationEquations; // pair is back, ahead
 
+         // Creation cache
+         // Definitions are grouped into categories. Every change to a definition stamps its category with the next
+         // model revision. A cached object records the revision at which it was created and is stale when any
+         // category it depends on has a later stamp. This is conservative - a change to one definition invalidates
+         // cached objects that depend on other definitions of the same category.
+         // The cache members are mutable and are updated without synchronization by const methods.
+         enum class DefinitionType { Points, PathElements, Paths, Alignments, ProfileElements, Profiles, Surfaces, nDefinitionTypes };
+         template <class T> using Cache = std::map<IDType, std::pair<Uint64, std::shared_ptr<const T>>>; // key is ID, pair is revision when created and the cached object
+         Uint64 m_Revision = 0;
+         std::array<Uint64, (size_t)DefinitionType::nDefinitionTypes> m_DefinitionRevisions{};
+         mutable Cache<CompoundCurve> m_CompoundCurveCache;
+         mutable Cache<CircularCurve> m_CircularCurveCache;
+         mutable Cache<TransitionCurve> m_TransitionCurveCache;
+         mutable Cache<CubicSpline> m_CubicSplineCache;
+         mutable Cache<Path> m_PathCache;
+         mutable Cache<Alignment> m_AlignmentCache;
+         mutable Cache<Profile> m_ProfileCache;
+         mutable Cache<Surface> m_SurfaceCache;
+         mutable CacheStatistics m_CacheStatistics;
+
+         // Records a change to a definition of the specified type
+         void DefinitionChanged(DefinitionType type);
+
+         template <class T, class F> std::shared_ptr<const T> GetCachedItem(Cache<T>& cache, IDType id, std::initializer_list<DefinitionType> dependencies, F create) const;
+
          // Stores all provided points. If any point storage fails, rolls back any points there were stored
          bool AtomicStorePoints(std::vector<std::pair<IDType, WBFL::Geometry::Point2d>>& points);
 
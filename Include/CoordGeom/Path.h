@@ -27,6 +27,8 @@
 
 #include <GeomModel/Primitives.h>
 
+#include <span>
+
 namespace WBFL
 {
    namespace COGO
@@ -106,6 +108,21 @@ namespace WBFL
          /// @return Pair of the format (Success,Point). Success is true if an intersection point is found, otherwise false and Point is undetermined. Point is the intersection point closest to nearest.
          std::pair<bool, WBFL::Geometry::Point2d> Intersect(const WBFL::Geometry::Line2d& line, const WBFL::Geometry::Point2d& nearest, bool bProjectBack,bool bProjectAhead) const;
 
+         /// @brief Locates points at a sequence of distances along the path. This is equivalent to calling LocatePoint for each distance, 
+         /// however the path elements are traversed once instead of being searched for every point. The distances should be in increasing order for best performance.
+         /// @param vDistFromStart Distances from the start of the path
+         /// @param offsetType Specifies how offset is measured
+         /// @param vOffsets Offsets from the path to the points. Must be the same size as vDistFromStart
+         /// @param direction Direction from the path at which to locate the points
+         /// @param vPoints Caller-owned array that receives the points. Must be the same size as vDistFromStart
+         void LocatePoints(std::span<const Float64> vDistFromStart, OffsetType offsetType, std::span<const Float64> vOffsets, const Direction& direction, std::span<WBFL::Geometry::Point2d> vPoints) const;
+
+         /// @brief Computes the bearing of the path at a sequence of distances along the path. This is equivalent to calling GetBearing for each distance,
+         /// however the path elements are traversed once instead of being searched for every point. The distances should be in increasing order for best performance.
+         /// @param vDistFromStart Distances from the start of the path
+         /// @param vBearings Caller-owned array that receives the bearings. Must be the same size as vDistFromStart
+         void GetBearings(std::span<const Float64> vDistFromStart, std::span<Direction> vBearings) const;
+
          //
          // PathElement methods
          //
@@ -150,6 +167,33 @@ namespace WBFL
          // Finds a PathElement object that contains the specified distance from start of the path.
          // Also determines the distance to the beginning of that Path element
          std::pair<std::shared_ptr<const PathElement>, Float64> FindElement(Float64 distFromStart) const;
+
+         // Advances a cursor through the connected path elements to the element that contains the specified distance from start of the path.
+         // Returns the same element as FindElement when the distances are visited in increasing order. If the distance
+         // is before the cursor's previous location, the search starts over from the first element.
+         IndexType MarchElement(Float64 distFromStart, IndexType cursor) const;
+
+         // Node in a bounding box hierarchy over m_ConnectedPathElements. The connected elements are
+         // ordered along the path so adjacent elements are spatially coherent. The hierarchy is built
+         // by recursively splitting the element range in half. Leaf nodes reference a single element.
+         struct BoundingNode
+         {
+            Float64 left{ 0.0 }, bottom{ 0.0 }, right{ 0.0 }, top{ 0.0 }; // extents of the bounding box
+            IndexType element{ INVALID_INDEX }; // index of the connected path element for leaf nodes
+            IndexType leftChild{ INVALID_INDEX }; // child nodes for non-leaf nodes
+            IndexType rightChild{ INVALID_INDEX };
+
+            bool IsLeaf() const { return element != INVALID_INDEX; }
+
+            // Returns the distance from a point to this bounding box. The distance is zero if the point is inside the box
+            Float64 Distance(const WBFL::Geometry::Point2d& point) const;
+         };
+         mutable std::vector<BoundingNode> m_BoundingTree; // root node is the last node
+
+         // Returns the bounding box hierarchy for the connected path elements. The hierarchy is built on demand.
+         // Don't access m_BoundingTree directly.
+         const std::vector<BoundingNode>& GetBoundingTree() const;
+         IndexType BuildBoundingTree(IndexType first, IndexType last) const;
       };
    };
 };
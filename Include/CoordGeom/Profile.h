@@ -27,6 +27,7 @@
 #include <CoordGeom/Surface.h>
 #include <map>
 #include <memory>
+#include <span>
 
 namespace WBFL
 {
@@ -129,6 +130,13 @@ namespace WBFL
          /// @return 
          Float64 Elevation(const Station& station) const;
 
+         /// @brief Computes the profile elevation and grade at a sequence of stations. This is equivalent to calling Elevation and Grade for each station,
+         /// however the profile elements are traversed once instead of being searched for every station. The stations should be in increasing order for best performance.
+         /// @param vStations Stations where the elevation is to be computed
+         /// @param vElevations Caller-owned array that receives the elevations. Must be the same size as vStations
+         /// @param vGrades Caller-owned array that receives the grades. Must be empty or the same size as vStations
+         void GradesAndElevations(std::span<const Station> vStations, std::span<Float64> vElevations, std::span<Float64> vGrades = {}) const;
+
          /// @brief Returns the surface elevation at the specified station and offset
          /// @param station Station where the elevation is to be computed
          /// @param surfaceID ID of surface from which the elevation is calculated
@@ -143,6 +151,24 @@ namespace WBFL
          /// @return 
          Float64 Elevation(std::shared_ptr<const Surface> surface, const Station& station, Float64 offset) const;
 
+         /// @brief Computes surface elevations on a grid of stations and offsets. This is equivalent to calling Elevation for every
+         /// station and offset, however the surface section cut is created once per station and all offsets are evaluated with it.
+         /// @param surfaceID ID of surface from which the elevations are calculated
+         /// @param vStations Stations where the elevations are to be computed. The stations should be in increasing order for best performance.
+         /// @param vOffsets Offsets from the alignment
+         /// @param bParallel If true, stations are evaluated concurrently
+         /// @return Elevation matrix, in station major order. The elevation at station i and offset j is at index i*vOffsets.size() + j
+         std::vector<Float64> ElevationGrid(IDType surfaceID, std::span<const Station> vStations, std::span<const Float64> vOffsets, bool bParallel = false) const;
+
+         /// @brief Computes surface elevations on a grid of stations and offsets. This is equivalent to calling Elevation for every
+         /// station and offset, however the surface section cut is created once per station and all offsets are evaluated with it.
+         /// @param surface The surface from which the elevations are computed. Surface must be associated with this Profile.
+         /// @param vStations Stations where the elevations are to be computed. The stations should be in increasing order for best performance.
+         /// @param vOffsets Offsets from the alignment
+         /// @param bParallel If true, stations are evaluated concurrently
+         /// @return Elevation matrix, in station major order. The elevation at station i and offset j is at index i*vOffsets.size() + j
+         std::vector<Float64> ElevationGrid(std::shared_ptr<const Surface> surface, std::span<const Station> vStations, std::span<const Float64> vOffsets, bool bParallel = false) const;
+
          /// @brief Returns the profile grade at the specified station
          /// @param station 
          /// @return 
@@ -190,8 +190,12 @@ namespace WBFL
          WBFL::Geometry::Point2d m_SpiralOrigin;
          Float64 m_SpiralRotation;
 
-         Float64 SpiralX(Float64 ls, Float64 angle) const;
-         Float64 SpiralY(Float64 ls, Float64 angle) const;
+         // Returns the X and Y coordinates of the spiral at distance ls from the point of infinite radius
+         // where the tangent has deflected by angle
+         std::pair<Float64,Float64> SpiralXY(Float64 ls, Float64 angle) const;
+
+         // Returns the deflection angle of the tangent at distance s from the point of infinite radius
+         Float64 SweepAngle(Float64 s) const;
 
          Float64 DistanceFromStartOfSpiral(Float64 distance) const;
 
@@ -273,42 +277,6 @@ namespace WBFL
             Float64 m_Angle;
             WBFL::Geometry::Line2d m_Line;
          };
-
-         class CSpiralFunction : public WBFL::Math::Function
-         {
-         public:
-            CSpiralFunction(const TransitionCurve* tc, const WBFL::Geometry::Point2d& tp) :
-               m_pCurve(tc), m_TargetPoint(tp)
-            {
-            }
-
-            Float64 Evaluate(Float64 x) const
-            {
-               auto pnt = m_pCurve->PointOnCurve(x);
-
-               auto dir = m_pCurve->GetNormal(x);
-               
-               Float64 angle = dir.GetValue();
-
-               WBFL::Geometry::Vector2d v;
-               v.SetDirection(angle);
-
-               WBFL::Geometry::Line2d line(pnt, v);
-
-
-               Float64 dist = line.DistanceToPoint(m_TargetPoint);
-               return dist;
-            }
-
-            virtual std::unique_ptr<WBFL::Math::Function> Clone() const override
-            {
-               return std::make_unique<CSpiralFunction>(m_pCurve, m_TargetPoint);
-            }
-
-         private:
-            const TransitionCurve* m_pCurve;
-            WBFL::Geometry::Point2d m_TargetPoint;
-         };
       };
    };
 };
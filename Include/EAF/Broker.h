@@ -32,11 +32,13 @@
 
 #include <System/Logger.h>
 
-#include <boost/circular_buffer.hpp>
 #include <memory>
 #include <vector>
 #include <set>
 #include <map>
+#include <unordered_map>
+#include <cstdint>
+#include <cstring>
 #include <guiddef.h> // for CLSID
 #include <WBFLTools.h> // For structured save and load
 
@@ -159,26 +161,30 @@ namespace WBFL
          void ShutDown();
 
          /// @brief Gets an interface based on its interface identifier, IID
-         /// @tparam T The interface type
+         /// The agent is cast to the interface type the first time the interface is requested. After that,
+         /// the request is a single hash table lookup.
+         /// @tparam T The interface type. T must be the interface type identified by iid.
          /// @param iid The interface identifier
          /// @return The interface if found, otherwise nullptr
          template <typename T>
             std::shared_ptr<T> GetInterface(const IID& iid)
          {
-            auto sort_by_usage_frequency = [](const auto& item1, const auto& item2) {
-               return *(item2.usage_count) < *(item1.usage_count);
-               };
-
-            // first check the most frequently used list
-            InterfaceItem key;
-            key.iid = iid;
-            auto found(std::find(m_MostFrequentlyUsed.begin(), m_MostFrequentlyUsed.end(), key));
-            if (found != m_MostFrequentlyUsed.end())
+            auto found(m_Interfaces.find(iid));
+            if (found == m_Interfaces.end())
             {
-               auto& item = *found;
-               ASSERT(iid == item.iid);
-               ASSERT(item.agent != nullptr);
+               // the interface wasn't found
+               std::_tostringstream os;
+               os << _T("The requested interface is not registered with the broker: IID = ") << EAFStringFromIID(iid);
+               WBFL::System::Logger::Warning(os.str());
+               return nullptr;
+            }
 
+            auto& item = found->second;
+            ASSERT(item.agent != nullptr);
+
+            if (item.iface == nullptr)
+            {
+               // first request for this interface
                auto iface = std::dynamic_pointer_cast<T>(item.agent);
                if (iface == nullptr)
                {
@@ -188,59 +194,15 @@ namespace WBFL
                   return nullptr;
                }
 
-               // this IID is on the frequently used list
-               // increment the usage count (updates in the main list of all interfaces as well)
-               (*item.usage_count)++;
-
-               // sort the MFU list based on usage count
-               std::sort(m_MostFrequentlyUsed.begin(), m_MostFrequentlyUsed.end(), sort_by_usage_frequency);
-
-               return iface;
-            }
-
-            // IID is not in the most frequently used list... search for it in the regular list of interfaces
-            auto interface_found(m_Interfaces.find(key));
-            if (interface_found == m_Interfaces.end())
-            {
-               // the interface wasn't found
-               std::_tostringstream os;
-               os << _T("The requested interface is not registered with the broker: IID = ") << EAFStringFromIID(iid);
-               WBFL::System::Logger::Warning(os.str());
-               return nullptr;
+               item.iface = iface;
             }
 
-            const auto& item = *(interface_found);
-            auto iface = std::dynamic_pointer_cast<T>(item.agent);
-            if (iface)
-            {
-               // update the usage count
-               (*item.usage_count)++;
-
-               // See if the usage count is high enough to be in the most frequently used list
-               if (m_MostFrequentlyUsed.empty())
-               {
-                  m_MostFrequentlyUsed.push_front(item);
-               }
-               else
-               {
-                  const auto& least_used_item = m_MostFrequentlyUsed.back();
+            // if this fires, the same IID was requested with a different interface type
+            ASSERT(static_cast<T*>(item.iface.get()) == std::dynamic_pointer_cast<T>(item.agent).get());
 
-                  // a quick check to make sure sorting is ok
-                  ASSERT(*(least_used_item.usage_count) <= *(m_MostFrequentlyUsed.front().usage_count));
+            item.usage_count++;
 
-                  if (*(least_used_item.usage_count) <= *(item.usage_count))
-                  {
-                     // Current interface item has been used more times then the least used interface item
-                     // in the MFU list. Add the current item to the MFU list and re-sort. The least used
-                     // item will drop out
-                     m_MostFrequentlyUsed.push_front(item);
-
-                     // sort the MFU list based on usage count
-                     std::sort(m_MostFrequentlyUsed.begin(), m_MostFrequentlyUsed.end(), sort_by_usage_frequency);
-                  }
-               }
-            }
-            return iface;
+            return std::static_pointer_cast<T>(item.iface);
          }
 
          /// @brief Registers a callback event sink. 
@@ -338,20 +300,27 @@ namespace WBFL
       private:
          struct EAFCLASS InterfaceItem
          {
-            IID iid = CLSID_NULL; // ID of the interface
             std::shared_ptr<Agent> agent; // Agent that implements the interface
-            std::shared_ptr<IndexType> usage_count = std::make_shared<IndexType>(0); // Number of times the interface has been requested
+            std::shared_ptr<void> iface; // The agent cast to the interface type. Set when the interface is first requested
+            IndexType usage_count = 0; // Number of times the interface has been requested
 
             InterfaceItem() = default;
-            InterfaceItem(const IID& iid, std::shared_ptr<Agent> agent) : iid(iid), agent(agent) {}
+            InterfaceItem(std::shared_ptr<Agent> agent) : agent(agent) {}
+         };
 
-            bool operator<(const InterfaceItem& other) const;
-            bool operator==(const InterfaceItem& other) const;
+         struct IIDHash
+         {
+            std::size_t operator()(const IID& iid) const
+            {
+               // IIDs are random numbers so the two halves can be folded together
+               std::uint64_t half[2];
+               std::memcpy(half, &iid, sizeof(half));
+               return std::hash<std::uint64_t>()(half[0] ^ half[1]);
+            }
          };
 
-         using Interfaces = std::set<InterfaceItem>;
+         using Interfaces = std::unordered_map<IID, InterfaceItem, IIDHash>;
          Interfaces m_Interfaces;
-         boost::circular_buffer<InterfaceItem> m_MostFrequentlyUsed;
 
          std::map<std::_tstring, std::_tstring> m_CLSIDMap;
 
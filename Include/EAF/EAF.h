@@ -40,6 +40,7 @@
 #include <EAF\EAFChildFrame.h>
 #include <EAF\MacroTxn.h>
 #include <EAF\Transaction.h>
+#include <EAF\TxnDelta.h>
 #include <EAF\TxnManager.h>
 
 #endif //  INCLUDED_EAF_H_
\ No newline at end of file
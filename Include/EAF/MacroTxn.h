@@ -48,6 +48,7 @@ namespace WBFL
          virtual void Log(std::_tostream& os) const override;
          virtual bool IsUndoable() const override;
          virtual bool IsRepeatable() const override;
+         virtual std::size_t GetMemoryFootprint() const override;
    
          /// @brief Sets the transactions name
          void Name(const std::_tstring& name);
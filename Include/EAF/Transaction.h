@@ -61,6 +61,12 @@ namespace WBFL
 
          /// @brief Returns true if the transaction can be repeated
          virtual bool IsRepeatable() const;
+
+         /// @brief Returns the approximate number of bytes used by this transaction, including any data
+         /// kept for undo and redo. The transaction manager uses this to keep its history within a memory budget.
+         /// Transactions that keep copies of objects should override this method. See TxnDelta for a compact
+         /// alternative to keeping copies.
+         virtual std::size_t GetMemoryFootprint() const;
       };
    };
 };
@@ -0,0 +1,80 @@
+///////////////////////////////////////////////////////////////////////
+// EAF - Extensible Application Framework
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <EAF\EAFExp.h>
+#include <string>
+#include <vector>
+
+namespace WBFL
+{
+   namespace EAF
+   {
+      /// @brief A compact record of a change to the state of an object, used by transactions for undo and redo.
+      ///
+      /// Transactions commonly keep complete copies of an object before and after a change. When the object is large,
+      /// and the change is small, this uses a lot of memory in the transaction history. Instead, a transaction can
+      /// capture the object's state as a byte string (for example, with WBFL::System::StructuredSaveBinary) before and after
+      /// the change and keep only the bytes that differ.
+      ///
+      /// Transactions are undone and redone in order, so when a transaction is undone the current state of the
+      /// object is the state after the change. Undo() reconstructs the earlier state from it. Redo() does the reverse.
+      class EAFCLASS TxnDelta
+      {
+      public:
+         TxnDelta() = default;
+         TxnDelta(const std::string& before, const std::string& after);
+
+         /// @brief Records the difference between two states of an object
+         void Capture(const std::string& before, const std::string& after);
+
+         /// @brief Returns the state before the change given the state after the change
+         std::string Undo(const std::string& after) const;
+
+         /// @brief Returns the state after the change given the state before the change
+         std::string Redo(const std::string& before) const;
+
+         /// @brief Returns true if the states are the same
+         bool IsEmpty() const;
+
+         /// @brief Returns the approximate number of bytes used by this object
+         std::size_t GetMemoryFootprint() const;
+
+      private:
+         // A range of bytes that is different. The offset is the same in both states because
+         // only the last hunk can change the length of the state.
+         struct Hunk
+         {
+            std::size_t offset;
+            std::string before;
+            std::string after;
+         };
+         std::vector<Hunk> m_Hunks;
+         std::size_t m_BeforeSize{ 0 };
+         std::size_t m_AfterSize{ 0 };
+
+         static std::string Apply(const std::vector<Hunk>& hunks, const std::string& source, std::string Hunk::*from, std::string Hunk::*to, std::size_t sourceSize, std::size_t resultSize);
+      };
+   };
+};
@@ -133,6 +133,20 @@ namespace WBFL
          /// @brief Clears both the transaction and undo histories.
          virtual void Clear();
 
+         /// @brief Limits the size of the transaction and undo histories. When a limit is exceeded in repeat mode,
+         /// the undone transactions are discarded first because they can no longer be redone. Then the oldest executed
+         /// transactions are discarded, followed by the oldest undone transactions in redo mode. The most recently
+         /// executed transaction is always kept. By default, the histories are not limited.
+         /// @param maxCount Maximum number of transactions in both histories. Use INVALID_INDEX for no limit.
+         /// @param maxSize Maximum total memory footprint, in bytes, of both histories. Use 0 for no limit.
+         virtual void SetHistoryLimits(IndexType maxCount, std::size_t maxSize);
+
+         /// @brief Returns the limits on the size of the transaction and undo histories
+         virtual void GetHistoryLimits(IndexType* pMaxCount, std::size_t* pMaxSize) const;
+
+         /// @brief Returns the total memory footprint, in bytes, of the transaction and undo histories
+         virtual std::size_t GetHistorySize() const;
+
          /// @brief Returns true if the Transaction manager is in repeat mode.  It is
          /// useful to know this mode so the Repeat/Redo item on the edit menu
          /// can have the correct text.
@@ -167,8 +181,14 @@ namespace WBFL
 
          Mode m_Mode{ Mode::Repeat };
 
+         IndexType m_MaxHistoryCount{ INVALID_INDEX };
+         std::size_t m_MaxHistorySize{ 0 };
+
          TxnContainer::iterator FindFirstUndoableTxn();
          TxnContainer::const_iterator FindFirstUndoableTxn() const;
+
+         /// @brief Discards the oldest transactions until the histories are within their limits
+         virtual void EnforceHistoryLimits();
       };
    };
 };
@@ -33,9 +33,14 @@ namespace WBFL
    {
       class BDSManagerListener;
 
+      class BDSContext;
+
       /// @brief LRFD Bridge Design Specification (BDS) manager. This class is a global manager of the
       /// LRFD specification currently in use. BDSManagerListener objects may
-      /// be registered and will receive notifications when the specification changes
+      /// be registered and will receive notifications when the specification changes.
+      ///
+      /// The global edition and units are the default for all threads. A BDSContext object
+      /// overrides the edition and units for the thread on which it is created, for its lifetime.
       class LRFDCLASS BDSManager
       {
       public:
@@ -105,6 +110,8 @@ namespace WBFL
          static Edition SetEdition(Edition version);
 
          /// @brief Returns the selected edition of the specification.
+         /// If a BDSContext is active on the calling thread, the edition of the context is returned,
+         /// otherwise the global edition is returned.
          static Edition GetEdition();
 
          /// @brief Returns the must recent edition
@@ -115,8 +122,13 @@ namespace WBFL
          static Units SetUnits(Units units);
 
          /// @brief Returns the units of the specification.
+         /// If a BDSContext is active on the calling thread, the units of the context are returned,
+         /// otherwise the global units are returned.
          static Units GetUnits();
 
+         /// @brief Returns true if a BDSContext is active on the calling thread
+         static bool IsContextActive();
+
          /// @brief Returns the name of the specification - "AASHTO LRFD Bridge Design Specification"
          static LPCTSTR GetSpecificationName();
 
@@ -148,6 +160,47 @@ namespace WBFL
          static void NotifyAllListeners();
       };
 
+      /// @brief Automatic object that defines the LRFD specification edition and units for the calling thread.
+      /// While a context is in scope, BDSManager::GetEdition() and BDSManager::GetUnits() return the
+      /// context values on the thread that created it. All other threads continue to use their own
+      /// context, or the global settings if they don't have one. Contexts may be nested; the most recently
+      /// created context is in effect until it goes out of scope.
+      ///
+      /// Contexts do not change the global settings and BDSManagerListener objects are not notified.
+      /// Losses objects compare the edition and units they were computed with to those in effect when
+      /// results are requested and recompute as needed. Other objects that cache edition dependent results
+      /// should not be shared between contexts.
+      /// Contexts must be destroyed in the reverse order of creation on the thread that created them.
+      class LRFDCLASS BDSContext
+      {
+      public:
+         /// @brief Creates a context with the specified edition and units.
+         /// If the edition is 4th Edition 2007 or later, the units are forced to US.
+         BDSContext(BDSManager::Edition edition, BDSManager::Units units = BDSManager::Units::US);
+
+         /// @brief Creates a context with the edition and units currently in effect on the calling thread.
+         BDSContext();
+
+         BDSContext(const BDSContext&) = delete;
+         BDSContext& operator=(const BDSContext&) = delete;
+
+         ~BDSContext();
+
+         /// @brief Returns the edition of this context
+         BDSManager::Edition GetEdition() const;
+
+         /// @brief Returns the units of this context
+         BDSManager::Units GetUnits() const;
+
+         /// @brief Returns the context in effect on the calling thread, or nullptr if the global settings are in effect
+         static const BDSContext* GetCurrent();
+
+      private:
+         BDSManager::Edition m_Edition;
+         BDSManager::Units m_Units;
+         const BDSContext* m_pPrevious;
+      };
+
       /// @brief Updates a specification reference number to the 8th Edition 2007 specification. 
       /// Chapter 5 of the 8th Edition 2017 specification was reorganized and the reference number for
       /// many of the specification articles changed. The changes are document in a "Crosswalk" appendix
@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////
+// LRFD - Utility library to support equations, methods, and procedures
+//        from the AASHTO LRFD Bridge Design Specification
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <LRFD\LrfdExp.h>
+#include <LRFD\Losses.h>
+#include <array>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace WBFL
+{
+   namespace LRFD
+   {
+      /// @brief Section properties, strand eccentricities, and loads at a point of interest for batch evaluation of prestress losses.
+      /// For gross section property analysis, the net properties are the same as the gross properties.
+      struct LossesSection
+      {
+         Float64 X = 0; ///< location along girder where losses are computed
+
+         WBFL::Geometry::Point2d epermRelease; ///< eccentricity of permanent strands with respect to CG of girder at release
+         WBFL::Geometry::Point2d epermFinal; ///< eccentricity of permanent strands with respect to CG of girder at final
+         WBFL::Geometry::Point2d etemp; ///< eccentricity of temporary strands with respect to CG of girder
+
+         Float64 Mdlg = 0; ///< dead load moment of girder only
+         std::vector<std::pair<Float64, Float64>> Madlg; ///< additional dead load on girder section (moment, elastic gain reduction factor)
+         std::vector<std::pair<Float64, Float64>> Msidl1; ///< superimposed dead loads, stage 1
+         std::vector<std::pair<Float64, Float64>> Msidl2; ///< superimposed dead loads, stage 2
+
+         // Transformed/Gross properties
+         Float64 Ag = 0;   ///< area of girder
+         Float64 Ybg = 0;  ///< centroid of girder measured from bottom
+         Float64 Ixx = 0;  ///< moment of inertia of girder
+         Float64 Iyy = 0;  ///< weak axis moment of inertia of girder
+         Float64 Ixy = 0;  ///< product of inertia of girder
+         Float64 Ac1 = 0;  ///< area of composite girder, stage 1
+         Float64 Ybc1 = 0; ///< centroid of composite girder measured from bottom, stage 1
+         Float64 Ic1 = 0;  ///< moment of inertia of composite girder, stage 1
+         Float64 Ac2 = 0;  ///< area of composite girder, stage 2
+         Float64 Ybc2 = 0; ///< centroid of composite girder measured from bottom, stage 2
+         Float64 Ic2 = 0;  ///< moment of inertia of composite girder, stage 2
+
+         // Net properties
+         Float64 An = 0;   ///< area of girder
+         Float64 Ybn = 0;  ///< centroid of girder measured from bottom
+         Float64 Ixxn = 0; ///< moment of inertia of girder
+         Float64 Iyyn = 0; ///< weak axis moment of inertia of girder
+         Float64 Ixyn = 0; ///< product of inertia of girder
+         Float64 Acn = 0;  ///< area of composite girder
+         Float64 Ybcn = 0; ///< centroid of composite girder measured from bottom
+         Float64 Icn = 0;  ///< moment of inertia of composite girder
+      };
+
+      /// @brief Evaluates prestress losses at many points of interest along a girder.
+      ///
+      /// The girder level parameters (materials, strands, times, loss method options) are given by a loss object that is not modified.
+      /// The loss object is copied for each section and the section data is applied to the copy. Sections are divided into contiguous ranges
+      /// that are evaluated concurrently (see WBFL::System::TaskPool). Within a range, the elastic shortening losses are computed
+      /// together with ElasticShortening::Evaluate.
+      ///
+      /// Worker threads use the specification edition and units that are in effect on the calling thread.
+      class LRFDCLASS BatchLosses
+      {
+      public:
+         /// @brief Loss stages. The losses at each stage are the time-dependent losses returned by the corresponding
+         /// PermanentStrand_xxx and TemporaryStrand_xxx methods of Losses
+         enum class Stage
+         {
+            BeforeTransfer,
+            AfterTransfer,
+            AtLifting,
+            AtShipping,
+            AfterTemporaryStrandInstallation,
+            BeforeTemporaryStrandRemoval,
+            AfterTemporaryStrandRemoval,
+            AfterDeckPlacement,
+            AfterSIDL,
+            Final
+         };
+         static constexpr IndexType nStages = 10;
+
+         /// @brief Losses at each section. Each column is contiguous with one value per section, in the order the sections were given.
+         struct Results
+         {
+            std::array<std::array<std::vector<Float64>, nStages>, 2> Losses; ///< time-dependent losses, indexed by [TEMPORARY_STRAND/PERMANENT_STRAND][Stage][section]
+            std::array<std::vector<Float64>, 2> ElasticShorteningLosses; ///< elastic shortening losses, indexed by [TEMPORARY_STRAND/PERMANENT_STRAND][section]
+            std::array<std::vector<Float64>, 2> Fcgp; ///< concrete stress at the level of the strands at transfer, indexed by [TEMPORARY_STRAND/PERMANENT_STRAND][section]
+
+            /// @brief Returns the loss column for a strand type and stage
+            const std::vector<Float64>& GetLosses(int strandType, Stage stage) const { return Losses[strandType][(IndexType)stage]; }
+         };
+
+         BatchLosses() = delete;
+         BatchLosses(const BatchLosses&) = delete;
+         ~BatchLosses() = delete;
+
+         BatchLosses& operator=(const BatchLosses&) = delete;
+
+         /// @brief Evaluates losses at each section.
+         /// @tparam T Loss method type
+         /// @param girder Girder level loss parameters. This object is copied for each section
+         /// @param vSections Section data at each point of interest
+         /// @param fnSection Optional function called after the section data is applied to the copy of the loss object for a section.
+         /// Use this function to set section data that is specific to a loss method, such as the deck properties of RefinedLosses2005.
+         /// @return Losses at each section
+         template <class T>
+         static Results Evaluate(const T& girder, const std::vector<LossesSection>& vSections, const std::type_identity_t<std::function<void(IndexType, T&)>>& fnSection = nullptr)
+         {
+            static_assert(std::is_base_of_v<Losses, T>, "T must be a Losses type");
+            std::vector<std::unique_ptr<Losses>> vLosses;
+            vLosses.reserve(vSections.size());
+            for (IndexType sectionIdx = 0; sectionIdx < vSections.size(); sectionIdx++)
+            {
+               auto losses = std::make_unique<T>(girder);
+               SetSection(*losses, vSections[sectionIdx]);
+               if (fnSection)
+               {
+                  fnSection(sectionIdx, *losses);
+               }
+               vLosses.emplace_back(std::move(losses));
+            }
+            return Evaluate(vLosses);
+         }
+
+         /// @brief Evaluates losses for a collection of loss objects that are fully defined, one per section.
+         /// The loss objects are updated and may be queried for additional results afterwards.
+         static Results Evaluate(const std::vector<std::unique_ptr<Losses>>& vLosses);
+
+         /// @brief Applies section data to a loss object.
+         static void SetSection(Losses& losses, const LossesSection& section);
+
+      private:
+         static void EvaluateRange(const std::vector<std::unique_ptr<Losses>>& vLosses, IndexType firstIdx, IndexType lastIdx, Results& results);
+      };
+   };
+};
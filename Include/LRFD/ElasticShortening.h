@@ -26,6 +26,7 @@
 #include <Lrfd\LrfdExp.h>
 #include <Lrfd\PsStrand.h>
 #include <GeomModel/Primitives.h>
+#include <vector>
 
 namespace WBFL
 {
@@ -121,6 +122,12 @@ namespace WBFL
          void    SetFcgpComputationMethod(FcgpComputationMethod m);
          FcgpComputationMethod GetFcgpComputationMethod() const;
 
+         /// @brief Computes the elastic shortening losses for a collection of sections, such as
+         /// the points of interest along a girder. The iterative fcgp computation is advanced for all
+         /// sections together until every section has converged. The results are identical to
+         /// those computed for each section individually.
+         static void Evaluate(std::vector<ElasticShortening>& vElasticShortening);
+
       private:
          mutable bool m_bUpdate;
          void Update() const;
@@ -182,6 +182,30 @@ namespace WBFL
          enum class NumLoadedLanes {One,TwoOrMore};
          enum class DeckType {Concrete,SteelGrid,FilledGrid,WoodPlank,
                         StressLaminated,SpikeLaminated,GlueLaminated};
+         enum class Effect {Moment,Shear,Reaction};
+
+         /// @brief Distribution factors for all locations, force effects, and number of loaded lanes for a girder
+         struct DFTable
+         {
+            /// @brief Factors for all strength, service, and extreme event limit states, indexed by [Location][Effect][NumLoadedLanes]
+            DFResult Strength[2][3][2];
+
+            /// @brief Factors for the fatigue limit states, one loaded lane, indexed by [Location][Effect]
+            DFResult Fatigue[2][3];
+
+            /// @brief Returns the distribution factor for a limit state. As with MomentDFEx, ShearDFEx, and ReactionDFEx, a default
+            /// DFResult is returned for fatigue limit states with two or more loaded lanes.
+            const DFResult& GetDF(Location loc, Effect effect, NumLoadedLanes numLanes, LimitState ls) const
+            {
+               if (ls == LimitState::FatigueI || ls == LimitState::FatigueII)
+               {
+                  static const DFResult none;
+                  return numLanes == NumLoadedLanes::One ? Fatigue[(int)loc][(int)effect] : none;
+               }
+
+               return Strength[(int)loc][(int)effect][(int)numLanes];
+            }
+         };
 
          virtual ~ILiveLoadDistributionFactor() = default;
 
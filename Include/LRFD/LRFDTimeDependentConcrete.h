@@ -126,6 +126,14 @@ namespace WBFL
          virtual Float64 GetCreepCoefficient(Float64 t,Float64 tla) const override;
          virtual std::unique_ptr<WBFL::Materials::ConcreteBaseCreepDetails> GetCreepCoefficientDetails(Float64 t,Float64 tla) const override;
 
+         // Returns the free shrinkage strain at each of the times in vTime. The specification edition
+         // and the time-independent factors are evaluated once for all times.
+         virtual std::vector<Float64> GetFreeShrinkageStrains(const std::vector<Float64>& vTime) const override;
+
+         // Returns the creep coefficients for all combinations of time and loading time. The specification edition
+         // and the time-independent factors are evaluated once for all times.
+         virtual std::vector<Float64> GetCreepCoefficients(const std::vector<Float64>& vTime,const std::vector<Float64>& vLoadingTime) const override;
+
          // Creates a clone of this object
          virtual std::unique_ptr<WBFL::Materials::ConcreteBase> CreateClone() const override;
 
@@ -227,6 +235,13 @@ namespace WBFL
          std::unique_ptr<WBFL::Materials::ConcreteBaseCreepDetails> GetCreepCoefficientBefore2005(Float64 t,Float64 tla) const;
          std::unique_ptr<WBFL::Materials::ConcreteBaseCreepDetails> GetCreepCoefficient2005(Float64 t,Float64 tla) const;
          std::unique_ptr<WBFL::Materials::ConcreteBaseCreepDetails> GetCreepCoefficient2015(Float64 t,Float64 tla) const;
+
+         std::vector<Float64> GetFreeShrinkageStrainsBefore2005(const std::vector<Float64>& vTime) const;
+         std::vector<Float64> GetFreeShrinkageStrains2005(const std::vector<Float64>& vTime) const;
+         std::vector<Float64> GetFreeShrinkageStrains2015(const std::vector<Float64>& vTime) const;
+         std::vector<Float64> GetCreepCoefficientsBefore2005(const std::vector<Float64>& vTime,const std::vector<Float64>& vLoadingTime) const;
+         std::vector<Float64> GetCreepCoefficients2005(const std::vector<Float64>& vTime,const std::vector<Float64>& vLoadingTime) const;
+         std::vector<Float64> GetCreepCoefficients2015(const std::vector<Float64>& vTime,const std::vector<Float64>& vLoadingTime) const;
       };
    };
 };
@@ -26,6 +26,9 @@
 
 #include <Lrfd\LrfdExp.h>
 #include <Lrfd\ILiveLoadDistributionFactor.h>
+#include <array>
+#include <memory>
+#include <optional>
 
 namespace WBFL
 {
@@ -74,6 +77,10 @@ namespace WBFL
       /// @brief Base class for common implementation of ILiveLoadDistributionFactor.
       /// This class implements template methods (Template Pattern) for computing
       /// live load distribution factors.  Derived classes provide the details.
+      ///
+      /// Lever rule and rigid method results are cached the first time they are computed because the same
+      /// results are used for moment, shear, reaction, and fatigue. The cache makes it unsafe to use a single object
+      /// from more than one thread at a time.
       class LRFDCLASS LiveLoadDistributionFactorBase : public ILiveLoadDistributionFactor, public LiveLoadDistributionFactorMixin
       {
       public:
@@ -106,6 +113,21 @@ namespace WBFL
 
          virtual ILiveLoadDistributionFactor::LeverRuleMethod DistributeByLeverRuleEx(Location loc,NumLoadedLanes numLanes, bool applyMpf) const;
 
+         /// @brief Distributes load to the exterior girder on this girder's side of the cross section by the rigid method.
+         /// One loaded lane loads lane 1, two or more loaded lanes loads lanes 2 through Nl.
+         ILiveLoadDistributionFactor::RigidMethod DistributeByRigidMethodEx(NumLoadedLanes numLanes, bool applyMpf) const;
+
+         /// @brief Computes the distribution factors for all locations, force effects, and number of loaded lanes in a single pass.
+         /// The results are the same as those from MomentDFEx, ShearDFEx, and ReactionDFEx.
+         DFTable GetDFTable() const;
+
+         /// @brief Computes the distribution factor tables for a collection of girders, typically every girder line in a cross section.
+         /// Girders are evaluated concurrently when there are enough of them (see WBFL::System::TaskPool). The BDSManager settings of the
+         /// calling thread are used by all threads.
+         /// @param vGirders Distribution factor calculators. An object must not be in the collection more than once.
+         /// @return Distribution factor tables in the same order as vGirders
+         static std::vector<DFTable> GetDFTables(const std::vector<std::unique_ptr<LiveLoadDistributionFactorBase>>& vGirders);
+
          virtual void SetRangeOfApplicability(RangeOfApplicabilityAction action,Int32 bridgeWideRangeOfApplicability) override;
 
          virtual RangeOfApplicabilityAction GetRangeOfApplicabilityAction() const override;
@@ -170,6 +192,13 @@ namespace WBFL
          virtual DFResult GetShearDF_Ext_Fatigue() const;
          virtual DFResult GetReactionDF_Ext_Fatigue() const;
          virtual DFResult GetReactionDF_Int_Fatigue() const;
+
+      private:
+         // Lever rule results by [Location][NumLoadedLanes][applyMpf][IgnoreMpfLeverRule()]
+         mutable std::array<std::optional<ILiveLoadDistributionFactor::LeverRuleMethod>, 16> m_LeverRuleCache;
+
+         // Rigid method results by [NumLoadedLanes][applyMpf]
+         mutable std::array<std::optional<ILiveLoadDistributionFactor::RigidMethod>, 4> m_RigidMethodCache;
       };
    };
 };
@@ -26,6 +26,7 @@
 
 #include <LRFD\LrfdExp.h>
 #include <Lrfd/BDSManagerListener.h>
+#include <Lrfd/BDSManager.h>
 #include <LRFD\PsStrand.h>
 #include <LRFD\ElasticShortening.h>
 #include <LRFD\CreepCoefficient.h>
@@ -46,6 +47,8 @@ namespace WBFL
       constexpr int WITH_ELASTIC_GAIN_REDUCTION = 0;
       constexpr int WITHOUT_ELASTIC_GAIN_REDUCTION = 1;
 
+      class BatchLosses;
+
       /// @brief An abstract class for prestress loss calculation methods
       class LRFDCLASS Losses : public BDSManagerListener
       {
@@ -401,14 +404,25 @@ namespace WBFL
       protected:
          bool m_bValidateParameters;
          mutable bool m_IsDirty;
+         mutable BDSManager::Edition m_Edition; // edition and units in effect when the losses were last computed
+         mutable BDSManager::Units m_Units;
          void Init();
 
+         // Returns true if the losses must be recomputed. In addition to input changes, the losses
+         // are out of date if the edition or units in effect on the calling thread differ from those used
+         // to compute them. This covers BDSContext changes, which do not notify BDSManagerListener objects.
+         bool IsDirty() const;
+
          void UpdateLosses() const;
          virtual void UpdateInitialLosses() const;
          virtual void UpdateRelaxationBeforeTransfer() const;
          virtual void UpdateElasticShortening() const;
          virtual void UpdatePostTensionLosses() const;
 
+         // Creates the elastic shortening model for the current input parameters. The
+         // initial relaxation must be computed before calling this method.
+         virtual ElasticShortening CreateElasticShortening() const;
+
          // Called by the framework to validate the parameters in this object
          // Throw XPsLosses-based exceptions of there are invalid parameters
          virtual void ValidateParameters() const = 0;
@@ -489,6 +503,7 @@ namespace WBFL
          bool m_bIgnoreInitialRelaxation; // if true, dfpR0 is not computed
 
          mutable WBFL::LRFD::ElasticShortening m_ElasticShortening;
+         mutable bool m_bElasticShorteningEvaluated; // if true, m_ElasticShortening was evaluated by BatchLosses and is used in the next update
 
          // array index is 0=temporary strand, 1 = permanent strand
          mutable std::array<Float64, 2> m_dfpR0; // initial relaxation
@@ -528,6 +543,7 @@ namespace WBFL
          mutable Float64 m_dfpAT; // total anchor set loss
          mutable Float64 m_La; // length of anchor set zone
 
+         friend BatchLosses;
       };
 
       inline void Losses::SetFpjPermanent(Float64 fpj) { m_FpjPerm = fpj; m_IsDirty = true; }
@@ -572,15 +588,15 @@ namespace WBFL
       inline void Losses::SetGdrMoment(Float64 Mdlg) { m_Mdlg = Mdlg; m_IsDirty = true; }
       inline Float64 Losses::GetGdrMoment() const { return m_Mdlg; }
       inline void Losses::SetAddlGdrMoment(const std::vector<std::pair<Float64, Float64>>& Madlg) { m_InputMadlg = Madlg; m_IsDirty = true; }
-      inline Float64 Losses::GetAddlGdrMoment() const { if (m_IsDirty) UpdateLosses();  return m_Madlg[WITH_ELASTIC_GAIN_REDUCTION]; }
+      inline Float64 Losses::GetAddlGdrMoment() const { if (IsDirty()) UpdateLosses();  return m_Madlg[WITH_ELASTIC_GAIN_REDUCTION]; }
       inline const std::vector<std::pair<Float64, Float64>>& Losses::GetAddlGdrMoment2() const { return m_InputMadlg; }
 
       inline void Losses::SetSidlMoment1(const std::vector<std::pair<Float64, Float64>>& Msidl) { m_InputMsidl1 = Msidl; m_IsDirty = true; }
-      inline Float64 Losses::GetSidlMoment1() const { if (m_IsDirty) UpdateLosses(); return m_Msidl1[WITH_ELASTIC_GAIN_REDUCTION]; }
+      inline Float64 Losses::GetSidlMoment1() const { if (IsDirty()) UpdateLosses(); return m_Msidl1[WITH_ELASTIC_GAIN_REDUCTION]; }
       inline const std::vector<std::pair<Float64, Float64>>& Losses::GetSidlMoment1_2() const { return m_InputMsidl1; }
 
       inline void Losses::SetSidlMoment2(const std::vector<std::pair<Float64, Float64>>& Msidl) { m_InputMsidl2 = Msidl; m_IsDirty = true; }
-      inline Float64 Losses::GetSidlMoment2() const { if (m_IsDirty) UpdateLosses();  return m_Msidl2[WITH_ELASTIC_GAIN_REDUCTION]; }
+      inline Float64 Losses::GetSidlMoment2() const { if (IsDirty()) UpdateLosses();  return m_Msidl2[WITH_ELASTIC_GAIN_REDUCTION]; }
       inline const std::vector<std::pair<Float64, Float64>>& Losses::GetSidlMoment2_2() const { return m_InputMsidl2; }
 
       inline void Losses::SetGirderLength(Float64 lg) { m_Lg = lg; m_IsDirty = true; }
@@ -56,6 +56,7 @@
 #include <LRFD\ApproximateLosses2005.h>
 #include <LRFD\NoncompositeApproximateLosses2005.h>
 #include <LRFD\RefinedLossesTxDOT2013.h> 
+#include <LRFD\BatchLosses.h>
 #include <LRFD\ElasticShortening.h>
 #include <LRFD\PsStrand.h>
 #include <LRFD\RebarPool.h>
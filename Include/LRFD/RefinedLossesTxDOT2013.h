@@ -136,7 +136,7 @@ namespace WBFL
          virtual void ValidateParameters() const override;
          virtual void UpdateLongTermLosses() const override;
          virtual void UpdateHaulingLosses() const override;
-         virtual void UpdateElasticShortening() const override;
+         virtual ElasticShortening CreateElasticShortening() const override;
 
          mutable Float64 m_dfpSR;
          mutable Float64 m_dfpCR;
@@ -130,6 +130,13 @@ namespace WBFL
          virtual Float64 GetCreepCoefficient(Float64 t,Float64 tla) const override;
          virtual std::unique_ptr<ConcreteBaseCreepDetails> GetCreepCoefficientDetails(Float64 t,Float64 tla) const override;
 
+         /// Returns the free shrinkage strain at each of the times in vTime. The correction factors are computed once for all times.
+         virtual std::vector<Float64> GetFreeShrinkageStrains(const std::vector<Float64>& vTime) const override;
+
+         /// Returns the creep coefficients for all combinations of time and loading time. The correction factors are computed once
+         /// for all times and the loading age factor is computed once for each loading time.
+         virtual std::vector<Float64> GetCreepCoefficients(const std::vector<Float64>& vTime,const std::vector<Float64>& vLoadingTime) const override;
+
          /// Creates a clone of this object
          virtual std::unique_ptr<ConcreteBase> CreateClone() const override;
 
@@ -179,6 +186,7 @@ namespace WBFL
 
          Float64 GetFr(Float64 t) const;
          Float64 ModE(Float64 fc,Float64 density) const;
+         Float64 GetLoadingAgeFactor(Float64 age_at_loading) const;
       };
    };
 };
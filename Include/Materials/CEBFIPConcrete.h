@@ -149,6 +149,14 @@ namespace WBFL
          virtual Float64 GetCreepCoefficient(Float64 t,Float64 tla) const override;
          virtual std::unique_ptr<ConcreteBaseCreepDetails> GetCreepCoefficientDetails(Float64 t,Float64 tla) const override;
 
+         /// Returns the free shrinkage strain at each of the times in vTime. The notional shrinkage coefficient and
+         /// the member size term are computed once for all times.
+         virtual std::vector<Float64> GetFreeShrinkageStrains(const std::vector<Float64>& vTime) const override;
+
+         /// Returns the creep coefficients for all combinations of time and loading time. The humidity, strength, and member size
+         /// parameters are computed once for all times and the loading age term is computed once for each loading time.
+         virtual std::vector<Float64> GetCreepCoefficients(const std::vector<Float64>& vTime,const std::vector<Float64>& vLoadingTime) const override;
+
          /// Returns parameter H of the concrete model
          Float64 GetH() const;
 
@@ -26,6 +26,7 @@
 #include <Materials/MaterialsExp.h>
 #include <Materials/MaterialTypes.h>
 #include <memory>
+#include <vector>
 
 namespace WBFL
 {
@@ -137,6 +138,18 @@ namespace WBFL
          virtual Float64 GetCreepCoefficient(Float64 t,Float64 tla) const = 0;
          virtual std::unique_ptr<ConcreteBaseCreepDetails> GetCreepCoefficientDetails(Float64 t,Float64 tla) const = 0;
 
+         /// Returns the total free shrinkage that has occurred from time at casting to each of the times in vTime.
+         /// The default implementation calls GetFreeShrinkageStrain for each time. Subclasses override this method
+         /// to compute the time-independent parameters once for the entire time grid.
+         virtual std::vector<Float64> GetFreeShrinkageStrains(const std::vector<Float64>& vTime) const;
+
+         /// Returns the creep coefficients at each of the times in vTime for loadings applied at each of the times in vLoadingTime.
+         /// The creep coefficients are returned in row major order with one row per loading time. The creep coefficient
+         /// at time vTime[i] for a loading applied at time vLoadingTime[j] is at index j*vTime.size() + i.
+         /// The default implementation calls GetCreepCoefficient for each pair of times. Subclasses override this method
+         /// to compute the time-independent parameters once for the entire time grid.
+         virtual std::vector<Float64> GetCreepCoefficients(const std::vector<Float64>& vTime,const std::vector<Float64>& vLoadingTime) const;
+
          /// Creates a clone of this object
          virtual std::unique_ptr<ConcreteBase> CreateClone() const = 0;
 
@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////
+// Materials - Analytical and Product modeling of civil engineering materials
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Materials/MaterialsExp.h>
+#include <Materials/ConcreteBase.h>
+#include <memory>
+#include <vector>
+
+namespace WBFL
+{
+   namespace Materials
+   {
+      /// Measures of how well a DirichletSeriesCreepFunction fits the creep coefficient of the concrete model it approximates.
+      /// The errors are differences between the fitted and the actual creep coefficient at the samples used for the fit.
+      struct MATCLASS DirichletSeriesCreepFitQuality
+      {
+         IndexType nSamples{ 0 }; ///< Number of samples of the creep coefficient used for the fit
+         Float64 RMSError{ 0 }; ///< Root-mean-square error
+         Float64 MaxError{ 0 }; ///< Maximum absolute error
+         Float64 MaxErrorTime{ 0 }; ///< Time at which the maximum error occurs
+         Float64 MaxErrorLoadingTime{ 0 }; ///< Loading time at which the maximum error occurs
+         Float64 MaxCreepCoefficient{ 0 }; ///< Largest sampled creep coefficient. Use this to scale the errors.
+      };
+
+      /// Approximation of the creep coefficient of a concrete model by a Dirichlet series (Kelvin chain)
+      ///
+      /// The creep coefficient for a loading applied at time tla is approximated as
+      /// C(t,tla) = sum{ a_k(tla)*(1 - exp(-(t-tla)/r_k)) } where r_k are the retardation times of the Kelvin units.
+      /// The coefficients a_k are fit, by non-negative least squares, to the creep coefficient of the concrete model
+      /// for each loading time. Coefficients for other loading times are linearly interpolated.
+      ///
+      /// The exponential form of the series lets creep be computed from a few state variables per Kelvin unit
+      /// instead of from the entire stress history. See DirichletSeriesCreepIntegrator.
+      class MATCLASS DirichletSeriesCreepFunction
+      {
+      public:
+         /// Fits the series to the creep coefficient of a concrete model.
+         /// \param concrete the concrete model
+         /// \param vLoadingTimes times at which the series is fit to the creep coefficient (days).
+         /// \param vRetardationTimes retardation times of the Kelvin units (days). If empty, the default retardation times are used.
+         /// \param maxDuration longest duration of loading over which the series is fit (days)
+         /// \param nSamples number of samples of the creep coefficient, for each loading time, used for the fit
+         DirichletSeriesCreepFunction(const ConcreteBase& concrete, const std::vector<Float64>& vLoadingTimes, const std::vector<Float64>& vRetardationTimes = std::vector<Float64>(), Float64 maxDuration = 10000.0, IndexType nSamples = 50);
+
+         DirichletSeriesCreepFunction(const DirichletSeriesCreepFunction&) = default;
+         DirichletSeriesCreepFunction& operator=(const DirichletSeriesCreepFunction&) = default;
+
+         /// Returns the default retardation times. They are spaced by a factor of 10 from 0.1 to 10000 days.
+         static std::vector<Float64> GetDefaultRetardationTimes();
+
+         /// Returns the number of Kelvin units in the series
+         IndexType GetUnitCount() const;
+
+         /// Returns the retardation times of the Kelvin units
+         const std::vector<Float64>& GetRetardationTimes() const;
+
+         /// Returns the loading times at which the series was fit
+         const std::vector<Float64>& GetLoadingTimes() const;
+
+         /// Returns the coefficients of the Kelvin units for a loading applied at time tla.
+         /// vCoefficients is resized to the number of Kelvin units.
+         void GetCoefficients(Float64 tla, std::vector<Float64>& vCoefficients) const;
+
+         /// Returns the approximate creep coefficient at time t for a loading applied at time tla
+         Float64 GetCreepCoefficient(Float64 t, Float64 tla) const;
+
+         /// Returns the quality of the fit
+         const DirichletSeriesCreepFitQuality& GetFitQuality() const;
+
+      private:
+         std::vector<Float64> m_vRetardationTimes;
+         std::vector<Float64> m_vLoadingTimes;
+         std::vector<Float64> m_vCoefficients; // [loading time][Kelvin unit]
+         DirichletSeriesCreepFitQuality m_FitQuality;
+      };
+
+      /// Step-by-step creep strain integrator based on a DirichletSeriesCreepFunction
+      ///
+      /// The integrator keeps one state variable per Kelvin unit so advancing time and adding a strain increment
+      /// are O(1) in the number of time steps. The creep strain at time t is
+      /// sum{ de_j * C(t,t_j) } where de_j is the initial strain increment applied at time t_j.
+      /// Typically de_j is the change in stress at t_j divided by the modulus of elasticity used with the creep coefficient.
+      ///
+      /// Use one integrator per element or fiber. The creep function is shared.
+      class MATCLASS DirichletSeriesCreepIntegrator
+      {
+      public:
+         DirichletSeriesCreepIntegrator(std::shared_ptr<const DirichletSeriesCreepFunction> creepFunction, Float64 t = 0.0);
+
+         /// Resets the integrator to having no strain history at time t
+         void Reset(Float64 t = 0.0);
+
+         /// Returns the current time
+         Float64 GetTime() const;
+
+         /// Returns the creep strain that will occur between the current time and time t due to the strain history.
+         /// The state of the integrator is not changed.
+         Float64 GetCreepStrainIncrement(Float64 t) const;
+
+         /// Advances the state of the integrator to time t. Time cannot go backwards.
+         void Advance(Float64 t);
+
+         /// Adds an initial strain increment at the current time
+         void AddStrainIncrement(Float64 de);
+
+         /// Returns the total creep strain at the current time
+         Float64 GetCreepStrain() const;
+
+      private:
+         std::shared_ptr<const DirichletSeriesCreepFunction> m_CreepFunction;
+         Float64 m_Time;
+         std::vector<Float64> m_vUltimate; // sum of de_j*a_k(t_j) - creep strain of each Kelvin unit at infinite time
+         std::vector<Float64> m_vRemaining; // sum of de_j*a_k(t_j)*exp(-(t-t_j)/r_k) - creep strain yet to occur in each Kelvin unit
+         std::vector<Float64> m_vCoefficients; // scratch space for the coefficients of the creep function
+      };
+   };
+};
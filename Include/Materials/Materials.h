@@ -34,6 +34,7 @@
 #include <Materials/ConcreteBase.h>
 #include <Materials/ACI209Concrete.h>
 #include <Materials/CEBFIPConcrete.h>
+#include <Materials/DirichletSeriesCreep.h>
 #include <Materials/PsStrand.h>
 #include <Materials/Rebar.h>
 #include <Materials/StressStrainModel.h>
@@ -76,6 +76,13 @@ namespace WBFL
          /// \param[in] bIgnoreConfigurationLimits If true the clear span, leading overhang, and max weight limits are ignored
          bool Passed(bool bIgnoreConfigurationLimits) const;
 
+         /// Returns true if the hauling check is successful for the given results and criteria.
+         /// This is the same as Passed(bIgnoreConfigurationLimits) without creating an artifact.
+         static bool Passed(const HaulingResults& results, const HaulingCriteria& criteria, bool bIgnoreConfigurationLimits);
+
+         /// Returns true if the clear span, leading overhang, and max weight checks pass for the given results and criteria
+         static bool PassedConfigurationLimits(const HaulingResults& results, const HaulingCriteria& criteria);
+
          /// Returns true if the hauling check passed for the specified roadway slope type
          bool Passed(HaulingSlope slope) const;
 
@@ -39,10 +39,64 @@
 
 #include <WBFLGenericBridge.h>
 
+#include <optional>
+
 namespace WBFL
 {
    namespace Stability
    {
+      /// Defines a range of support locations that are evaluated to find the optimum lifting point or bunk point location
+      struct SupportLocationSweep
+      {
+         /// Defines which support locations are varied
+         enum class Support { Both, Left, Right };
+
+         Support MovingSupport = Support::Both; ///< Support locations that are varied. A support that isn't varied remains at the location defined by the stability problem
+         Float64 Start = 0; ///< First support location, measured from the end of the girder
+         Float64 End = 0; ///< Last support location, measured from the end of the girder
+         IndexType nLocations = 11; ///< Number of equally spaced support locations evaluated from Start to End, inclusive (must be at least 2)
+         Float64 Tolerance = 0; ///< The optimum support location is refined until it is known within this tolerance. If zero, the tolerance is 1% of the spacing between support locations
+      };
+
+      /// Results of a support location sweep
+      struct SupportLocationSweepResults
+      {
+         std::vector<std::pair<Float64, Float64>> FS; ///< Minimum factor of safety at each support location in the sweep. The pair is (support location, FS)
+         Float64 OptimumLocation = 0; ///< Support location with the greatest minimum factor of safety
+         Float64 OptimumFS = 0; ///< Minimum factor of safety at the optimum support location
+         IndexType nEvaluations = 0; ///< Total number of stability analyses performed
+      };
+
+      /// Hauling criteria and truck parameters used in a batch hauling check.
+      /// Truck parameters that are not given are taken from the hauling stability problem.
+      struct HaulingCriteriaVariant
+      {
+         HaulingCriteria Criteria; ///< Hauling check criteria
+         std::optional<Float64> RotationalStiffness; ///< Rotational stiffness of the truck (Ktheta)
+         std::optional<Float64> SupportWidth; ///< Center-to-center wheel spacing (Wcc)
+         std::optional<Float64> HeightOfRollAxis; ///< Height of the roll axis above the roadway
+      };
+
+      /// A girder and hauling stability problem checked in a batch hauling check
+      struct HaulingCheckItem
+      {
+         const IGirder* pGirder = nullptr;
+         const IHaulingStabilityProblem* pStabilityProblem = nullptr;
+      };
+
+      /// Compact result of a batch hauling check for one girder and criteria variant
+      struct HaulingCheckRecord
+      {
+         IndexType ItemIndex = INVALID_INDEX; ///< Index of the girder and hauling stability problem
+         IndexType VariantIndex = INVALID_INDEX; ///< Index of the criteria variant
+         bool bPassed = false; ///< True if the hauling check passed, not including the clear span, leading overhang, and max weight limits
+         bool bPassedConfigurationLimits = false; ///< True if the clear span, leading overhang, and max weight limits are satisfied
+         Float64 MinFScr = 0; ///< Minimum factor of safety against cracking for both hauling slope cases
+         Float64 MinFsFailure = 0; ///< Minimum adjusted factor of safety against failure for both hauling slope cases
+         Float64 MinFsRollover = 0; ///< Minimum factor of safety against rollover for both hauling slope cases
+         HaulingSlope ControllingSlope = HaulingSlope::CrownSlope; ///< Hauling slope case with the least factor of safety
+         std::shared_ptr<HaulingCheckArtifact> Artifact; ///< Complete check artifact. Only created when requested.
+      };
 
       /// Performs stability analysis for precast-prestressed concrete bridge girders
       class STABILITYCLASS StabilityEngineer
@@ -73,6 +127,33 @@ namespace WBFL
          /// Performs a stress and stability analysis and compares the results to a set of criteria for the seated at one end condition
          OneEndSeatedCheckArtifact CheckOneEndSeated(const IGirder* pGirder, const IOneEndSeatedStabilityProblem* pStabilityProblem, const OneEndSeatedCriteria& criteria) const;
 
+         /// Checks many girders for many hauling criteria variants.
+         /// A hauling analysis is performed once for each girder and unique set of truck parameters and the results are
+         /// checked against all variants having those truck parameters. The work is distributed over several threads.
+         /// The girders and stability problems are only read and must not be modified during the check.
+         /// \param vItems Girders and hauling stability problems to be checked
+         /// \param vVariants Hauling criteria variants. Every girder is checked for every variant.
+         /// \param bCreateArtifacts If true, the complete check artifact is created for every record
+         /// \return Check records ordered by item and then by variant
+         std::vector<HaulingCheckRecord> CheckHauling(const std::vector<HaulingCheckItem>& vItems, const std::vector<HaulingCriteriaVariant>& vVariants, bool bCreateArtifacts = false) const;
+
+         /// Performs lifting analyses over a range of lifting point locations and finds the location with the greatest minimum factor of safety.
+         /// The minimum factor of safety is the lesser of FScrMin and MinAdjFsFailure. Support locations are evaluated concurrently with independent
+         /// analysis models so the girder and stability problem must be safe for concurrent reads. The optimum location is refined with a golden-section search
+         /// between the neighbors of the best location in the sweep. Each support location is analyzed with the analysis points of the stability problem
+         /// plus analysis points at the supports and at the midpoint between the supports.
+         SupportLocationSweepResults SweepLifting(const IGirder* pGirder, const ILiftingStabilityProblem* pStabilityProblem, const SupportLocationSweep& sweep) const;
+
+         /// Performs hauling analyses over a range of bunk point locations and finds the location with the greatest minimum factor of safety.
+         /// The minimum factor of safety is the least of MinFScr, MinAdjFsFailure, and MinFsRollover for both hauling slope conditions.
+         /// See SweepLifting for details.
+         SupportLocationSweepResults SweepHauling(const IGirder* pGirder, const IHaulingStabilityProblem* pStabilityProblem, const SupportLocationSweep& sweep) const;
+
+         /// Performs seated at one end analyses over a range of support locations and finds the location with the greatest minimum factor of safety.
+         /// The minimum factor of safety is the least of MinFScr, MinAdjFsFailure, and MinFsRollover.
+         /// See SweepLifting for details.
+         SupportLocationSweepResults SweepOneEndSeated(const IGirder* pGirder, const IOneEndSeatedStabilityProblem* pStabilityProblem, const SupportLocationSweep& sweep) const;
+
       private:
          CComPtr<IRebarFactory> m_RebarFactory;
 
@@ -81,12 +162,27 @@ namespace WBFL
          mutable PoiIDType m_FirstPoi, m_LastPoi; // first and last poiIDs used for computing Zo
          mutable std::vector<Float64> m_vPoi; // location of POIs used for computing Zo
 
+         // Results of the unit loadings, extracted from the FEM model in a single pass after the stiffness
+         // matrix is factored and all loadings are solved. Every impact, wind, and centrifugal force
+         // combination is a linear multiple of these results.
+         struct UnitLoadResults
+         {
+            std::vector<Float64> Mg;  // moment due to girder self-weight at each analysis point
+            std::vector<Float64> Mw;  // moment due to wind at each analysis point
+            std::vector<Float64> Mcf; // moment due to centrifugal force at each analysis point (not used for lifting)
+            std::vector<Float64> Dy;  // deflection due to girder self-weight at each POI in m_vPoi (only used for computing Zo)
+         };
+         mutable UnitLoadResults m_UnitLoadResults;
+
          // General initialization of the results object
          void PrepareResults(const IGirder* pGirder, const IStabilityProblem* pStabilityProblem, Results& results) const;
 
          // builds the FEM model
          void BuildModel(const IGirder* pGirder, const IStabilityProblem* pStabilityProblem, Results& results, IFem2dModel** ppModel) const;
 
+         // extracts the results of all unit loadings from the FEM model
+         void ExtractUnitLoadResults(const IStabilityProblem* pStabilityProblem, IFem2dModel* pModel, Results& results) const;
+
          // Common analysis code
          void Analyze(const IGirder* pGirder, const IStabilityProblem* pStabilityProblem, Results& results, IFem2dModel** ppModel) const;
 
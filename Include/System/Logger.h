@@ -24,6 +24,7 @@
 #pragma once
 
 #include <System\SysExp.h>
+#include <atomic>
 #include <strstream>
 
 namespace WBFL
@@ -45,6 +46,10 @@ namespace WBFL
          /// @param stream 
          static std::ostream* SetOutput(std::ostream* stream);
 
+         /// @brief Returns the output stream for logging
+         /// @return 
+         static std::ostream* GetOutput();
+
          /// @brief Sets the logging verbosity. Any messages with a Severity at this level or greater are logged.
          /// @param verbosity 
          static void Verbosity(Severity verbosity);
@@ -57,6 +62,31 @@ namespace WBFL
          /// @return 
          static Severity MaxVerbosity();
 
+         /// @brief Returns true if messages with the specified severity are logged. Use this to avoid
+         /// formatting messages that would be discarded.
+         /// @param type 
+         /// @return 
+         static bool IsLogged(Severity type) { return verbosity.load(std::memory_order_relaxed) <= type; }
+
+         /// @brief Enables or disables asynchronous logging. Asynchronous messages are queued without blocking
+         /// the caller and written in batches by a background thread. When the queue is full, messages are
+         /// dropped and the number of dropped messages is reported in the log. Disabling asynchronous logging writes
+         /// all queued messages. This must not be called while other threads are logging.
+         /// @param bAsync 
+         /// @param queueSize Maximum number of messages waiting to be written
+         static void EnableAsync(bool bAsync, IndexType queueSize = 8192);
+
+         /// @brief Returns true if asynchronous logging is enabled
+         /// @return 
+         static bool IsAsync();
+
+         /// @brief Waits for all queued messages to be written and flushes the output stream
+         static void Flush();
+
+         /// @brief Returns the number of messages that were dropped because the asynchronous message queue was full
+         /// @return 
+         static Uint64 GetDroppedMessageCount();
+
          static void Message(Severity type, const std::wstring& message);
          static void Info(const std::wstring& message) { Message(Severity::Info, message); }
          static void Debug(const std::wstring& message) { Message(Severity::Debug, message); }
@@ -70,10 +100,13 @@ namespace WBFL
          static void Error(const std::string& message) { Message(Severity::Error, message); }
 
       private:
-         static std::ostream* log;
+         static std::atomic<std::ostream*> log;
+
+         static std::atomic<Severity> verbosity;
+         static std::atomic<Severity> max_severity;
 
-         static Severity verbosity;
-         static Severity max_severity;
+         static bool Accept(Severity type);
+         static void Write(Severity type, std::string&& message);
       };
    };
 };
@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////
+// System - WBFL low level system services
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <System\SysExp.h>
+#include <System\IStructuredLoad.h>
+#include <System\XStructuredLoad.h>
+#include <iosfwd>
+#include <memory>
+
+#include <System/Debug.h>
+
+
+namespace WBFL
+{
+   namespace System
+   {
+      class StructuredLoadBinary_Impl;
+
+      /// This class implements the IStructuredLoad interface for the binary format written by
+      /// StructuredSaveBinary. Data converted from xml with StructuredStorageConverter can also
+      /// be read. Property values are converted to the requested type when it differs from
+      /// the type that was written.
+      /// 
+      /// Property methods try to read a property at the
+      /// current file pointer location. If the function returns true, the property
+      /// was read and the file pointer advances. If the function returns false,
+      /// the property was not at the current location and the file pointer does not
+      /// advance.
+      class SYSCLASS StructuredLoadBinary : public IStructuredLoad
+      {
+      public:
+         /// Open with an empty stream.
+         StructuredLoadBinary();
+         StructuredLoadBinary(const StructuredLoadBinary&) = delete;
+         virtual ~StructuredLoadBinary();
+
+         StructuredLoadBinary& operator=(const StructuredLoadBinary&) = delete;
+
+         /// Initializes the structured load object before reading from a stream.
+         /// Call this method before calling any other method of this class.
+         /// The stream must be opened in binary mode. It must also be seekable
+         /// if GetUnit is used.
+         void BeginLoad(std::istream* pis);
+
+         /// Call this method after you are done with your structured load
+         void EndLoad();
+
+         /// Check for the Beginning of a named structured data unit. If true is 
+         /// returned, the beginning of the unit was found and the file pointer is
+         /// advanced. If false is returned, the file pointer does not advance.
+         /// After a unit has been entered, GetVersion may be called to get its
+         /// version
+         virtual bool BeginUnit(LPCTSTR name) override;
+
+         /// Check for the end of a structured data chunk that was started by a call to BeginUnit.
+         virtual bool EndUnit() override;
+
+         /// Get the version number of the current unit
+         virtual Float64 GetVersion() override;
+
+         /// Get the version number of the unit that is the parent to this unit
+         virtual Float64 GetParentVersion() override;
+
+         /// Get the name of the unit that is the parent to this unit
+         virtual std::_tstring GetParentUnit() override;
+
+         /// Get the version number of the top-most unit
+         virtual Float64 GetTopVersion() override;
+
+         /// Read a string property
+         virtual bool Property(LPCTSTR name, std::_tstring* pvalue) override;
+
+         /// Read a real number property
+         virtual bool Property(LPCTSTR name, Float64* pvalue) override;
+
+         /// Read an integral property
+         virtual bool Property(LPCTSTR name, Int16* pvalue) override;
+
+         /// Read an unsigned integral property
+         virtual bool Property(LPCTSTR name, Uint16* pvalue) override;
+
+         /// Read an integral property
+         virtual bool Property(LPCTSTR name, Int32* pvalue) override;
+
+         /// Read an unsigned integral property
+         virtual bool Property(LPCTSTR name, Uint32* pvalue) override;
+
+         /// Read an integral property
+         virtual bool Property(LPCTSTR name, Int64* pvalue) override;
+
+         /// Read an unsigned integral property
+         virtual bool Property(LPCTSTR name, Uint64* pvalue) override;
+
+         /// Read an integral property
+         virtual bool Property(LPCTSTR name, LONG* pvalue) override;
+
+         /// Read an unsigned integral property
+         virtual bool Property(LPCTSTR name, ULONG* pvalue) override;
+
+         /// Read a bool property
+         virtual bool Property(LPCTSTR name, bool* pvalue) override;
+
+         /// Am I at the end of the "File"?
+         virtual bool Eof() const override;
+
+         /// Dump state as a text string. This is primarily to be used for error handling.
+         virtual std::_tstring GetStateDump() const override;
+
+         /// Returns the current unit as xml text
+         virtual std::_tstring GetUnit() const override;
+
+      private:
+         std::unique_ptr<StructuredLoadBinary_Impl> m_pImp;
+      };
+   };
+};
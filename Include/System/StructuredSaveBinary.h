@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////
+// System - WBFL low level system services
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <System/SysExp.h>
+#include <System/IStructuredSave.h>
+#include <System/XStructuredSave.h>
+#include <iosfwd>
+#include <memory>
+
+#include <System/Debug.h>
+
+
+namespace WBFL
+{
+   namespace System
+   {
+      class StructuredSaveBinary_Impl;
+
+      /// This class implements the IStructuredSave interface for a compact binary format.
+      /// Unit and property names are written once and referred to by index thereafter,
+      /// numbers are written in their native binary form, and the data can optionally be
+      /// compressed. The implementation is portable standard C++ and does not use COM.
+      /// Use StructuredStorageConverter to convert between the binary and xml formats.
+      class SYSCLASS StructuredSaveBinary : public IStructuredSave
+      {
+      public:
+         StructuredSaveBinary();
+         StructuredSaveBinary(const StructuredSaveBinary&) = delete;
+         virtual ~StructuredSaveBinary();
+
+         StructuredSaveBinary& operator=(const StructuredSaveBinary&) = delete;
+
+         /// Initializes the structured save object before writing a stream.
+         /// Call this method before calling any other method of this class.
+         /// The stream must be opened in binary mode. If bCompress is true
+         /// the data is compressed as it is written.
+         void BeginSave(std::ostream* pos, bool bCompress = false);
+
+         /// Call this method after you are done with your structured save
+         void EndSave();
+
+         /// Mark the Beginning of a structured data chunk. This call must be always
+         /// balanced by a corresponding call to EndUnit. An optional version number
+         /// may be used to tag major units.
+         /// Version 0.0 means no version was attached.
+         virtual void BeginUnit(LPCTSTR name, Float64 version=0.0) override;
+
+         /// Mark the end of a structured data chunk that was started by a call to 
+         /// BeginUnit.
+         virtual void EndUnit() override;
+
+         /// Get the version number of the current unit
+         virtual Float64 GetVersion() override;
+
+         /// Get the version number of the unit that is the parent to this unit
+         virtual Float64 GetParentVersion();
+
+         /// Get the name of the unit that is the parent to this unit
+         virtual std::_tstring GetParentUnit();
+
+         /// Get the version number of the top-most unit
+         virtual Float64 GetTopVersion() override;
+
+         /// Write a string property
+         virtual void Property(LPCTSTR name, LPCTSTR value) override;
+
+         /// Write a real number property
+         virtual void Property(LPCTSTR name, Float64 value) override;
+
+         /// Write an integral property
+         virtual void Property(LPCTSTR name, Int16 value) override;
+
+         /// Write an unsigned integral property
+         virtual void Property(LPCTSTR name, Uint16 value) override;
+
+         /// Write an integral property
+         virtual void Property(LPCTSTR name, Int32 value) override;
+
+         /// Write an unsigned integral property
+         virtual void Property(LPCTSTR name, Uint32 value) override;
+
+         /// Write an integral property
+         virtual void Property(LPCTSTR name, Int64 value) override;
+
+         /// Write an unsigned integral property
+         virtual void Property(LPCTSTR name, Uint64 value) override;
+
+         /// Write an unsigned integral property
+         virtual void Property(LPCTSTR name, LONG value) override;
+
+         /// Write an unsigned integral property
+         virtual void Property(LPCTSTR name, ULONG value) override;
+
+         /// Write a bool property
+         virtual void Property(LPCTSTR name, bool value) override;
+
+         /// Write a unit given as xml text, such as the text returned by IStructuredLoad::GetUnit.
+         /// Property values in the xml are written as strings.
+         virtual void PutUnit(LPCTSTR xml);
+
+      private:
+         std::unique_ptr<StructuredSaveBinary_Impl> m_pImp;
+      };
+   };
+};
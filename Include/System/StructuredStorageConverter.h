@@ -0,0 +1,57 @@
+///////////////////////////////////////////////////////////////////////
+// System - WBFL low level system services
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <System\SysExp.h>
+#include <iosfwd>
+
+namespace WBFL
+{
+   namespace System
+   {
+      /// Converts structured storage data between the xml format of StructuredSaveXml/StructuredLoadXml
+      /// and the binary format of StructuredSaveBinary/StructuredLoadBinary.
+      ///
+      /// Xml property values are untyped text so they are stored as strings in the binary format.
+      /// StructuredLoadBinary converts strings to the requested type when they are read, so converted
+      /// data loads the same way as data written directly with StructuredSaveBinary.
+      class SYSCLASS StructuredStorageConverter
+      {
+      public:
+         StructuredStorageConverter() = delete;
+         StructuredStorageConverter(const StructuredStorageConverter&) = delete;
+         ~StructuredStorageConverter() = delete;
+
+         StructuredStorageConverter& operator=(const StructuredStorageConverter&) = delete;
+
+         /// Converts UTF-8 xml to the binary format. The binary stream must be opened in binary mode.
+         /// Throws XStructuredLoad if the xml cannot be read and XStructuredSave if the binary data cannot be written.
+         static void XmlToBinary(std::istream& xml, std::ostream& binary, bool bCompress = false);
+
+         /// Converts binary data to UTF-8 xml. The binary stream must be opened in binary mode.
+         /// Throws XStructuredLoad if the binary data cannot be read and XStructuredSave if the xml cannot be written.
+         static void BinaryToXml(std::istream& binary, std::ostream& xml);
+      };
+   };
+};
@@ -47,12 +47,18 @@
 #include <System\NumericFormatTool.h>
 #include <System\SectionValue.h>
 #include <System\SingletonKiller.h>
+#include <System\StructuredLoadBinary.h>
+#include <System\StructuredLoadXmlStream.h>
 #include <System\StructuredLoadXml.h>
+#include <System\StructuredSaveBinary.h>
 #include <System\StructuredSaveXml.h>
+#include <System\StructuredStorageConverter.h>
 #include <System\SubjectT.h>
+#include <System\TaskPool.h>
 #include <System\Tokenizer.h>
 #include <System\Time.h>
 #include <System\Threads.h>
+#include <System\Trace.h>
 #include <SYstem\XProgrammingError.h>
 #include <System\XStructuredLoad.h>
 #include <System\XStructuredSave.h>
@@ -0,0 +1,164 @@
+///////////////////////////////////////////////////////////////////////
+// System - WBFL low level system services
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <System\SysExp.h>
+#include <System\Checks.h>
+#include <System\Threads.h>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace WBFL
+{
+   namespace System
+   {
+      class TaskGroup_Impl;
+
+      /// A set of tasks that are executed by the TaskPool. Wait blocks until all the tasks have completed.
+      /// While it waits, the calling thread executes pending tasks of this group, and of task groups created by its tasks,
+      /// so task groups can be nested (a task can create and wait on its own task group) without blocking worker threads.
+      /// Tasks of unrelated groups are never run by a waiting thread.
+      ///
+      /// A task runs in a worker thread or in the thread that waits on its group. It must not depend on thread local state,
+      /// such as a COM apartment or an LRFD BDSContext, that it does not establish itself.
+      class SYSCLASS TaskGroup
+      {
+      public:
+         TaskGroup();
+         TaskGroup(const TaskGroup&) = delete;
+
+         /// Waits for any tasks that are still running. Exceptions thrown by the tasks are discarded.
+         ~TaskGroup();
+
+         TaskGroup& operator=(const TaskGroup&) = delete;
+
+         /// Queues a task for execution
+         void Run(std::function<void()>&& task);
+
+         /// Waits for all queued tasks to complete. If a task threw an exception,
+         /// the first exception is rethrown after all the tasks have completed.
+         void Wait();
+
+      private:
+         std::unique_ptr<TaskGroup_Impl> m_pImp;
+      };
+
+      /// Process-wide pool of worker threads. Each worker has its own task queue and takes work
+      /// from the queues of other workers when its queue is empty.
+      ///
+      /// The parallel algorithms divide a range of items into chunks. The calling thread executes the first chunk
+      /// and the pool executes the rest. The number of items in a chunk depends only on the number of items
+      /// and the grain size, never on the number of threads, so ParallelReduce combines the same partial
+      /// results in the same order on every machine.
+      class SYSCLASS TaskPool
+      {
+      public:
+         TaskPool() = delete;
+         TaskPool(const TaskPool&) = delete;
+         ~TaskPool() = delete;
+
+         TaskPool& operator=(const TaskPool&) = delete;
+
+         /// Sets the maximum number of threads, including the calling thread, that execute tasks.
+         /// Zero uses the number of hardware threads, which is the default. One executes all tasks in the thread that waits on them.
+         /// Must not be called while tasks are running.
+         static void SetConcurrency(IndexType nThreads);
+         static IndexType GetConcurrency();
+
+         /// Returns true if the calling thread is a worker thread of the pool
+         static bool IsWorkerThread();
+
+         /// Returns the number of items in each chunk when nItems are divided for parallel execution.
+         /// If grainSize is zero, the minimum chunk size is Threads::GetMinItemsPerThread().
+         static IndexType GetChunkSize(IndexType nItems, IndexType grainSize = 0);
+
+         /// Calls f(begin,end) for chunks of the range [first,last) in parallel
+         template <class F>
+         static void ParallelFor(IndexType first, IndexType last, F&& f, IndexType grainSize = 0);
+
+         /// Calls map(begin,end) for chunks of the range [first,last) in parallel. Returns
+         /// reduce(...reduce(reduce(init,map(chunk0)),map(chunk1))...,map(chunkN)). The partial results
+         /// are always reduced in chunk order.
+         template <class T, class Map, class Reduce>
+         static T ParallelReduce(IndexType first, IndexType last, T init, Map&& map, Reduce&& reduce, IndexType grainSize = 0);
+      };
+
+      template <class F>
+      void TaskPool::ParallelFor(IndexType first, IndexType last, F&& f, IndexType grainSize)
+      {
+         PRECONDITION(first <= last);
+         IndexType nItems = last - first;
+         if (nItems == 0)
+            return;
+
+         IndexType chunkSize = GetChunkSize(nItems, grainSize);
+         if (nItems <= chunkSize || GetConcurrency() < 2)
+         {
+            f(first, last);
+            return;
+         }
+
+         TaskGroup group;
+         for (IndexType begin = first + chunkSize; begin < last; begin += chunkSize)
+         {
+            IndexType end = (last - begin < chunkSize ? last : begin + chunkSize);
+            group.Run([&f, begin, end] {f(begin, end); });
+         }
+
+         f(first, first + chunkSize);
+         group.Wait();
+      }
+
+      template <class T, class Map, class Reduce>
+      T TaskPool::ParallelReduce(IndexType first, IndexType last, T init, Map&& map, Reduce&& reduce, IndexType grainSize)
+      {
+         PRECONDITION(first <= last);
+         IndexType nItems = last - first;
+         if (nItems == 0)
+            return init;
+
+         IndexType chunkSize = GetChunkSize(nItems, grainSize);
+         IndexType nChunks = (nItems + chunkSize - 1) / chunkSize;
+
+         std::vector<T> vResults(nChunks, init);
+         ParallelFor(0, nChunks, [&](IndexType beginChunk, IndexType endChunk)
+            {
+               for (IndexType chunk = beginChunk; chunk < endChunk; chunk++)
+               {
+                  IndexType begin = first + chunk * chunkSize;
+                  IndexType end = (last - begin < chunkSize ? last : begin + chunkSize);
+                  vResults[chunk] = map(begin, end);
+               }
+            }, 1);
+
+         for (auto& result : vResults)
+         {
+            init = reduce(std::move(init), std::move(result));
+         }
+
+         return init;
+      }
+   };
+};
@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////
+// System - WBFL low level system services
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Tracing macros
+//
+//   WBFL_TRACE_ZONE(name)            Records the time spent in the enclosing scope.
+//   WBFL_TRACE_FUNCTION()            Records the time spent in the enclosing function.
+//   WBFL_TRACE_COUNTER(name,value)   Records the value of a counter.
+//
+// Names must be string literals, or otherwise remain valid until the trace is written.
+// Nothing is recorded unless tracing is enabled with Trace::Enable. Define WBFL_NO_TRACE
+// to remove the macros from a build entirely.
+
+#include <System\SysExp.h>
+#include <atomic>
+#include <iosfwd>
+
+namespace WBFL
+{
+   namespace System
+   {
+      /// Records timed zones and counters for performance profiling. The trace can be written
+      /// in the Chrome trace event format, which can be viewed with Perfetto (ui.perfetto.dev) or chrome://tracing.
+      ///
+      /// Each thread records into its own buffer, so recording does not take a lock.
+      class SYSCLASS Trace
+      {
+      public:
+         Trace() = delete;
+         Trace(const Trace&) = delete;
+         ~Trace() = delete;
+
+         Trace& operator=(const Trace&) = delete;
+
+         /// Starts or stops recording
+         static void Enable(bool bEnable);
+         static bool IsEnabled() { return m_bEnabled.load(std::memory_order_relaxed); }
+
+         /// Discards all recorded events. Must not be called while zones are being recorded.
+         static void Clear();
+
+         /// Returns the number of nanoseconds since the process started
+         static Uint64 Now();
+
+         /// Records a zone that started and ended at the specified times
+         static void Zone(const char* name, Uint64 start, Uint64 end);
+
+         /// Records the value of a counter at the current time
+         static void Counter(const char* name, Float64 value);
+
+         /// Writes the recorded events as Chrome trace event JSON
+         static void Write(std::ostream& os);
+
+      private:
+         static std::atomic<bool> m_bEnabled;
+      };
+
+      /// Records the time from construction to destruction as a trace zone
+      class TraceZone
+      {
+      public:
+         TraceZone(const char* name) :
+            m_Name(Trace::IsEnabled() ? name : nullptr),
+            m_Start(m_Name ? Trace::Now() : 0)
+         {
+         }
+
+         TraceZone(const TraceZone&) = delete;
+
+         ~TraceZone()
+         {
+            if (m_Name)
+               Trace::Zone(m_Name, m_Start, Trace::Now());
+         }
+
+         TraceZone& operator=(const TraceZone&) = delete;
+
+      private:
+         const char* m_Name;
+         Uint64 m_Start;
+      };
+   };
+};
+
+#if defined WBFL_NO_TRACE
+
+#define WBFL_TRACE_ZONE(name) ((void)0)
+#define WBFL_TRACE_FUNCTION() ((void)0)
+#define WBFL_TRACE_COUNTER(name,value) ((void)0)
+
+#else
+
+#define WBFL_TRACE_CONCAT_(a,b) a##b
+#define WBFL_TRACE_CONCAT(a,b) WBFL_TRACE_CONCAT_(a,b)
+#define WBFL_TRACE_ZONE(name) WBFL::System::TraceZone WBFL_TRACE_CONCAT(_trace_zone_,__LINE__)(name)
+#define WBFL_TRACE_FUNCTION() WBFL_TRACE_ZONE(__FUNCTION__)
+#define WBFL_TRACE_COUNTER(name,value) \
+   do { if (WBFL::System::Trace::IsEnabled()) { WBFL::System::Trace::Counter(name,(Float64)(value)); } } while(0)
+
+#endif // WBFL_NO_TRACE
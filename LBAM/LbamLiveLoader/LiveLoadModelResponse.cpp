@@ -34,6 +34,7 @@
 #include "LiveLoaderUtils.h"
 
 #include "BasicVehicularResponse.h"
+#include <System\Trace.h>
 
 
 // handle dealing with cancel from progress monitor
@@ -200,6 +201,7 @@ STDMETHODIMP CLiveLoadModelResponse::ComputeForces(IIDArray* poiIDs, BSTR stage,
                                                    VARIANT_BOOL computePlacement, 
                                                    ILiveLoadModelSectionResults** pResults)
 {
+   WBFL_TRACE_FUNCTION();
    CHECK_IN(poiIDs);
    CHECK_IN(stage);
 	CHECK_RETOBJ(pResults);
@@ -297,6 +299,7 @@ STDMETHODIMP CLiveLoadModelResponse::ComputeDeflections(IIDArray* poiIDs, BSTR s
                                                         VARIANT_BOOL computePlacement, 
                                                         ILiveLoadModelSectionResults** pResults)
 {
+   WBFL_TRACE_FUNCTION();
    CHECK_IN(poiIDs);
    CHECK_IN(stage);
 	CHECK_RETOBJ(pResults);
@@ -387,6 +390,7 @@ STDMETHODIMP CLiveLoadModelResponse::ComputeReactions(IIDArray* supportIDs, BSTR
                                                       VARIANT_BOOL computePlacement, 
                                                       ILiveLoadModelResults** pResults)
 {
+   WBFL_TRACE_FUNCTION();
    CHECK_IN(supportIDs);
    CHECK_IN(stage);
 	CHECK_RETOBJ(pResults);
@@ -473,6 +477,7 @@ STDMETHODIMP CLiveLoadModelResponse::ComputeSupportDeflections(IIDArray* support
                                                       VARIANT_BOOL computePlacement, 
                                                       ILiveLoadModelResults** pResults)
 {
+   WBFL_TRACE_FUNCTION();
    CHECK_IN(supportIDs);
    CHECK_IN(stage);
 	CHECK_RETOBJ(pResults);
@@ -560,6 +565,7 @@ STDMETHODIMP CLiveLoadModelResponse::ComputeStresses(IIDArray* poiIDs, BSTR stag
                                                    VARIANT_BOOL computePlacement, 
                                                    ILiveLoadModelStressResults** pResults)
 {
+   WBFL_TRACE_FUNCTION();
    CHECK_IN(poiIDs);
    CHECK_IN(stage);
 	CHECK_RETOBJ(pResults);
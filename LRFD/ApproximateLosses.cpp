@@ -137,7 +137,7 @@ Float64 ApproximateLosses::TimeDependentLossesAfterDeck() const
 
 Float64 ApproximateLosses::TimeDependentLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -150,7 +150,7 @@ Float64 ApproximateLosses::PermanentStrand_Final() const
    // need to over ride this method because shipping losses could be a lump sum and it
    // doesn't have to be consistent with the other losses
 
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -163,7 +163,7 @@ Float64 ApproximateLosses::PermanentStrand_Final() const
 
 Float64 ApproximateLosses::PermanentStrand_BeforeTemporaryStrandRemoval() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -174,7 +174,7 @@ Float64 ApproximateLosses::PermanentStrand_BeforeTemporaryStrandRemoval() const
 
 Float64 ApproximateLosses::PermanentStrand_AfterTemporaryStrandRemoval() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -168,7 +168,7 @@ Float64 ApproximateLosses2005::RelaxationLossesAtXfer(bool bPerm) const
 
 Float64 ApproximateLosses2005::TemporaryStrand_ImmediatelyBeforeXferLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -178,7 +178,7 @@ Float64 ApproximateLosses2005::TemporaryStrand_ImmediatelyBeforeXferLosses() con
 
 Float64 ApproximateLosses2005::PermanentStrand_ImmediatelyBeforeXferLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -188,7 +188,7 @@ Float64 ApproximateLosses2005::PermanentStrand_ImmediatelyBeforeXferLosses() con
 
 Float64 ApproximateLosses2005::TemporaryStrand_ImmediatelyAfterXferLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -198,7 +198,7 @@ Float64 ApproximateLosses2005::TemporaryStrand_ImmediatelyAfterXferLosses() cons
 
 Float64 ApproximateLosses2005::PermanentStrand_ImmediatelyAfterXferLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -208,7 +208,7 @@ Float64 ApproximateLosses2005::PermanentStrand_ImmediatelyAfterXferLosses() cons
 
 Float64 ApproximateLosses2005::TemporaryStrand_TimeDependentLossesAtShipping() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -219,7 +219,7 @@ Float64 ApproximateLosses2005::TemporaryStrand_TimeDependentLossesAtShipping() c
 
 Float64 ApproximateLosses2005::PermanentStrand_TimeDependentLossesAtShipping() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -230,7 +230,7 @@ Float64 ApproximateLosses2005::PermanentStrand_TimeDependentLossesAtShipping() c
 
 Float64 ApproximateLosses2005::TimeDependentLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -240,7 +240,7 @@ Float64 ApproximateLosses2005::TimeDependentLosses() const
 
 Float64 ApproximateLosses2005::TimeDependentLossesBeforeDeck() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -250,7 +250,7 @@ Float64 ApproximateLosses2005::TimeDependentLossesBeforeDeck() const
 
 Float64 ApproximateLosses2005::TimeDependentLossesAfterDeck() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -263,7 +263,7 @@ Float64 ApproximateLosses2005::PermanentStrand_Final() const
    // need to over ride this method because shipping losses could be a lump sum and it
    // doesn't have to be consistent with the other losses
 
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -276,7 +276,7 @@ Float64 ApproximateLosses2005::PermanentStrand_Final() const
 
 Float64 ApproximateLosses2005::PermanentStrand_BeforeTemporaryStrandRemoval() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -287,7 +287,7 @@ Float64 ApproximateLosses2005::PermanentStrand_BeforeTemporaryStrandRemoval() co
 
 Float64 ApproximateLosses2005::PermanentStrand_AfterTemporaryStrandRemoval() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -298,7 +298,7 @@ Float64 ApproximateLosses2005::PermanentStrand_AfterTemporaryStrandRemoval() con
 
 Float64 ApproximateLosses2005::GetFpi() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -37,6 +37,12 @@ bool BDSManager::ms_bIsDamaged = false;
 using Listeners = std::list<BDSManagerListener*,std::allocator<BDSManagerListener*>>;
 Listeners BDSManager::ms_Listeners;
 
+namespace
+{
+   // Specification context in effect on the current thread. When nullptr, the global settings are used
+   thread_local const BDSContext* gs_pContext = nullptr;
+}
+
 void BDSManager::BeginDamage()
 {
    ms_bIsDamaged = true;
@@ -74,7 +80,7 @@ BDSManager::Edition BDSManager::SetEdition(Edition edition)
 
 BDSManager::Edition BDSManager::GetEdition()
 {
-   return ms_Edition;
+   return gs_pContext ? gs_pContext->GetEdition() : ms_Edition;
 }
 
 BDSManager::Edition BDSManager::GetLatestEdition()
@@ -104,7 +110,12 @@ BDSManager::Units BDSManager::SetUnits(Units units)
 
 BDSManager::Units BDSManager::GetUnits()
 {
-   return ms_Units;
+   return gs_pContext ? gs_pContext->GetUnits() : ms_Units;
+}
+
+bool BDSManager::IsContextActive()
+{
+   return gs_pContext != nullptr;
 }
 
 LPCTSTR BDSManager::GetSpecificationName()
@@ -114,7 +125,7 @@ LPCTSTR BDSManager::GetSpecificationName()
 
 LPCTSTR BDSManager::GetEditionAsString(bool bAbbreviated)
 {
-   return BDSManager::GetEditionAsString(ms_Edition,bAbbreviated);
+   return BDSManager::GetEditionAsString(GetEdition(),bAbbreviated);
 }
 
 LPCTSTR BDSManager::GetEditionAsString(BDSManager::Edition edition,bool bAbbreviated)
@@ -207,7 +218,7 @@ LPCTSTR BDSManager::GetEditionAsString(BDSManager::Edition edition,bool bAbbrevi
 
 LPCTSTR BDSManager::GetUnitAsString()
 {
-   return ( ms_Units == Units::SI ? _T("SI Units") : _T("Customary U.S. Units")) ;
+   return ( GetUnits() == Units::SI ? _T("SI Units") : _T("Customary U.S. Units")) ;
 }
 
 BDSManager::Edition BDSManager::GetEdition(LPCTSTR strAbbrev)
@@ -353,3 +364,44 @@ void BDSManager::NotifyAllListeners()
       }
    }
 }
+
+/////////////////
+
+BDSContext::BDSContext(BDSManager::Edition edition, BDSManager::Units units) :
+   m_Edition(edition), m_Units(units), m_pPrevious(gs_pContext)
+{
+   if (BDSManager::Edition::FourthEdition2007 <= m_Edition && m_Units == BDSManager::Units::SI)
+   {
+      // SI units were dropped from LRFD starting with 4th Edition 2007
+      WATCH(_T("LRFD Specification units forced to US"));
+      m_Units = BDSManager::Units::US;
+   }
+
+   gs_pContext = this;
+}
+
+BDSContext::BDSContext() :
+   BDSContext(BDSManager::GetEdition(), BDSManager::GetUnits())
+{
+}
+
+BDSContext::~BDSContext()
+{
+   CHECK(gs_pContext == this); // contexts must be destroyed in reverse order of creation
+   gs_pContext = m_pPrevious;
+}
+
+BDSManager::Edition BDSContext::GetEdition() const
+{
+   return m_Edition;
+}
+
+BDSManager::Units BDSContext::GetUnits() const
+{
+   return m_Units;
+}
+
+const BDSContext* BDSContext::GetCurrent()
+{
+   return gs_pContext;
+}
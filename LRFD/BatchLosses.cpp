@@ -0,0 +1,181 @@
+///////////////////////////////////////////////////////////////////////
+// LRFD - Utility library to support equations, methods, and procedures
+//        from the AASHTO LRFD Bridge Design Specification
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#include <Lrfd\LrfdLib.h>
+#include <Lrfd\BatchLosses.h>
+#include <Lrfd\BDSManager.h>
+#include <System\TaskPool.h>
+
+using namespace WBFL::LRFD;
+
+BatchLosses::Results BatchLosses::Evaluate(const std::vector<std::unique_ptr<Losses>>& vLosses)
+{
+   IndexType nSections = vLosses.size();
+
+   Results results;
+   for (auto& strand_losses : results.Losses)
+   {
+      for (auto& column : strand_losses)
+      {
+         column.resize(nSections);
+      }
+   }
+
+   for (int strandType = TEMPORARY_STRAND; strandType <= PERMANENT_STRAND; strandType++)
+   {
+      results.ElasticShorteningLosses[strandType].resize(nSections);
+      results.Fcgp[strandType].resize(nSections);
+   }
+
+   if (nSections == 0)
+      return results;
+
+   // Worker threads don't see a BDSContext created on the calling thread
+   BDSManager::Edition edition = BDSManager::GetEdition();
+   BDSManager::Units units = BDSManager::GetUnits();
+
+   // Evaluates sections in the range [firstIdx,lastIdx]. Each section writes to its own element of the result columns
+   auto evaluate_range = [&](IndexType firstIdx, IndexType lastIdx)
+   {
+      BDSContext context(edition, units);
+      EvaluateRange(vLosses, firstIdx, lastIdx, results);
+   };
+
+   // The first section is evaluated before the worker threads start. Objects shared by the loss objects,
+   // such as creep coefficient models, compute and cache their values on first use. After this,
+   // they are only read.
+   evaluate_range(0, 0);
+   if (nSections == 1)
+      return results;
+
+   WBFL::System::TaskPool::ParallelFor(1, nSections, [&evaluate_range](IndexType beginIdx, IndexType endIdx) {evaluate_range(beginIdx, endIdx - 1); });
+
+   return results;
+}
+
+void BatchLosses::SetSection(Losses& losses, const LossesSection& section)
+{
+   losses.SetLocation(section.X);
+   losses.SetEccPermanentRelease(section.epermRelease);
+   losses.SetEccPermanentFinal(section.epermFinal);
+   losses.SetEccTemporary(section.etemp);
+   losses.SetGdrMoment(section.Mdlg);
+   losses.SetAddlGdrMoment(section.Madlg);
+   losses.SetSidlMoment1(section.Msidl1);
+   losses.SetSidlMoment2(section.Msidl2);
+   losses.SetNoncompositeProperties(section.Ag, section.Ybg, section.Ixx, section.Iyy, section.Ixy);
+   losses.SetCompositeProperties1(section.Ac1, section.Ybc1, section.Ic1);
+   losses.SetCompositeProperties2(section.Ac2, section.Ybc2, section.Ic2);
+   losses.SetNetNoncompositeProperties(section.An, section.Ybn, section.Ixxn, section.Iyyn, section.Ixyn);
+   losses.SetNetCompositeProperties(section.Acn, section.Ybcn, section.Icn);
+}
+
+void BatchLosses::EvaluateRange(const std::vector<std::unique_ptr<Losses>>& vLosses, IndexType firstIdx, IndexType lastIdx, Results& results)
+{
+   if (lastIdx < firstIdx)
+      return;
+
+   // Compute elastic shortening for all sections in the range together. If the initial relaxation
+   // can't be computed, the section is skipped here and the error is reported when the losses are updated.
+   IndexType nSections = lastIdx - firstIdx + 1;
+   std::vector<ElasticShortening> vElasticShortening(nSections);
+   std::vector<bool> vbEvaluated(nSections, false);
+   for (IndexType i = 0; i < nSections; i++)
+   {
+      const Losses* pLosses = vLosses[firstIdx + i].get();
+      try
+      {
+         pLosses->UpdateRelaxationBeforeTransfer();
+         vElasticShortening[i] = pLosses->CreateElasticShortening();
+         vbEvaluated[i] = true;
+      }
+      catch (...)
+      {
+      }
+   }
+
+   ElasticShortening::Evaluate(vElasticShortening);
+
+   static const std::array<Float64(Losses::*)() const, nStages> permanent_strand_losses{
+      &Losses::PermanentStrand_BeforeTransfer,
+      &Losses::PermanentStrand_AfterTransfer,
+      &Losses::PermanentStrand_AtLifting,
+      &Losses::PermanentStrand_AtShipping,
+      &Losses::PermanentStrand_AfterTemporaryStrandInstallation,
+      &Losses::PermanentStrand_BeforeTemporaryStrandRemoval,
+      &Losses::PermanentStrand_AfterTemporaryStrandRemoval,
+      &Losses::PermanentStrand_AfterDeckPlacement,
+      &Losses::PermanentStrand_AfterSIDL,
+      &Losses::PermanentStrand_Final
+   };
+
+   static const std::array<Float64(Losses::*)() const, nStages> temporary_strand_losses{
+      &Losses::TemporaryStrand_BeforeTransfer,
+      &Losses::TemporaryStrand_AfterTransfer,
+      &Losses::TemporaryStrand_AtLifting,
+      &Losses::TemporaryStrand_AtShipping,
+      &Losses::TemporaryStrand_AfterTemporaryStrandInstallation,
+      &Losses::TemporaryStrand_BeforeTemporaryStrandRemoval,
+      &Losses::TemporaryStrand_AfterTemporaryStrandRemoval,
+      &Losses::TemporaryStrand_AfterDeckPlacement,
+      &Losses::TemporaryStrand_AfterSIDL,
+      &Losses::TemporaryStrand_Final
+   };
+
+   for (IndexType i = 0; i < nSections; i++)
+   {
+      IndexType sectionIdx = firstIdx + i;
+      const Losses* pLosses = vLosses[sectionIdx].get();
+
+      if (vbEvaluated[i])
+      {
+         pLosses->m_ElasticShortening = vElasticShortening[i];
+         pLosses->m_bElasticShorteningEvaluated = true;
+      }
+
+      try
+      {
+         pLosses->UpdateLosses();
+      }
+      catch (...)
+      {
+         pLosses->m_bElasticShorteningEvaluated = false;
+         throw;
+      }
+      pLosses->m_bElasticShorteningEvaluated = false; // not all loss methods compute elastic shortening
+
+      for (IndexType stageIdx = 0; stageIdx < nStages; stageIdx++)
+      {
+         results.Losses[PERMANENT_STRAND][stageIdx][sectionIdx] = (pLosses->*permanent_strand_losses[stageIdx])();
+         results.Losses[TEMPORARY_STRAND][stageIdx][sectionIdx] = (pLosses->*temporary_strand_losses[stageIdx])();
+      }
+
+      results.ElasticShorteningLosses[PERMANENT_STRAND][sectionIdx] = pLosses->PermanentStrand_ElasticShorteningLosses();
+      results.ElasticShorteningLosses[TEMPORARY_STRAND][sectionIdx] = pLosses->TemporaryStrand_ElasticShorteningLosses();
+
+      const ElasticShortening& es = pLosses->GetElasticShortening();
+      results.Fcgp[PERMANENT_STRAND][sectionIdx] = es.PermanentStrand_Fcgp();
+      results.Fcgp[TEMPORARY_STRAND][sectionIdx] = es.TemporaryStrand_Fcgp();
+   }
+}
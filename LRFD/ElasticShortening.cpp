@@ -337,3 +337,112 @@ void ElasticShortening::Update() const
 
    m_bUpdate = false;
 }
+
+void ElasticShortening::Evaluate(std::vector<ElasticShortening>& vElasticShortening)
+{
+   // Sections using gross properties with the iterative method are solved together. The parameters that don't
+   // change during iteration are gathered into contiguous arrays so each iteration is a simple pass over the
+   // sections that haven't converged. All other sections are computed individually.
+   std::vector<IndexType> vIdx;
+   vIdx.reserve(vElasticShortening.size());
+   for (IndexType i = 0; i < vElasticShortening.size(); i++)
+   {
+      const auto& es = vElasticShortening[i];
+      if (!es.m_bUpdate)
+         continue;
+
+      Float64 Ppj = es.m_ApsPerm*es.m_FpjPerm;
+      Float64 Ptj = es.m_ApsTemp*es.m_FpjTemp;
+      if (es.m_FcgpMethod == FcgpComputationMethod::Iterative && es.m_bGrossProperties && !(IsZero(Ppj) && IsZero(Ptj)))
+      {
+         vIdx.push_back(i);
+      }
+      else
+      {
+         es.Update();
+      }
+   }
+
+   IndexType nSections = vIdx.size();
+   if (nSections == 0)
+      return;
+
+   std::vector<Float64> vEpsX(nSections), vEpsY(nSections), vKn(nSections), vD(nSections);
+   std::vector<Float64> vDfESPerm(nSections, 0.0), vDfESTemp(nSections, 0.0);
+   std::vector<Float64> vFcgpPerm(nSections, 0.0), vFcgpTemp(nSections, 0.0), vP(nSections, 0.0);
+   for (IndexType j = 0; j < nSections; j++)
+   {
+      const auto& es = vElasticShortening[vIdx[j]];
+      vEpsX[j] = (IsZero(es.m_ApsPerm + es.m_ApsTemp) ? 0 : (es.m_ApsPerm*es.m_ePerm.X() + es.m_ApsTemp*es.m_eTemp.X()) / (es.m_ApsPerm + es.m_ApsTemp));
+      vEpsY[j] = (IsZero(es.m_ApsPerm + es.m_ApsTemp) ? 0 : (es.m_ApsPerm*es.m_ePerm.Y() + es.m_ApsTemp*es.m_eTemp.Y()) / (es.m_ApsPerm + es.m_ApsTemp));
+      vKn[j] = es.m_K*(es.m_Ep / es.m_Eci);
+      vD[j] = es.m_Ixx*es.m_Iyy - es.m_Ixy*es.m_Ixy;
+
+      CHECK(!IsZero(es.m_Ag));
+      CHECK(!IsZero(vD[j]));
+   }
+
+   // positions in vIdx of the sections that are still iterating
+   std::vector<IndexType> vActive(nSections);
+   for (IndexType j = 0; j < nSections; j++) vActive[j] = j;
+
+   Int32 iter(0);
+   while (!vActive.empty())
+   {
+      IndexType nActive = 0;
+      for (auto j : vActive)
+      {
+         const auto& es = vElasticShortening[vIdx[j]];
+
+         Float64 dfESPerm = vDfESPerm[j];
+         Float64 dfESTemp = vDfESTemp[j];
+
+         Float64 P = es.m_ApsPerm*(es.m_FpjPerm - es.m_dFpR1Perm - dfESPerm) + es.m_ApsTemp*(es.m_FpjTemp - es.m_dFpR1Temp - dfESTemp);
+         P *= -1;
+
+         Float64 Mx = P*vEpsY[j] + es.m_Mdlg;
+         Float64 My = P*vEpsX[j];
+         Float64 D = vD[j];
+
+         Float64 fcgpPerm = 0;
+         if (!IsZero(es.m_ApsPerm*es.m_FpjPerm))
+         {
+            fcgpPerm = P / es.m_Ag + (My*es.m_Ixx + Mx*es.m_Ixy)*(-es.m_ePerm.X()) / D - (Mx*es.m_Iyy + My*es.m_Ixy)*(-es.m_ePerm.Y()) / D;
+            fcgpPerm *= -1.0; // Need a sign reversal to meet code equations
+         }
+
+         Float64 fcgpTemp = 0;
+         if (!IsZero(es.m_ApsTemp*es.m_FpjTemp))
+         {
+            fcgpTemp = P / es.m_Ag + (My*es.m_Ixx + Mx*es.m_Ixy)*(-es.m_eTemp.X()) / D - (Mx*es.m_Iyy + My*es.m_Ixy)*(-es.m_eTemp.Y()) / D;
+            fcgpTemp *= -1.0; // Need a sign reversal to meet code equations
+         }
+
+         vP[j] = P;
+         vFcgpPerm[j] = fcgpPerm;
+         vFcgpTemp[j] = fcgpTemp;
+         vDfESTemp[j] = vKn[j] * fcgpTemp;
+         vDfESPerm[j] = vKn[j] * fcgpPerm;
+
+         if (!IsZero(dfESTemp - vDfESTemp[j], 0.01) || !IsZero(dfESPerm - vDfESPerm[j], 0.01))
+         {
+            vActive[nActive++] = j; // not converged, keep iterating
+         }
+      }
+      vActive.resize(nActive);
+
+      iter++;
+      CHECK(iter < 100 || vActive.empty());// if we are taking this long, there is a problem
+   }
+
+   for (IndexType j = 0; j < nSections; j++)
+   {
+      auto& es = vElasticShortening[vIdx[j]];
+      es.m_P = vP[j];
+      es.m_FcgpPerm = vFcgpPerm[j];
+      es.m_FcgpTemp = vFcgpTemp[j];
+      es.m_dfESPerm = vDfESPerm[j];
+      es.m_dfESTemp = vDfESTemp[j];
+      es.m_bUpdate = false;
+   }
+}
@@ -282,6 +282,38 @@ std::unique_ptr<WBFL::Materials::ConcreteBaseCreepDetails> LRFDTimeDependentConc
    }
 }
 
+std::vector<Float64> LRFDTimeDependentConcrete::GetFreeShrinkageStrains(const std::vector<Float64>& vTime) const
+{
+   if ( BDSManager::GetEdition() < BDSManager::Edition::ThirdEditionWith2005Interims )
+   {
+      return GetFreeShrinkageStrainsBefore2005(vTime);
+   }
+   else if ( BDSManager::Edition::SeventhEditionWith2015Interims <= BDSManager::GetEdition() )
+   {
+      return GetFreeShrinkageStrains2015(vTime);
+   }
+   else
+   {
+      return GetFreeShrinkageStrains2005(vTime);
+   }
+}
+
+std::vector<Float64> LRFDTimeDependentConcrete::GetCreepCoefficients(const std::vector<Float64>& vTime,const std::vector<Float64>& vLoadingTime) const
+{
+   if ( BDSManager::GetEdition() < BDSManager::Edition::ThirdEditionWith2005Interims )
+   {
+      return GetCreepCoefficientsBefore2005(vTime,vLoadingTime);
+   }
+   else if ( BDSManager::Edition::SeventhEditionWith2015Interims <= BDSManager::GetEdition() )
+   {
+      return GetCreepCoefficients2015(vTime,vLoadingTime);
+   }
+   else
+   {
+      return GetCreepCoefficients2005(vTime,vLoadingTime);
+   }
+}
+
 std::unique_ptr<WBFL::Materials::ConcreteBase> LRFDTimeDependentConcrete::CreateClone() const
 {
    return std::make_unique<LRFDTimeDependentConcrete>(*this);
@@ -950,3 +982,293 @@ std::unique_ptr<WBFL::Materials::ConcreteBaseCreepDetails> LRFDTimeDependentConc
 
    return pDetails;
 }
+
+std::vector<Float64> LRFDTimeDependentConcrete::GetFreeShrinkageStrainsBefore2005(const std::vector<Float64>& vTime) const
+{
+   Validate();
+   CHECK(0 < m_VS); // did you forget to set V/S ratio?
+
+   // parameters that do not depend on time
+   Float64 K = (GetCuringType() == WBFL::Materials::CuringType::Moist ? 35.0 : 55.0);
+   Float64 eshu = (GetCuringType() == WBFL::Materials::CuringType::Moist ? 0.51e-3 : 0.56e-3);
+
+   // the size factor depends on time, but its V/S terms do not (LRFD C5.4.2.3.3-1)
+   Float64 a, k3;
+   if ( BDSManager::GetUnits() == BDSManager::Units::US )
+   {
+      Float64 vs = WBFL::Units::ConvertFromSysUnits(m_VS,WBFL::Units::Measure::Inch);
+      a = 26.0*exp(0.36*vs);
+      k3 = (1064 - 94*vs)/923;
+   }
+   else
+   {
+      Float64 vs = WBFL::Units::ConvertFromSysUnits(m_VS,WBFL::Units::Measure::Millimeter);
+      a = 26.0*exp(0.0142*vs);
+      k3 = (1064 - 3.7*vs)/923;
+   }
+
+   IndexType nTimes = vTime.size();
+   std::vector<Float64> vEsh(nTimes,0.0);
+   for (IndexType i = 0; i < nTimes; i++)
+   {
+      Float64 t = vTime[i];
+      Float64 concrete_age = GetAge(t);
+      Float64 shrinkage_time = concrete_age - m_CureTime;
+      if ( concrete_age < 0 || shrinkage_time <= 0 )
+      {
+         continue;
+      }
+
+      Float64 maturity = t - (m_CureTime + m_TimeAtCasting);
+      Float64 k1 = maturity/(a + maturity);
+      Float64 k2 = maturity/(45.0 + maturity);
+      Float64 ks = (k1/k2)*k3;
+      vEsh[i] = -ks*m_khs*eshu*(shrinkage_time)/(K + shrinkage_time);
+   }
+
+   return vEsh;
+}
+
+std::vector<Float64> LRFDTimeDependentConcrete::GetFreeShrinkageStrains2005(const std::vector<Float64>& vTime) const
+{
+   Validate();
+
+   // parameters that do not depend on time
+   Float64 kf = ComputeConcreteStrengthFactor();
+
+   Float64 ktd_a; // ktd = t/(ktd_a + t)
+   Float64 fci = GetFc(m_TimeAtCasting + m_AgeAtInitialLoading);
+   if ( BDSManager::GetUnits() == BDSManager::Units::SI )
+   {
+      fci = WBFL::Units::ConvertFromSysUnits(fci,WBFL::Units::Measure::MPa);
+      ktd_a = 61.0 - 0.58*fci;
+   }
+   else
+   {
+      fci = WBFL::Units::ConvertFromSysUnits(fci,WBFL::Units::Measure::KSI);
+      ktd_a = 61.0 - 4.0*fci;
+   }
+
+   Float64 ks = GetSizeFactorShrinkage(-99999); // doesn't rely on time for 2005 and later
+
+   Float64 k1, k2;
+   GetShrinkageCorrectionFactors(&k1, &k2);
+   Float64 k = k1*k2*ks*m_khs*kf;
+
+   IndexType nTimes = vTime.size();
+   std::vector<Float64> vEsh(nTimes,0.0);
+   for (IndexType i = 0; i < nTimes; i++)
+   {
+      Float64 concrete_age = GetAge(vTime[i]);
+      Float64 shrinkage_time = concrete_age - m_CureTime;
+      if ( concrete_age < 0 || shrinkage_time < 0 )
+      {
+         continue;
+      }
+
+      Float64 ktd = (shrinkage_time)/(ktd_a + shrinkage_time);
+      vEsh[i] = k*ktd*m_Eshu;
+   }
+
+   return vEsh;
+}
+
+std::vector<Float64> LRFDTimeDependentConcrete::GetFreeShrinkageStrains2015(const std::vector<Float64>& vTime) const
+{
+   // parameters that do not depend on time
+   Float64 vs = WBFL::Units::ConvertFromSysUnits(m_VS,WBFL::Units::Measure::Inch);
+   Float64 ks = Max(1.0,1.45 - 0.13*vs);
+
+   Float64 khs = (2.0 - 0.014*m_RelativeHumidity);
+
+   Float64 kf = ComputeConcreteStrengthFactor();
+
+   Float64 fci = GetFc(m_TimeAtCasting + m_AgeAtInitialLoading);
+   fci = WBFL::Units::ConvertFromSysUnits(fci,WBFL::Units::Measure::KSI);
+   Float64 ktd_a = 12*(100.0 - 4.0*fci)/(fci + 20); // ktd = t/(ktd_a + t)
+
+   Float64 k1, k2;
+   GetShrinkageCorrectionFactors(&k1, &k2);
+   Float64 k = -k1*k2*ks*khs*kf;
+
+   IndexType nTimes = vTime.size();
+   std::vector<Float64> vEsh(nTimes,0.0);
+   for (IndexType i = 0; i < nTimes; i++)
+   {
+      Float64 concrete_age = GetAge(vTime[i]);
+      Float64 shrinkage_time = concrete_age - m_CureTime;
+      if ( concrete_age < 0 || shrinkage_time < 0 )
+      {
+         continue;
+      }
+
+      Float64 ktd = (shrinkage_time)/(ktd_a + shrinkage_time);
+      vEsh[i] = k*ktd*0.48E-3;
+   }
+
+   return vEsh;
+}
+
+std::vector<Float64> LRFDTimeDependentConcrete::GetCreepCoefficientsBefore2005(const std::vector<Float64>& vTime,const std::vector<Float64>& vLoadingTime) const
+{
+   Validate();
+   CHECK(0 < m_VS); // did you forget to set V/S ratio?
+
+   // the size factor depends on time, but its V/S terms do not (LRFD 5.4.2.3.2-1)
+   Float64 x1, x2;
+   Float64 vs;
+   if ( BDSManager::GetUnits() == BDSManager::Units::SI )
+   {
+      x1 = 0.0142;
+      x2 = -0.0213;
+      vs = WBFL::Units::ConvertFromSysUnits(m_VS,WBFL::Units::Measure::Millimeter);
+   }
+   else
+   {
+      x1 = 0.36;
+      x2 = -0.54;
+      vs = WBFL::Units::ConvertFromSysUnits(m_VS,WBFL::Units::Measure::Inch);
+   }
+   Float64 a = 26.0*exp(x1*vs);
+   Float64 c = 1.80 + 1.77*exp(x2*vs);
+
+   IndexType nTimes = vTime.size();
+   IndexType nLoadingTimes = vLoadingTime.size();
+   std::vector<Float64> vCt(nTimes*nLoadingTimes,0.0);
+   for (IndexType j = 0; j < nLoadingTimes; j++)
+   {
+      Float64 age_at_loading = GetAge(vLoadingTime[j]);
+      if ( ::IsLE(age_at_loading,0.0) )
+      {
+         continue; // creep coefficients are zero for this loading
+      }
+
+      Float64 kla = pow(age_at_loading,-0.118);
+
+      Float64* pCt = vCt.data() + j*nTimes;
+      for (IndexType i = 0; i < nTimes; i++)
+      {
+         Float64 age = GetAge(vTime[i]);
+         Float64 maturity = age - age_at_loading;
+         if ( ::IsLE(age,0.0) || ::IsLE(maturity,0.0) )
+         {
+            continue;
+         }
+
+         Float64 kc = ((maturity/(a + maturity))/(maturity/(45.0 + maturity)))*(c/2.587);
+
+         Float64 tx = pow(maturity,0.6);
+         Float64 kt = tx/(10 + tx);
+
+         pCt[i] = 3.5*kc*m_kf*m_khc*kla*kt;
+      }
+   }
+
+   return vCt;
+}
+
+std::vector<Float64> LRFDTimeDependentConcrete::GetCreepCoefficients2005(const std::vector<Float64>& vTime,const std::vector<Float64>& vLoadingTime) const
+{
+   Validate();
+
+   // parameters that do not depend on time
+   Float64 kf = ComputeConcreteStrengthFactor();
+
+   Float64 fci = GetFc(m_TimeAtCasting + m_CureTime);
+
+   Float64 ktd_a; // ktd = t/(ktd_a + t)
+   if ( BDSManager::GetUnits() == BDSManager::Units::SI )
+   {
+      fci = WBFL::Units::ConvertFromSysUnits(fci, WBFL::Units::Measure::MPa);
+      ktd_a = 61.0 - 0.58*fci;
+   }
+   else
+   {
+      fci = WBFL::Units::ConvertFromSysUnits(fci, WBFL::Units::Measure::KSI);
+      ktd_a = 61.0 - 4.0*fci;
+   }
+
+   Float64 ks = GetSizeFactorShrinkage(-99999); // size factor for creep and shrinkage are the same and don't rely on time for 2005 and later
+   Float64 k1, k2;
+   GetCreepCorrectionFactors(&k1, &k2);
+   Float64 k = k1*k2*m_Cu*ks*m_khc*kf;
+
+   IndexType nTimes = vTime.size();
+   IndexType nLoadingTimes = vLoadingTime.size();
+   std::vector<Float64> vCt(nTimes*nLoadingTimes,0.0);
+   for (IndexType j = 0; j < nLoadingTimes; j++)
+   {
+      Float64 age_at_loading = GetAge(vLoadingTime[j]);
+      if ( ::IsLE(age_at_loading,0.0) )
+      {
+         continue; // creep coefficients are zero for this loading
+      }
+
+      Float64 kla = pow(age_at_loading,-0.118);
+
+      Float64* pCt = vCt.data() + j*nTimes;
+      for (IndexType i = 0; i < nTimes; i++)
+      {
+         Float64 age = GetAge(vTime[i]);
+         Float64 maturity = age - age_at_loading;
+         if ( ::IsLE(age,0.0) || ::IsLT(maturity,0.0) )
+         {
+            continue;
+         }
+
+         Float64 ktd = (maturity)/(ktd_a + maturity);
+         pCt[i] = k*ktd*kla;
+      }
+   }
+
+   return vCt;
+}
+
+std::vector<Float64> LRFDTimeDependentConcrete::GetCreepCoefficients2015(const std::vector<Float64>& vTime,const std::vector<Float64>& vLoadingTime) const
+{
+   // parameters that do not depend on time
+   Float64 vs = WBFL::Units::ConvertFromSysUnits(m_VS,WBFL::Units::Measure::Inch);
+   Float64 ks = Max(1.0,1.45 - 0.13*vs);
+
+   Float64 khc = (1.56 - 0.008*m_RelativeHumidity);
+
+   Float64 kf = ComputeConcreteStrengthFactor();
+
+   Float64 fci = GetFc(m_TimeAtCasting + m_CureTime);
+   fci = WBFL::Units::ConvertFromSysUnits(fci,WBFL::Units::Measure::KSI);
+   Float64 ktd_a = 12*(100.0 - 4.0*fci)/(fci + 20); // ktd = t/(ktd_a + t)
+
+   Float64 k1, k2;
+   GetCreepCorrectionFactors(&k1, &k2);
+   Float64 k = 1.9*k1*k2*ks*khc*kf;
+
+   IndexType nTimes = vTime.size();
+   IndexType nLoadingTimes = vLoadingTime.size();
+   std::vector<Float64> vCt(nTimes*nLoadingTimes,0.0);
+   for (IndexType j = 0; j < nLoadingTimes; j++)
+   {
+      Float64 age_at_loading = GetAge(vLoadingTime[j]);
+      if ( ::IsLE(age_at_loading,0.0) )
+      {
+         continue; // creep coefficients are zero for this loading
+      }
+
+      Float64 kla = pow(age_at_loading,-0.118);
+
+      Float64* pCt = vCt.data() + j*nTimes;
+      for (IndexType i = 0; i < nTimes; i++)
+      {
+         Float64 age = GetAge(vTime[i]);
+         Float64 maturity = age - age_at_loading;
+         if ( ::IsLE(age,0.0) || ::IsLT(maturity,0.0) )
+         {
+            continue;
+         }
+
+         Float64 ktd = (maturity)/(ktd_a + maturity);
+         pCt[i] = k*ktd*kla;
+      }
+   }
+
+   return vCt;
+}
@@ -26,6 +26,7 @@
 #include <Lrfd\LiveLoadDistributionFactorBase.h>
 #include <Lrfd\Utility.h>
 #include <Lrfd/BDSManager.h>
+#include <System\TaskPool.h>
 #include <set>
 #include <algorithm>
 
@@ -982,6 +983,13 @@ ILiveLoadDistributionFactor::DFResult LiveLoadDistributionFactorBase::GetShearDF
 
 ILiveLoadDistributionFactor::LeverRuleMethod LiveLoadDistributionFactorBase::DistributeByLeverRuleEx(Location loc,NumLoadedLanes numLanes, bool applyMpf) const
 {
+   IndexType cacheIdx = 8*(IndexType)loc + 4*(IndexType)numLanes + 2*(applyMpf ? 1 : 0) + (IgnoreMpfLeverRule() ? 1 : 0);
+   auto& cached = m_LeverRuleCache[cacheIdx];
+   if (cached.has_value())
+   {
+      return cached.value();
+   }
+
    GirderIndexType nl = (numLanes==NumLoadedLanes::TwoOrMore) ? m_Nl : 1;
 
    // Pick adjacent girder if needed
@@ -1011,9 +1019,87 @@ ILiveLoadDistributionFactor::LeverRuleMethod LiveLoadDistributionFactorBase::Dis
    ILiveLoadDistributionFactor::LeverRuleMethod g;
    g = DistributeByLeverRule(gdr, m_Spacings, m_LeftCurbOverhang, m_RightCurbOverhang, m_wLane, nl, applyMpf);
 
+   cached = g;
    return g;
 }
 
+ILiveLoadDistributionFactor::RigidMethod LiveLoadDistributionFactorBase::DistributeByRigidMethodEx(NumLoadedLanes numLanes, bool applyMpf) const
+{
+   auto& cached = m_RigidMethodCache[2*(IndexType)numLanes + (applyMpf ? 1 : 0)];
+   if (!cached.has_value())
+   {
+      IndexType firstLoadedLane = (numLanes == NumLoadedLanes::One ? 1 : 2);
+      IndexType lastLoadedLane  = (numLanes == NumLoadedLanes::One ? 1 : m_Nl);
+      cached = DistributeByRigidMethod(m_Side, m_Spacings, m_LeftCurbOverhang, m_RightCurbOverhang, m_wLane, firstLoadedLane, lastLoadedLane, applyMpf);
+   }
+
+   return cached.value();
+}
+
+ILiveLoadDistributionFactor::DFTable LiveLoadDistributionFactorBase::GetDFTable() const
+{
+   // The same factors apply to all limit states other than fatigue so each factor is computed once. The strength
+   // factors are computed before the fatigue factors so the default fatigue methods reuse the cached lever rule and rigid method results.
+   using Method = DFResult(LiveLoadDistributionFactorBase::*)() const;
+   static const Method strength[2][3][2] = {
+      { { &LiveLoadDistributionFactorBase::GetMomentDF_Int_1_Strength,   &LiveLoadDistributionFactorBase::GetMomentDF_Int_2_Strength   },
+        { &LiveLoadDistributionFactorBase::GetShearDF_Int_1_Strength,    &LiveLoadDistributionFactorBase::GetShearDF_Int_2_Strength    },
+        { &LiveLoadDistributionFactorBase::GetReactionDF_Int_1_Strength, &LiveLoadDistributionFactorBase::GetReactionDF_Int_2_Strength } },
+      { { &LiveLoadDistributionFactorBase::GetMomentDF_Ext_1_Strength,   &LiveLoadDistributionFactorBase::GetMomentDF_Ext_2_Strength   },
+        { &LiveLoadDistributionFactorBase::GetShearDF_Ext_1_Strength,    &LiveLoadDistributionFactorBase::GetShearDF_Ext_2_Strength    },
+        { &LiveLoadDistributionFactorBase::GetReactionDF_Ext_1_Strength, &LiveLoadDistributionFactorBase::GetReactionDF_Ext_2_Strength } }
+   };
+
+   static const Method fatigue[2][3] = {
+      { &LiveLoadDistributionFactorBase::GetMomentDF_Int_Fatigue, &LiveLoadDistributionFactorBase::GetShearDF_Int_Fatigue, &LiveLoadDistributionFactorBase::GetReactionDF_Int_Fatigue },
+      { &LiveLoadDistributionFactorBase::GetMomentDF_Ext_Fatigue, &LiveLoadDistributionFactorBase::GetShearDF_Ext_Fatigue, &LiveLoadDistributionFactorBase::GetReactionDF_Ext_Fatigue }
+   };
+
+   DFTable table;
+   for (int loc = 0; loc < 2; loc++)
+   {
+      TestRangeOfApplicability((Location)loc);
+
+      for (int effect = 0; effect < 3; effect++)
+      {
+         for (int numLanes = 0; numLanes < 2; numLanes++)
+         {
+            table.Strength[loc][effect][numLanes] = (this->*strength[loc][effect][numLanes])();
+         }
+
+         table.Fatigue[loc][effect] = (this->*fatigue[loc][effect])();
+      }
+   }
+
+   return table;
+}
+
+std::vector<ILiveLoadDistributionFactor::DFTable> LiveLoadDistributionFactorBase::GetDFTables(const std::vector<std::unique_ptr<LiveLoadDistributionFactorBase>>& vGirders)
+{
+   IndexType nGirders = vGirders.size();
+   std::vector<DFTable> vTables(nGirders);
+   if (nGirders == 0)
+      return vTables;
+
+   // Worker threads don't see a BDSContext created on the calling thread
+   BDSManager::Edition edition = BDSManager::GetEdition();
+   BDSManager::Units units = BDSManager::GetUnits();
+
+   // Each girder has its own calculator and lever rule cache, and writes to its own table
+   auto evaluate_range = [&](IndexType firstIdx, IndexType lastIdx)
+   {
+      BDSContext context(edition, units);
+      for (IndexType idx = firstIdx; idx <= lastIdx; idx++)
+      {
+         vTables[idx] = vGirders[idx]->GetDFTable();
+      }
+   };
+
+   WBFL::System::TaskPool::ParallelFor(0, nGirders, [&evaluate_range](IndexType beginIdx, IndexType endIdx) {evaluate_range(beginIdx, endIdx - 1); });
+
+   return vTables;
+}
+
 ILiveLoadDistributionFactor::DFResult LiveLoadDistributionFactorBase::DistributeMomentByLeverRule(Location loc,NumLoadedLanes numLanes, bool applyMpf) const
 {
    ILiveLoadDistributionFactor::DFResult g;
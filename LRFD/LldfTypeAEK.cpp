@@ -59,7 +59,7 @@ ILiveLoadDistributionFactor::DFResult LldfTypeAEK::GetMomentDF_Ext_1_Strength()
    {
       // but not less than that which would be obtained by assuming that the
       // cross-section deflects and rotates as a rigid cross-section. 4.6.2.2.2d
-      g.RigidData = DistributeByRigidMethod(m_Side, m_Spacings, m_LeftCurbOverhang, m_RightCurbOverhang, m_wLane, 1, 1,true);
+      g.RigidData = DistributeByRigidMethodEx(NumLoadedLanes::One, true);
 
       skew = MomentSkewCorrectionFactor();
       if ( g.mg < g.RigidData.mg*skew )
@@ -89,7 +89,7 @@ ILiveLoadDistributionFactor::DFResult LldfTypeAEK::GetMomentDF_Ext_2_Strength()
    {
       // but not less than that which would be obtained by assuming that the
       // cross-section deflects and rotates as a rigid cross-section. 4.6.2.2.2d
-      g.RigidData = DistributeByRigidMethod(m_Side, m_Spacings, m_LeftCurbOverhang, m_RightCurbOverhang, m_wLane,2,m_Nl, true);
+      g.RigidData = DistributeByRigidMethodEx(NumLoadedLanes::TwoOrMore, true);
       skew = MomentSkewCorrectionFactor();
       if ( g.mg < g.RigidData.mg*skew )
       {
@@ -118,7 +118,7 @@ ILiveLoadDistributionFactor::DFResult LldfTypeAEK::GetShearDF_Ext_1_Strength() c
    {
       // but not less than that which would be obtained by assuming that the
       // cross-section deflects and rotates as a rigid cross-section. 4.6.2.2.2d
-      g.RigidData = DistributeByRigidMethod(m_Side, m_Spacings, m_LeftCurbOverhang, m_RightCurbOverhang, m_wLane, 1, 1, true);
+      g.RigidData = DistributeByRigidMethodEx(NumLoadedLanes::One, true);
 
       skew = ShearSkewCorrectionFactor();
       if ( g.mg < g.RigidData.mg*skew )
@@ -148,7 +148,7 @@ ILiveLoadDistributionFactor::DFResult LldfTypeAEK::GetShearDF_Ext_2_Strength() c
       {
          // but not less than that which would be obtained by assuming that the
          // cross-section deflects and rotates as a rigid cross-section. 4.6.2.2.2d
-         g.RigidData = DistributeByRigidMethod(m_Side, m_Spacings, m_LeftCurbOverhang, m_RightCurbOverhang, m_wLane,2,m_Nl, true);
+         g.RigidData = DistributeByRigidMethodEx(NumLoadedLanes::TwoOrMore, true);
          skew = ShearSkewCorrectionFactor();
          if ( g.mg < g.RigidData.mg*skew )
          {
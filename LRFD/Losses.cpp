@@ -175,6 +175,8 @@ Losses::Losses(Float64 x,
    m_ti = ti;
 
    m_IsDirty               = true;
+   m_Edition               = BDSManager::GetEdition();
+   m_Units                 = BDSManager::GetUnits();
 }
 
 Losses::Losses()
@@ -255,11 +257,14 @@ Losses::Losses()
    m_ti = 0;
 
    m_IsDirty               = true;
+   m_Edition               = BDSManager::GetEdition();
+   m_Units                 = BDSManager::GetUnits();
 }
 
 void Losses::Init()
 {
    m_bValidateParameters = true;
+   m_bElasticShorteningEvaluated = false;
    m_dfpR0[TEMPORARY_STRAND] = 0;
    m_dfpR0[PERMANENT_STRAND] = 0;
    m_dfpES[TEMPORARY_STRAND] = 0;
@@ -301,12 +306,12 @@ void Losses::OnUpdate()
 {
    BDSManagerListener::OnUpdate(); // call base class
 
-   // Nothing actually changes.
+   // Nothing to do. IsDirty() detects edition and unit changes when the losses are requested.
 }
 
 Float64 Losses::GetFpyPermanent() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -316,7 +321,7 @@ Float64 Losses::GetFpyPermanent() const
 
 Float64 Losses::GetFpyTemporary() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -326,7 +331,7 @@ Float64 Losses::GetFpyTemporary() const
 
 Float64 Losses::GetEp() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -525,7 +530,7 @@ void Losses::GetNetCompositeProperties(Float64* pAg, Float64* pYbg, Float64* pIx
 
 const ElasticShortening& Losses::GetElasticShortening() const 
 { 
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -536,7 +541,7 @@ const ElasticShortening& Losses::GetElasticShortening() const
 
 Float64 Losses::PermanentStrand_BeforeTransfer() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -546,7 +551,7 @@ Float64 Losses::PermanentStrand_BeforeTransfer() const
 
 Float64 Losses::PermanentStrand_AfterTransfer() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -558,7 +563,7 @@ Float64 Losses::PermanentStrand_AfterTransfer() const
 
 Float64 Losses::PermanentStrand_AtLifting() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -570,7 +575,7 @@ Float64 Losses::PermanentStrand_AtLifting() const
 
 Float64 Losses::PermanentStrand_AtShipping() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -582,7 +587,7 @@ Float64 Losses::PermanentStrand_AtShipping() const
 
 Float64 Losses::PermanentStrand_AfterTemporaryStrandInstallation() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -599,7 +604,7 @@ Float64 Losses::PermanentStrand_AfterTemporaryStrandInstallation() const
 
 Float64 Losses::PermanentStrand_BeforeTemporaryStrandRemoval() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -610,7 +615,7 @@ Float64 Losses::PermanentStrand_BeforeTemporaryStrandRemoval() const
 
 Float64 Losses::PermanentStrand_AfterTemporaryStrandRemoval() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -621,7 +626,7 @@ Float64 Losses::PermanentStrand_AfterTemporaryStrandRemoval() const
 
 Float64 Losses::PermanentStrand_AfterDeckPlacement() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -633,7 +638,7 @@ Float64 Losses::PermanentStrand_AfterDeckPlacement() const
 
 Float64 Losses::PermanentStrand_AfterSIDL() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -645,7 +650,7 @@ Float64 Losses::PermanentStrand_AfterSIDL() const
 
 Float64 Losses::PermanentStrand_Final() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -656,7 +661,7 @@ Float64 Losses::PermanentStrand_Final() const
 
 Float64 Losses::TemporaryStrand_BeforeTransfer() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -666,7 +671,7 @@ Float64 Losses::TemporaryStrand_BeforeTransfer() const
 
 Float64 Losses::TemporaryStrand_AfterTransfer() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -677,7 +682,7 @@ Float64 Losses::TemporaryStrand_AfterTransfer() const
 
 Float64 Losses::TemporaryStrand_AtLifting() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -699,7 +704,7 @@ Float64 Losses::TemporaryStrand_AtLifting() const
 
 Float64 Losses::TemporaryStrand_AtShipping() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -730,7 +735,7 @@ Float64 Losses::TemporaryStrand_AtShipping() const
 
 Float64 Losses::TemporaryStrand_AfterTemporaryStrandInstallation() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -750,7 +755,7 @@ Float64 Losses::TemporaryStrand_AfterTemporaryStrandInstallation() const
 
 Float64 Losses::TemporaryStrand_BeforeTemporaryStrandRemoval() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -761,7 +766,7 @@ Float64 Losses::TemporaryStrand_BeforeTemporaryStrandRemoval() const
 
 Float64 Losses::TemporaryStrand_AfterTemporaryStrandRemoval() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -771,7 +776,7 @@ Float64 Losses::TemporaryStrand_AfterTemporaryStrandRemoval() const
 
 Float64 Losses::TemporaryStrand_AfterDeckPlacement() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -781,7 +786,7 @@ Float64 Losses::TemporaryStrand_AfterDeckPlacement() const
 
 Float64 Losses::TemporaryStrand_AfterSIDL() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -791,7 +796,7 @@ Float64 Losses::TemporaryStrand_AfterSIDL() const
 
 Float64 Losses::TemporaryStrand_Final() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -801,7 +806,7 @@ Float64 Losses::TemporaryStrand_Final() const
 
 Float64 Losses::PermanentStrand_RelaxationLossesBeforeTransfer() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -811,7 +816,7 @@ Float64 Losses::PermanentStrand_RelaxationLossesBeforeTransfer() const
 
 Float64 Losses::PermanentStrand_ElasticShorteningLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -821,7 +826,7 @@ Float64 Losses::PermanentStrand_ElasticShorteningLosses() const
 
 Float64 Losses::TemporaryStrand_RelaxationLossesBeforeTransfer() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -831,7 +836,7 @@ Float64 Losses::TemporaryStrand_RelaxationLossesBeforeTransfer() const
 
 Float64 Losses::TemporaryStrand_ElasticShorteningLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -841,7 +846,7 @@ Float64 Losses::TemporaryStrand_ElasticShorteningLosses() const
 
 Float64 Losses::ElasticGainDueToDeckPlacement(bool bApplyElasticGainReduction) const
 {
-   if ( m_IsDirty ) 
+   if ( IsDirty() ) 
    {
       UpdateLosses();
    }
@@ -851,7 +856,7 @@ Float64 Losses::ElasticGainDueToDeckPlacement(bool bApplyElasticGainReduction) c
 
 Float64 Losses::ElasticGainDueToSIDL(bool bApplyElasticGainReduction) const
 {
-   if ( m_IsDirty ) 
+   if ( IsDirty() ) 
    {
       UpdateLosses();
    }
@@ -861,7 +866,7 @@ Float64 Losses::ElasticGainDueToSIDL(bool bApplyElasticGainReduction) const
 
 Float64 Losses::ElasticGainDueToDeckShrinkage() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -884,7 +889,7 @@ void Losses::GetDeckShrinkageEffects(Float64* pA,Float64* pM) const
 
 Float64 Losses::FrictionLoss() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -894,7 +899,7 @@ Float64 Losses::FrictionLoss() const
 
 Float64 Losses::TotalFrictionLoss() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -904,7 +909,7 @@ Float64 Losses::TotalFrictionLoss() const
 
 Float64 Losses::AnchorSetLoss() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -914,7 +919,7 @@ Float64 Losses::AnchorSetLoss() const
 
 Float64 Losses::TotalAnchorSetLoss() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -924,7 +929,7 @@ Float64 Losses::TotalAnchorSetLoss() const
 
 Float64 Losses::AnchorSetZone() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -934,7 +939,7 @@ Float64 Losses::AnchorSetZone() const
 
 Float64 Losses::GetFptMax() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -944,7 +949,7 @@ Float64 Losses::GetFptMax() const
 
 Float64 Losses::GetFptMin() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -954,7 +959,7 @@ Float64 Losses::GetFptMin() const
 
 Float64 Losses::GetFptAvg() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -964,7 +969,7 @@ Float64 Losses::GetFptAvg() const
 
 Float64 Losses::GetPptMax() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -974,7 +979,7 @@ Float64 Losses::GetPptMax() const
 
 Float64 Losses::GetPptMin() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -984,7 +989,7 @@ Float64 Losses::GetPptMin() const
 
 Float64 Losses::GetPptAvg() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -994,7 +999,7 @@ Float64 Losses::GetPptAvg() const
 
 Float64 Losses::GetDeltaFptAvg() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -1004,7 +1009,7 @@ Float64 Losses::GetDeltaFptAvg() const
 
 Float64 Losses::GetFcgpt() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -1014,7 +1019,7 @@ Float64 Losses::GetFcgpt() const
 
 Float64 Losses::GetDeltaFpt() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -1024,7 +1029,7 @@ Float64 Losses::GetDeltaFpt() const
 
 Float64 Losses::GetFptr() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -1034,7 +1039,7 @@ Float64 Losses::GetFptr() const
 
 Float64 Losses::GetDeltaFptr() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -1044,7 +1049,7 @@ Float64 Losses::GetDeltaFptr() const
 
 Float64 Losses::GetPtr() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -1054,7 +1059,7 @@ Float64 Losses::GetPtr() const
 
 Float64 Losses::GetFcgpp() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -1064,7 +1069,7 @@ Float64 Losses::GetFcgpp() const
 
 Float64 Losses::GetDeltaFpp() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -1074,7 +1079,7 @@ Float64 Losses::GetDeltaFpp() const
 
 Float64 Losses::GetDeltaFcd1(bool bApplyElasticGainReduction) const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -1084,7 +1089,7 @@ Float64 Losses::GetDeltaFcd1(bool bApplyElasticGainReduction) const
 
 Float64 Losses::GetDeltaFcd2(bool bApplyElasticGainReduction) const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -1099,7 +1104,7 @@ Float64 Losses::GetDeltaFcdLL(Float64 Mllim) const
 
 void Losses::UpdateLosses() const
 {
-   static bool bUpdating = false;
+   static thread_local bool bUpdating = false; // losses for different sections may be updated concurrently (see BatchLosses)
 
    if ( !bUpdating )
    {
@@ -1150,6 +1155,13 @@ void Losses::UpdateLosses() const
    }
 
    m_IsDirty = false;
+   m_Edition = BDSManager::GetEdition();
+   m_Units = BDSManager::GetUnits();
+}
+
+bool Losses::IsDirty() const
+{
+   return m_IsDirty || m_Edition != BDSManager::GetEdition() || m_Units != BDSManager::GetUnits();
 }
 
 
@@ -1230,7 +1242,19 @@ void Losses::UpdateRelaxationBeforeTransfer() const
 void Losses::UpdateElasticShortening() const
 {
    // Elastic shortening
-   WBFL::LRFD::ElasticShortening es(m_FpjPerm,
+   if (!m_bElasticShorteningEvaluated)
+   {
+      m_ElasticShortening = CreateElasticShortening();
+   }
+   m_bElasticShorteningEvaluated = false;
+
+   m_dfpES[TEMPORARY_STRAND] = m_ElasticShortening.TemporaryStrand_ElasticShorteningLosses();
+   m_dfpES[PERMANENT_STRAND] = m_ElasticShortening.PermanentStrand_ElasticShorteningLosses();
+}
+
+ElasticShortening Losses::CreateElasticShortening() const
+{
+   return WBFL::LRFD::ElasticShortening(m_FpjPerm,
                         (m_TempStrandUsage == TempStrandUsage::Pretensioned ? m_FpjTemp : 0),
                         m_dfpR0[PERMANENT_STRAND], // perm
                         m_dfpR0[TEMPORARY_STRAND], // temp
@@ -1248,11 +1272,6 @@ void Losses::UpdateElasticShortening() const
                         m_Eci,
                         m_Ep,
                         WBFL::LRFD::ElasticShortening::FcgpComputationMethod::Iterative);
-
-   m_ElasticShortening = es;
-
-   m_dfpES[TEMPORARY_STRAND] = m_ElasticShortening.TemporaryStrand_ElasticShorteningLosses();
-   m_dfpES[PERMANENT_STRAND] = m_ElasticShortening.PermanentStrand_ElasticShorteningLosses();
 }
 
 void Losses::UpdatePostTensionLosses() const
@@ -134,6 +134,17 @@ namespace LrfdUnitTests
          Assert::AreEqual(0., loss.TemporaryStrand_AfterSIDL(), 0.00001);
          Assert::AreEqual(0., loss.TemporaryStrand_Final(), 0.00001);
 
+         // Cached losses are recomputed when a BDSContext changes the edition
+         BDSManager::SetEdition(BDSManager::Edition::ThirdEditionWith2005Interims);
+         Assert::AreEqual(66096071.793492742, loss.PermanentStrand_AtShipping(), 0.00001);
+         {
+            BDSContext context(BDSManager::Edition::FourthEdition2007);
+            Assert::AreEqual(65923702.861163490, loss.PermanentStrand_AtShipping(), 0.00001);
+            Assert::AreEqual(190717810.47609794, loss.PermanentStrand_Final(), 0.00001);
+         }
+         Assert::AreEqual(66096071.793492742, loss.PermanentStrand_AtShipping(), 0.00001);
+         Assert::AreEqual(191407286.20541495, loss.PermanentStrand_Final(), 0.00001);
+
          // Concrete limit exceptions
          BDSManager::SetEdition(BDSManager::Edition::ThirdEditionWith2005Interims); // max f'c = 15 ksi
          loss.SetFc(WBFL::Units::ConvertToSysUnits(20.0, WBFL::Units::Measure::KSI));
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "CppUnitTest.h"
+#include <thread>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace WBFL::LRFD;
@@ -196,5 +197,47 @@ namespace LrfdUnitTests
          Assert::ExpectException<std::invalid_argument>([]() {BDSManager::UnregisterListener(nullptr); });
          Assert::ExpectException<std::invalid_argument>([&]() {BDSManager::UnregisterListener(&listener); }); // not currently registered
       }
+
+      TEST_METHOD(Context)
+      {
+         BDSAutoVersion av;
+
+         BDSManager::SetEdition(BDSManager::Edition::NinthEdition2020);
+         Assert::IsFalse(BDSManager::IsContextActive());
+         Assert::IsTrue(BDSContext::GetCurrent() == nullptr);
+
+         {
+            BDSContext context(BDSManager::Edition::SecondEdition1998, BDSManager::Units::SI);
+            Assert::IsTrue(BDSManager::IsContextActive());
+            Assert::IsTrue(BDSContext::GetCurrent() == &context);
+            Assert::IsTrue(BDSManager::Edition::SecondEdition1998 == BDSManager::GetEdition());
+            Assert::IsTrue(BDSManager::Units::SI == BDSManager::GetUnits());
+            Assert::AreEqual(_T("AashtoLrfd1998"), BDSManager::GetEditionAsString(true));
+            Assert::AreEqual(_T("SI Units"), BDSManager::GetUnitAsString());
+
+            {
+               // nested context, SI units are forced to US
+               BDSContext nested(BDSManager::Edition::FourthEdition2007, BDSManager::Units::SI);
+               Assert::IsTrue(BDSManager::Edition::FourthEdition2007 == BDSManager::GetEdition());
+               Assert::IsTrue(BDSManager::Units::US == BDSManager::GetUnits());
+            }
+            Assert::IsTrue(BDSManager::Edition::SecondEdition1998 == BDSManager::GetEdition());
+
+            // other threads use the global settings
+            BDSManager::Edition edition = BDSManager::Edition::FirstEdition1994;
+            std::thread other([&edition]() {edition = BDSManager::GetEdition(); });
+            other.join();
+            Assert::IsTrue(BDSManager::Edition::NinthEdition2020 == edition);
+
+            // contexts on other threads don't interfere with this thread
+            std::thread other_context([&edition]() {BDSContext context(BDSManager::Edition::FifthEdition2010); edition = BDSManager::GetEdition(); });
+            other_context.join();
+            Assert::IsTrue(BDSManager::Edition::FifthEdition2010 == edition);
+            Assert::IsTrue(BDSManager::Edition::SecondEdition1998 == BDSManager::GetEdition());
+         }
+
+         Assert::IsFalse(BDSManager::IsContextActive());
+         Assert::IsTrue(BDSManager::Edition::NinthEdition2020 == BDSManager::GetEdition());
+      }
 	};
 }
@@ -0,0 +1,219 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <System/Threads.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace WBFL::LRFD;
+
+namespace LrfdUnitTests
+{
+	TEST_CLASS(TestBatchLosses)
+	{
+	public:
+		
+		TEST_METHOD(Test)
+		{
+         std::shared_ptr<CreepCoefficient2005> pGirderCreep = std::make_shared<CreepCoefficient2005>();
+         pGirderCreep->SetCuringMethod(CreepCoefficient2005::CuringMethod::Accelerated);
+         pGirderCreep->SetCuringMethodTimeAdjustmentFactor(WBFL::Units::ConvertToSysUnits(7, WBFL::Units::Measure::Day));
+         pGirderCreep->SetFci(35852736.609413415);
+         pGirderCreep->SetRelHumidity(75);
+         pGirderCreep->SetSurfaceArea(6.9711699425657105);
+         pGirderCreep->SetVolume(0.56485774124999988);
+         pGirderCreep->SetK1(1.0);
+         pGirderCreep->SetK2(1.0);
+
+         std::shared_ptr<CreepCoefficient2005> pDeckCreep = std::make_shared<CreepCoefficient2005>();
+         pDeckCreep->SetCuringMethod(CreepCoefficient2005::CuringMethod::Normal);
+         pDeckCreep->SetCuringMethodTimeAdjustmentFactor(WBFL::Units::ConvertToSysUnits(7, WBFL::Units::Measure::Day));
+         pDeckCreep->SetFci(0.8 * 27579029.172680002); // deck is non-prestressed. Use 80% of strength. See NCHRP 496 (page 27 and 30)
+         pDeckCreep->SetRelHumidity(75);
+         pDeckCreep->SetSurfaceArea(1.8288000000760127);
+         pDeckCreep->SetVolume(0.32516064001351508);
+         pDeckCreep->SetK1(1.0);
+         pDeckCreep->SetK2(1.0);
+
+
+         RefinedLosses2005 loss(19.5072, // location along girder where losses are computed
+            39.0144,    // girder length
+            RefinedLosses2005::SectionPropertiesType::Gross,
+            WBFL::Materials::PsStrand::Grade::Gr1860,
+            WBFL::Materials::PsStrand::Type::LowRelaxation,
+            WBFL::Materials::PsStrand::Coating::None,
+            WBFL::Materials::PsStrand::Grade::Gr1860,
+            WBFL::Materials::PsStrand::Type::LowRelaxation,
+            WBFL::Materials::PsStrand::Coating::None,
+            1396186227.0505831, // fpj permanent strands
+            1396188385.8038988, // fpj of temporary strands
+            0.0051799896399999995,  // area of permanent strand
+            0.00055999887999999998,  // area of TTS 
+            0.00013999972000000000,      // area of one strand
+            WBFL::Geometry::Point2d(0, 0.73344249937779116), // eccentricity of permanent ps strands with respect to CG of girder
+            WBFL::Geometry::Point2d(0, 0.73344249937779116), // eccentricity of permanent ps strands with respect to CG of girder
+            WBFL::Geometry::Point2d(0, -0.81870344656815441), // eccentricity of temporary strands with respect to CG of girder
+
+            RefinedLosses2005::TempStrandUsage::Pretensioned, // temporary strand usage
+
+            0.0095250000000000005, // anchor set
+            0.00065616797900200005, // wobble
+            0.25000000000000000, // friction
+            0, // angle change
+
+            1, 1, // K for girder
+            1, 1, // K fog slab
+
+            41368543.759020001,   // 28 day strength of girder concrete
+            35852736.609413415,  // Release strength
+            27579029.172680002,
+            35668801112.349388,   // Modulus of elasticity of girder
+            33205846111.428368,  // Modulus of elasticity of girder at transfer
+            29123454154.024353,  // Modulus of elasticity of deck
+
+            // Gross
+            0.56485774124999988,   // area of girder
+            0.23197765412628035,   // moment of inertia of girder Ixx
+            0.23197765412628035,   // moment of inertia of girder Iyy
+            0.0, // Ixy
+            0.80689655343184530,  // Centroid of girder measured from bottom
+            0.83035029207347855,   // area of composite girder
+            0.39856959307884982,   // moment of inertia of composite
+            1.1133322567444859,  // Centroid of composite measured from bottom
+            0.83035029207347855,   // area of composite girder
+            0.39856959307884982,   // moment of inertia of composite
+            1.1133322567444859,  // Centroid of composite measured from bottom
+
+            // Net
+            0.56485774124999988,   // area of girder
+            0.23197765412628035,   // moment of inertia of girder
+            0.23197765412628035,   // moment of inertia of girder Iyy
+            0.0, // Ixy
+            0.80689655343184530,  // Centroid of girder measured from bottom
+            0.83035029207347855,   // area of composite girder
+            0.39856959307884982,   // moment of inertia of composite
+            1.1133322567444859,  // Centroid of composite measured from bottom
+
+            0.34838640001448046,   // area of deck
+            -0.65196774325551399,   // eccentricity of deck CG with respect to CG of composite
+            1.0,
+
+            2701223.1744837998,  // Dead load moment of girder only
+            std::vector<std::pair<Float64, Float64>>{std::make_pair(2144430.8154568151, 1.0)},  // Additional dead load on girder section
+            std::vector<std::pair<Float64, Float64>>{std::make_pair(0, 1.0)},
+            std::vector<std::pair<Float64, Float64>>{std::make_pair(494526.00384487113, 1.0)}, // Superimposed dead loads
+
+            75,  // Relative humidity [0,100]
+            86400.000000000000,   // Time until prestress transfer
+            864000.00000000000,   // Time at hauling
+            10368000.000000000,   // Time to deck placement
+            172800000.00000000,   // Final time
+            false, true, RefinedLosses2005::RelaxationLossMethod::Refined,
+            std::shared_ptr<const CreepCoefficient2005>(pGirderCreep),
+            std::shared_ptr<const CreepCoefficient2005>(pDeckCreep)
+         );
+
+         // vary the section properties, strand eccentricity, and moments along the girder
+         std::vector<LossesSection> vSections;
+         IndexType nSections = 11;
+         for (IndexType i = 0; i < nSections; i++)
+         {
+            Float64 x = 39.0144 * i / (nSections - 1);
+            Float64 f = 4 * x * (39.0144 - x) / (39.0144 * 39.0144); // parabolic variation, 0 at ends, 1 at mid-span
+
+            LossesSection section;
+            section.X = x;
+            section.epermRelease = WBFL::Geometry::Point2d(0, 0.5 + 0.23344249937779116 * f);
+            section.epermFinal = section.epermRelease;
+            section.etemp = WBFL::Geometry::Point2d(0, -0.81870344656815441);
+            section.Mdlg = 2701223.1744837998 * f;
+            section.Madlg.emplace_back(2144430.8154568151 * f, 1.0);
+            section.Msidl1.emplace_back(0, 1.0);
+            section.Msidl2.emplace_back(494526.00384487113 * f, 1.0);
+            section.Ag = (i == 0 || i == nSections - 1) ? 0.7 : 0.56485774124999988;
+            section.Ybg = 0.80689655343184530;
+            section.Ixx = 0.23197765412628035;
+            section.Iyy = 0.23197765412628035;
+            section.Ixy = 0.0;
+            section.Ac1 = 0.83035029207347855;
+            section.Ybc1 = 1.1133322567444859;
+            section.Ic1 = 0.39856959307884982;
+            section.Ac2 = section.Ac1;
+            section.Ybc2 = section.Ybc1;
+            section.Ic2 = section.Ic1;
+            section.An = section.Ag;
+            section.Ybn = section.Ybg;
+            section.Ixxn = section.Ixx;
+            section.Iyyn = section.Iyy;
+            section.Ixyn = section.Ixy;
+            section.Acn = section.Ac1;
+            section.Ybcn = section.Ybc1;
+            section.Icn = section.Ic1;
+            vSections.push_back(section);
+         }
+
+         auto set_deck = [](IndexType sectionIdx, RefinedLosses2005& losses) { losses.SetDeckEccentricity(-0.65196774325551399 + 0.001 * sectionIdx); };
+
+         BDSContext context(BDSManager::Edition::ThirdEditionWith2005Interims, BDSManager::Units::US);
+
+         // use worker threads, even for a small number of sections
+         IndexType minItemsPerThread = WBFL::System::Threads::GetMinItemsPerThread();
+         WBFL::System::Threads::SetMinItemsPerThread(2);
+         auto results = BatchLosses::Evaluate(loss, vSections, set_deck);
+         WBFL::System::Threads::SetMinItemsPerThread(minItemsPerThread);
+
+         // the batch results must be identical to losses computed one section at a time
+         for (IndexType i = 0; i < nSections; i++)
+         {
+            RefinedLosses2005 section_loss(loss);
+            BatchLosses::SetSection(section_loss, vSections[i]);
+            set_deck(i, section_loss);
+
+            Assert::AreEqual(section_loss.PermanentStrand_BeforeTransfer(), results.GetLosses(PERMANENT_STRAND, BatchLosses::Stage::BeforeTransfer)[i]);
+            Assert::AreEqual(section_loss.PermanentStrand_AfterTransfer(), results.GetLosses(PERMANENT_STRAND, BatchLosses::Stage::AfterTransfer)[i]);
+            Assert::AreEqual(section_loss.PermanentStrand_AtLifting(), results.GetLosses(PERMANENT_STRAND, BatchLosses::Stage::AtLifting)[i]);
+            Assert::AreEqual(section_loss.PermanentStrand_AtShipping(), results.GetLosses(PERMANENT_STRAND, BatchLosses::Stage::AtShipping)[i]);
+            Assert::AreEqual(section_loss.PermanentStrand_AfterTemporaryStrandInstallation(), results.GetLosses(PERMANENT_STRAND, BatchLosses::Stage::AfterTemporaryStrandInstallation)[i]);
+            Assert::AreEqual(section_loss.PermanentStrand_BeforeTemporaryStrandRemoval(), results.GetLosses(PERMANENT_STRAND, BatchLosses::Stage::BeforeTemporaryStrandRemoval)[i]);
+            Assert::AreEqual(section_loss.PermanentStrand_AfterTemporaryStrandRemoval(), results.GetLosses(PERMANENT_STRAND, BatchLosses::Stage::AfterTemporaryStrandRemoval)[i]);
+            Assert::AreEqual(section_loss.PermanentStrand_AfterDeckPlacement(), results.GetLosses(PERMANENT_STRAND, BatchLosses::Stage::AfterDeckPlacement)[i]);
+            Assert::AreEqual(section_loss.PermanentStrand_AfterSIDL(), results.GetLosses(PERMANENT_STRAND, BatchLosses::Stage::AfterSIDL)[i]);
+            Assert::AreEqual(section_loss.PermanentStrand_Final(), results.GetLosses(PERMANENT_STRAND, BatchLosses::Stage::Final)[i]);
+
+            Assert::AreEqual(section_loss.TemporaryStrand_BeforeTransfer(), results.GetLosses(TEMPORARY_STRAND, BatchLosses::Stage::BeforeTransfer)[i]);
+            Assert::AreEqual(section_loss.TemporaryStrand_AtShipping(), results.GetLosses(TEMPORARY_STRAND, BatchLosses::Stage::AtShipping)[i]);
+            Assert::AreEqual(section_loss.TemporaryStrand_Final(), results.GetLosses(TEMPORARY_STRAND, BatchLosses::Stage::Final)[i]);
+
+            Assert::AreEqual(section_loss.PermanentStrand_ElasticShorteningLosses(), results.ElasticShorteningLosses[PERMANENT_STRAND][i]);
+            Assert::AreEqual(section_loss.TemporaryStrand_ElasticShorteningLosses(), results.ElasticShorteningLosses[TEMPORARY_STRAND][i]);
+            Assert::AreEqual(section_loss.GetElasticShortening().PermanentStrand_Fcgp(), results.Fcgp[PERMANENT_STRAND][i]);
+         }
+      }
+
+      TEST_METHOD(ElasticShorteningBatch)
+      {
+         // Batch evaluation of elastic shortening must match evaluation of each section
+         std::vector<WBFL::LRFD::ElasticShortening> vES;
+         for (int i = 0; i < 5; i++)
+         {
+            bool bGross = (i != 3);
+            Float64 fpjTemp = (i == 2 ? 0.0 : 1396188385.8038988);
+            vES.emplace_back(1396186227.0505831, fpjTemp, 0.0, 0.0, 0.0051799896399999995, 0.00055999887999999998, bGross,
+               0.56485774124999988, 0.23197765412628035, 0.23197765412628035, 0.01 * i,
+               WBFL::Geometry::Point2d(0.01 * i, 0.73344249937779116), WBFL::Geometry::Point2d(0, -0.81870344656815441),
+               2701223.1744837998 * i / 4, 1.0, 33205846111.428368, 196500582355.0, WBFL::LRFD::ElasticShortening::FcgpComputationMethod::Iterative);
+         }
+         vES.emplace_back(); // no prestress
+
+         std::vector<WBFL::LRFD::ElasticShortening> vExpected(vES);
+         WBFL::LRFD::ElasticShortening::Evaluate(vES);
+
+         for (IndexType i = 0; i < vES.size(); i++)
+         {
+            Assert::AreEqual(vExpected[i].PermanentStrand_ElasticShorteningLosses(), vES[i].PermanentStrand_ElasticShorteningLosses());
+            Assert::AreEqual(vExpected[i].TemporaryStrand_ElasticShorteningLosses(), vES[i].TemporaryStrand_ElasticShorteningLosses());
+            Assert::AreEqual(vExpected[i].PermanentStrand_Fcgp(), vES[i].PermanentStrand_Fcgp());
+            Assert::AreEqual(vExpected[i].TemporaryStrand_Fcgp(), vES[i].TemporaryStrand_Fcgp());
+            Assert::AreEqual(vExpected[i].P(), vES[i].P());
+         }
+      }
+	};
+}
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "CppUnitTest.h"
+#include <System/Threads.h>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace WBFL::LRFD;
@@ -279,5 +280,87 @@ namespace LrfdUnitTests
          Assert::AreEqual((IndexType)2, result.nLanesUsed);
          Assert::AreEqual((IndexType)6, result.Nb);
       }
+      TEST_METHOD(DFTable)
+      {
+         BDSAutoVersion av;
+         BDSManager::SetEdition(BDSManager::Edition::NinthEdition2020);
+         BDSManager::SetUnits(BDSManager::Units::US);
+
+         Float64 S = WBFL::Units::ConvertToSysUnits(8., WBFL::Units::Measure::Feet);
+         Float64 de = WBFL::Units::ConvertToSysUnits(2., WBFL::Units::Measure::Feet);
+         Float64 wLane = WBFL::Units::ConvertToSysUnits(12., WBFL::Units::Measure::Feet);
+         Float64 L = WBFL::Units::ConvertToSysUnits(151., WBFL::Units::Measure::Feet);
+         Float64 ts = WBFL::Units::ConvertToSysUnits(7.5, WBFL::Units::Measure::Inch);
+         Float64 n = 1.54;
+         Float64 I = WBFL::Units::ConvertToSysUnits(960951.2, WBFL::Units::Measure::Inch4);
+         Float64 A = WBFL::Units::ConvertToSysUnits(977.359, WBFL::Units::Measure::Inch2);
+         Float64 eg = WBFL::Units::ConvertToSysUnits(46.587, WBFL::Units::Measure::Inch);
+         GirderIndexType Nb = 7;
+         Int16 Nl = 4;
+         std::vector<Float64> spacings(Nb - 1, S);
+
+         // cross frames so the rigid method is used for exterior girders
+         std::vector<std::unique_ptr<LiveLoadDistributionFactorBase>> vGirders;
+         for (GirderIndexType gdr = 0; gdr < Nb; gdr++)
+         {
+            vGirders.emplace_back(std::make_unique<LldfTypeAEK>(gdr, S, spacings, de, de, Nl, wLane, L, ts, n, I, A, eg, true, 0.0, 0.0, false, false));
+         }
+
+         // use worker threads, even for a small number of girders
+         IndexType minItemsPerThread = WBFL::System::Threads::GetMinItemsPerThread();
+         WBFL::System::Threads::SetMinItemsPerThread(2);
+         auto vTables = LiveLoadDistributionFactorBase::GetDFTables(vGirders);
+         WBFL::System::Threads::SetMinItemsPerThread(minItemsPerThread);
+
+         Assert::AreEqual((size_t)Nb, vTables.size());
+
+         // the tables must be identical to factors computed one at a time
+         std::vector<LimitState> vLimitStates{ LimitState::StrengthI, LimitState::ServiceI, LimitState::FatigueI };
+         for (GirderIndexType gdr = 0; gdr < Nb; gdr++)
+         {
+            LldfTypeAEK df(gdr, S, spacings, de, de, Nl, wLane, L, ts, n, I, A, eg, true, 0.0, 0.0, false, false);
+            for (auto loc : { ILiveLoadDistributionFactor::Location::IntGirder, ILiveLoadDistributionFactor::Location::ExtGirder })
+            {
+               for (auto numLanes : { ILiveLoadDistributionFactor::NumLoadedLanes::One, ILiveLoadDistributionFactor::NumLoadedLanes::TwoOrMore })
+               {
+                  for (auto ls : vLimitStates)
+                  {
+                     auto moment = df.MomentDFEx(loc, numLanes, ls);
+                     auto shear = df.ShearDFEx(loc, numLanes, ls);
+                     auto reaction = df.ReactionDFEx(loc, numLanes, ls);
+
+                     const auto& table_moment = vTables[gdr].GetDF(loc, ILiveLoadDistributionFactor::Effect::Moment, numLanes, ls);
+                     const auto& table_shear = vTables[gdr].GetDF(loc, ILiveLoadDistributionFactor::Effect::Shear, numLanes, ls);
+                     const auto& table_reaction = vTables[gdr].GetDF(loc, ILiveLoadDistributionFactor::Effect::Reaction, numLanes, ls);
+
+                     Assert::AreEqual(moment.mg, table_moment.mg);
+                     Assert::AreEqual(moment.ControllingMethod, table_moment.ControllingMethod);
+                     Assert::AreEqual(moment.RigidData.mg, table_moment.RigidData.mg);
+                     Assert::AreEqual(moment.LeverRuleData.mg, table_moment.LeverRuleData.mg);
+                     Assert::AreEqual(shear.mg, table_shear.mg);
+                     Assert::AreEqual(shear.ControllingMethod, table_shear.ControllingMethod);
+                     Assert::AreEqual(reaction.mg, table_reaction.mg);
+                     Assert::AreEqual(reaction.ControllingMethod, table_reaction.ControllingMethod);
+                  }
+               }
+            }
+         }
+      }
+
+      TEST_METHOD(LeverRuleCache)
+      {
+         WBFL::Units::AutoSystem au;
+         WBFL::Units::System::SetMassUnit(WBFL::Units::Measure::PoundMass);
+         WBFL::Units::System::SetLengthUnit(WBFL::Units::Measure::Feet);
+         WBFL::Units::System::SetAngleUnit(WBFL::Units::Measure::Radian);
+
+         // lever rule results are cached, but changing the multiple presence factor treatment must not return a stale result
+         TestLLDF lldf(0, 8.0, std::vector<Float64>{8.0, 8.0, 8.0, 8.0, 8.0}, 7.0, 7.0, 4, 12.0, true, true);
+         auto first = lldf.DistributeByLeverRuleEx(LiveLoadDistributionFactorBase::Location::ExtGirder, LiveLoadDistributionFactorBase::NumLoadedLanes::One, true);
+         lldf.IgnoreMpfLeverRule(true);
+         auto second = lldf.DistributeByLeverRuleEx(LiveLoadDistributionFactorBase::Location::ExtGirder, LiveLoadDistributionFactorBase::NumLoadedLanes::One, true);
+         Assert::AreEqual(1.5, first.mg, 0.001);
+         Assert::AreEqual(1.25, second.mg, 0.001);
+      }
    };
 }
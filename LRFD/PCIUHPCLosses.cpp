@@ -126,7 +126,7 @@ RefinedLosses2005(x, Lg, sectionProperties, gradePerm, typePerm, coatingPerm, gr
 
 Float64 PCIUHPCLosses::TemporaryStrand_AutogenousShrinkage() const
 {
-   if ( m_IsDirty ) 
+   if ( IsDirty() ) 
    {
       UpdateLosses();
    }
@@ -135,7 +135,7 @@ Float64 PCIUHPCLosses::TemporaryStrand_AutogenousShrinkage() const
 
 Float64 PCIUHPCLosses::PermanentStrand_AutogenousShrinkage() const
 {
-   if (m_IsDirty)
+   if (IsDirty())
    {
       UpdateLosses();
    }
@@ -137,7 +137,7 @@ Float64 RefinedLosses::TimeDependentLossesAfterDeck() const
 
 Float64 RefinedLosses::TimeDependentLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -147,7 +147,7 @@ Float64 RefinedLosses::TimeDependentLosses() const
 
 Float64 RefinedLosses::ShrinkageLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -157,7 +157,7 @@ Float64 RefinedLosses::ShrinkageLosses() const
 
 Float64 RefinedLosses::CreepLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -167,7 +167,7 @@ Float64 RefinedLosses::CreepLosses() const
 
 Float64 RefinedLosses::TemporaryStrand_RelaxationLossesAtXfer() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -177,7 +177,7 @@ Float64 RefinedLosses::TemporaryStrand_RelaxationLossesAtXfer() const
 
 Float64 RefinedLosses::PermanentStrand_RelaxationLossesAtXfer() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -187,7 +187,7 @@ Float64 RefinedLosses::PermanentStrand_RelaxationLossesAtXfer() const
 
 Float64 RefinedLosses::RelaxationLossesAfterXfer() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -197,7 +197,7 @@ Float64 RefinedLosses::RelaxationLossesAfterXfer() const
 
 Float64 RefinedLosses::TemporaryStrand_ImmediatelyBeforeXferLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -207,7 +207,7 @@ Float64 RefinedLosses::TemporaryStrand_ImmediatelyBeforeXferLosses() const
 
 Float64 RefinedLosses::PermanentStrand_ImmediatelyBeforeXferLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -217,7 +217,7 @@ Float64 RefinedLosses::PermanentStrand_ImmediatelyBeforeXferLosses() const
 
 Float64 RefinedLosses::TemporaryStrand_ImmediatelyAfterXferLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -227,7 +227,7 @@ Float64 RefinedLosses::TemporaryStrand_ImmediatelyAfterXferLosses() const
 
 Float64 RefinedLosses::PermanentStrand_ImmediatelyAfterXferLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
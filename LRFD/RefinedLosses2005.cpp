@@ -145,7 +145,7 @@ m_pGirderCreep(pGirderCreep),m_pDeckCreep(pDeckCreep)
 
 Float64 RefinedLosses2005::TemporaryStrand_ShrinkageLossAtShipping() const
 {
-   if ( m_IsDirty ) 
+   if ( IsDirty() ) 
    {
       UpdateLosses();
    }
@@ -154,7 +154,7 @@ Float64 RefinedLosses2005::TemporaryStrand_ShrinkageLossAtShipping() const
 
 Float64 RefinedLosses2005::TemporaryStrand_CreepLossAtShipping() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -163,7 +163,7 @@ Float64 RefinedLosses2005::TemporaryStrand_CreepLossAtShipping() const
 
 Float64 RefinedLosses2005::TemporaryStrand_RelaxationLossAtShipping() const
 {
-   if ( m_IsDirty ) 
+   if ( IsDirty() ) 
    {
       UpdateLosses();
    }
@@ -172,7 +172,7 @@ Float64 RefinedLosses2005::TemporaryStrand_RelaxationLossAtShipping() const
 
 Float64 RefinedLosses2005::PermanentStrand_ShrinkageLossAtShipping() const
 {
-   if ( m_IsDirty ) 
+   if ( IsDirty() ) 
    {
       UpdateLosses();
    }
@@ -181,7 +181,7 @@ Float64 RefinedLosses2005::PermanentStrand_ShrinkageLossAtShipping() const
 
 Float64 RefinedLosses2005::PermanentStrand_CreepLossAtShipping() const
 {
-   if ( m_IsDirty ) 
+   if ( IsDirty() ) 
    {
       UpdateLosses();
    }
@@ -190,7 +190,7 @@ Float64 RefinedLosses2005::PermanentStrand_CreepLossAtShipping() const
 
 Float64 RefinedLosses2005::PermanentStrand_RelaxationLossAtShipping() const
 {
-   if ( m_IsDirty ) 
+   if ( IsDirty() ) 
    {
       UpdateLosses();
    }
@@ -199,7 +199,7 @@ Float64 RefinedLosses2005::PermanentStrand_RelaxationLossAtShipping() const
 
 Float64 RefinedLosses2005::ShrinkageLossBeforeDeckPlacement() const
 {
-   if ( m_IsDirty ) 
+   if ( IsDirty() ) 
    {
       UpdateLosses();
    }
@@ -208,7 +208,7 @@ Float64 RefinedLosses2005::ShrinkageLossBeforeDeckPlacement() const
 
 Float64 RefinedLosses2005::CreepLossBeforeDeckPlacement() const
 {
-   if ( m_IsDirty ) 
+   if ( IsDirty() ) 
    {
       UpdateLosses();
    }
@@ -217,7 +217,7 @@ Float64 RefinedLosses2005::CreepLossBeforeDeckPlacement() const
 
 Float64 RefinedLosses2005::RelaxationLossBeforeDeckPlacement() const
 {
-   if ( m_IsDirty ) 
+   if ( IsDirty() ) 
    {
       UpdateLosses();
    }
@@ -226,7 +226,7 @@ Float64 RefinedLosses2005::RelaxationLossBeforeDeckPlacement() const
 
 Float64 RefinedLosses2005::ShrinkageLossAfterDeckPlacement() const
 {
-   if ( m_IsDirty ) 
+   if ( IsDirty() ) 
    {
       UpdateLosses();
    }
@@ -235,7 +235,7 @@ Float64 RefinedLosses2005::ShrinkageLossAfterDeckPlacement() const
 
 Float64 RefinedLosses2005::CreepLossAfterDeckPlacement() const
 {
-   if ( m_IsDirty ) 
+   if ( IsDirty() ) 
    {
       UpdateLosses();
    }
@@ -244,7 +244,7 @@ Float64 RefinedLosses2005::CreepLossAfterDeckPlacement() const
 
 Float64 RefinedLosses2005::RelaxationLossAfterDeckPlacement() const
 {
-   if ( m_IsDirty ) 
+   if ( IsDirty() ) 
    {
       UpdateLosses();
    }
@@ -253,7 +253,7 @@ Float64 RefinedLosses2005::RelaxationLossAfterDeckPlacement() const
 
 Float64 RefinedLosses2005::TemporaryStrand_TimeDependentLossesAtShipping() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -263,7 +263,7 @@ Float64 RefinedLosses2005::TemporaryStrand_TimeDependentLossesAtShipping() const
 
 Float64 RefinedLosses2005::PermanentStrand_TimeDependentLossesAtShipping() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -273,7 +273,7 @@ Float64 RefinedLosses2005::PermanentStrand_TimeDependentLossesAtShipping() const
 
 Float64 RefinedLosses2005::TimeDependentLossesBeforeDeck() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -283,7 +283,7 @@ Float64 RefinedLosses2005::TimeDependentLossesBeforeDeck() const
 
 Float64 RefinedLosses2005::TimeDependentLossesAfterDeck() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -309,7 +309,7 @@ std::shared_ptr<const CreepCoefficient2005> RefinedLosses2005::GetDeckCreep() co
 
 Float64 RefinedLosses2005::GetTemporaryStrandFcgp() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -319,7 +319,7 @@ Float64 RefinedLosses2005::GetTemporaryStrandFcgp() const
 
 Float64 RefinedLosses2005::GetPermanentStrandFcgp() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -329,7 +329,7 @@ Float64 RefinedLosses2005::GetPermanentStrandFcgp() const
 
 Float64 RefinedLosses2005::GetTemporaryStrandFpt() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -339,7 +339,7 @@ Float64 RefinedLosses2005::GetTemporaryStrandFpt() const
 
 Float64 RefinedLosses2005::GetPermanentStrandFpt() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -349,7 +349,7 @@ Float64 RefinedLosses2005::GetPermanentStrandFpt() const
 
 Float64 RefinedLosses2005::GetDeltaFcd() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -359,7 +359,7 @@ Float64 RefinedLosses2005::GetDeltaFcd() const
 
 Float64 RefinedLosses2005::GetDeltaFcdf() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -379,7 +379,7 @@ Float64 RefinedLosses2005::Getkhs_Deck() const
 
 Float64 RefinedLosses2005::Get_ebid() const
 {
-    if ( m_IsDirty )
+    if ( IsDirty() )
     {
         UpdateLosses();
     }
@@ -389,7 +389,7 @@ Float64 RefinedLosses2005::Get_ebid() const
 
 Float64 RefinedLosses2005::Get_ebih() const
 {
-    if ( m_IsDirty )
+    if ( IsDirty() )
     {
         UpdateLosses();
     }
@@ -399,7 +399,7 @@ Float64 RefinedLosses2005::Get_ebih() const
 
 Float64 RefinedLosses2005::GetKid() const
 {
-    if ( m_IsDirty )
+    if ( IsDirty() )
     {
         UpdateLosses();
     }
@@ -409,7 +409,7 @@ Float64 RefinedLosses2005::GetKid() const
 
 Float64 RefinedLosses2005::GetTemporaryStrandKih() const
 {
-    if ( m_IsDirty )
+    if ( IsDirty() )
     {
         UpdateLosses();
     }
@@ -419,7 +419,7 @@ Float64 RefinedLosses2005::GetTemporaryStrandKih() const
 
 Float64 RefinedLosses2005::GetPermanentStrandKih() const
 {
-    if ( m_IsDirty )
+    if ( IsDirty() )
     {
         UpdateLosses();
     }
@@ -429,7 +429,7 @@ Float64 RefinedLosses2005::GetPermanentStrandKih() const
 
 Float64 RefinedLosses2005::GetTemporaryStrandKL() const
 {
-    if ( m_IsDirty )
+    if ( IsDirty() )
     {
         UpdateLosses();
     }
@@ -439,7 +439,7 @@ Float64 RefinedLosses2005::GetTemporaryStrandKL() const
 
 Float64 RefinedLosses2005::GetPermanentStrandKL() const
 {
-    if ( m_IsDirty )
+    if ( IsDirty() )
     {
         UpdateLosses();
     }
@@ -449,7 +449,7 @@ Float64 RefinedLosses2005::GetPermanentStrandKL() const
 
 Float64 RefinedLosses2005::Get_ebdf() const
 {
-    if ( m_IsDirty )
+    if ( IsDirty() )
     {
         UpdateLosses();
     }
@@ -459,7 +459,7 @@ Float64 RefinedLosses2005::Get_ebdf() const
 
 Float64 RefinedLosses2005::Get_ebif() const
 {
-    if ( m_IsDirty )
+    if ( IsDirty() )
     {
         UpdateLosses();
     }
@@ -469,7 +469,7 @@ Float64 RefinedLosses2005::Get_ebif() const
 
 Float64 RefinedLosses2005::GetKdf() const
 {
-    if ( m_IsDirty )
+    if ( IsDirty() )
     {
         UpdateLosses();
     }
@@ -479,7 +479,7 @@ Float64 RefinedLosses2005::GetKdf() const
 
 Float64 RefinedLosses2005::Get_eddf() const
 {
-    if ( m_IsDirty )
+    if ( IsDirty() )
     {
         UpdateLosses();
     }
@@ -572,7 +572,7 @@ RefinedLosses2005::RelaxationLossMethod RefinedLosses2005::GetRelaxationLossMeth
 
 void RefinedLosses2005::GetDeckShrinkageEffects(Float64* pA,Float64* pM) const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
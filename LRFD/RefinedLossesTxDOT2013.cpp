@@ -141,7 +141,7 @@ Float64 RefinedLossesTxDOT2013::TimeDependentLossesAfterDeck() const
 
 Float64 RefinedLossesTxDOT2013::TimeDependentLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -151,7 +151,7 @@ Float64 RefinedLossesTxDOT2013::TimeDependentLosses() const
 
 Float64 RefinedLossesTxDOT2013::ShrinkageLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -161,7 +161,7 @@ Float64 RefinedLossesTxDOT2013::ShrinkageLosses() const
 
 Float64 RefinedLossesTxDOT2013::CreepLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -171,7 +171,7 @@ Float64 RefinedLossesTxDOT2013::CreepLosses() const
 
 Float64 RefinedLossesTxDOT2013::RelaxationLossBeforeDeckPlacement() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -180,7 +180,7 @@ Float64 RefinedLossesTxDOT2013::RelaxationLossBeforeDeckPlacement() const
 
 Float64 RefinedLossesTxDOT2013::RelaxationLossAfterDeckPlacement() const
 {
-   if ( m_IsDirty ) 
+   if ( IsDirty() ) 
    {
       UpdateLosses();
    }
@@ -189,7 +189,7 @@ Float64 RefinedLossesTxDOT2013::RelaxationLossAfterDeckPlacement() const
 
 Float64 RefinedLossesTxDOT2013::TemporaryStrand_ImmediatelyBeforeXferLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -199,7 +199,7 @@ Float64 RefinedLossesTxDOT2013::TemporaryStrand_ImmediatelyBeforeXferLosses() co
 
 Float64 RefinedLossesTxDOT2013::PermanentStrand_ImmediatelyBeforeXferLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -209,7 +209,7 @@ Float64 RefinedLossesTxDOT2013::PermanentStrand_ImmediatelyBeforeXferLosses() co
 
 Float64 RefinedLossesTxDOT2013::TemporaryStrand_ImmediatelyAfterXferLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -219,7 +219,7 @@ Float64 RefinedLossesTxDOT2013::TemporaryStrand_ImmediatelyAfterXferLosses() con
 
 Float64 RefinedLossesTxDOT2013::PermanentStrand_ImmediatelyAfterXferLosses() const
 {
-   if ( m_IsDirty )
+   if ( IsDirty() )
    {
       UpdateLosses();
    }
@@ -281,10 +281,10 @@ void RefinedLossesTxDOT2013::UpdateHaulingLosses() const
    UpdateLongTermLosses();
 }
 
-void RefinedLossesTxDOT2013::UpdateElasticShortening() const
+ElasticShortening RefinedLossesTxDOT2013::CreateElasticShortening() const
 {
    // Elastic shortening
-   ElasticShortening es(m_FpjPerm,
+   return ElasticShortening(m_FpjPerm,
                             (m_TempStrandUsage == TempStrandUsage::Pretensioned ? m_FpjTemp : 0),
                             m_dfpR0[PERMANENT_STRAND], // perm
                             m_dfpR0[TEMPORARY_STRAND], // temp
@@ -302,16 +302,11 @@ void RefinedLossesTxDOT2013::UpdateElasticShortening() const
                             m_Eci,
                             m_Ep,
                             m_FcgpMethod);
-
-   m_ElasticShortening = es;
-
-   m_dfpES[TEMPORARY_STRAND] = m_ElasticShortening.TemporaryStrand_ElasticShorteningLosses();
-   m_dfpES[PERMANENT_STRAND] = m_ElasticShortening.PermanentStrand_ElasticShorteningLosses();
 }
 
 Float64 RefinedLossesTxDOT2013::GetKL() const
 {
-    if ( m_IsDirty )
+    if ( IsDirty() )
     {
         UpdateLosses();
     }
@@ -321,7 +316,7 @@ Float64 RefinedLossesTxDOT2013::GetKL() const
 
 Float64 RefinedLossesTxDOT2013::Getfpt() const
 {
-    if ( m_IsDirty )
+    if ( IsDirty() )
     {
         UpdateLosses();
     }
@@ -331,7 +326,7 @@ Float64 RefinedLossesTxDOT2013::Getfpt() const
 
 Float64 RefinedLossesTxDOT2013::GetSdMoment() const
 {
-    if ( m_IsDirty )
+    if ( IsDirty() )
     {
         UpdateLosses();
     }
@@ -281,21 +281,7 @@ std::unique_ptr<ConcreteBaseCreepDetails> ACI209Concrete::GetCreepCoefficientDet
    Float64 correction_factor = 1.0;
 
    // Load Age Factor (2.5.1)
-   Float64 LA = 1.0;
-   if (m_CuringType == CuringType::Moist)
-   {
-      if ( 7 < age_at_loading )
-      {
-         LA = 1.25*pow(age_at_loading,-0.118);
-      }
-   }
-   else
-   {
-      if ( 3 < age_at_loading )
-      {
-         LA = 1.13*pow(age_at_loading,-0.094);
-      }
-   }
+   Float64 LA = GetLoadingAgeFactor(age_at_loading);
    correction_factor *= LA;
 
    // Relative humidity (2.5.4)
@@ -316,6 +302,67 @@ std::unique_ptr<ConcreteBaseCreepDetails> ACI209Concrete::GetCreepCoefficientDet
    return pDetails;
 }
 
+std::vector<Float64> ACI209Concrete::GetFreeShrinkageStrains(const std::vector<Float64>& vTime) const
+{
+   ValidateCorrectionFactors();
+
+   // parameters that do not depend on time
+   Float64 f = (m_CuringType == CuringType::Moist ? 35 : 55); // Eqn 2-1, 2-9, 2-10
+   Float64 correction_factor = Max(m_CP*m_RHS*m_VSS,0.2); // 2.5.3, 2.5.4, 2.5.5b, and limits
+   Float64 shrinkage_start = m_CureTime + m_TimeAtCasting;
+
+   IndexType nTimes = vTime.size();
+   std::vector<Float64> vEsh(nTimes,0.0);
+   for (IndexType i = 0; i < nTimes; i++)
+   {
+      Float64 shrinkage_time = vTime[i] - shrinkage_start;
+      if (0 <= shrinkage_time)
+      {
+         Float64 time_factor = shrinkage_time/(f+shrinkage_time);
+         vEsh[i] = time_factor * correction_factor * m_Eshu;
+      }
+   }
+
+   return vEsh;
+}
+
+std::vector<Float64> ACI209Concrete::GetCreepCoefficients(const std::vector<Float64>& vTime,const std::vector<Float64>& vLoadingTime) const
+{
+   ValidateCorrectionFactors();
+
+   IndexType nTimes = vTime.size();
+   IndexType nLoadingTimes = vLoadingTime.size();
+   std::vector<Float64> vCt(nTimes*nLoadingTimes,0.0);
+   for (IndexType j = 0; j < nLoadingTimes; j++)
+   {
+      Float64 age_at_loading = GetAge(vLoadingTime[j]);
+      if (::IsLE(age_at_loading,0.0))
+      {
+         continue; // creep coefficients are zero for this loading
+      }
+
+      // parameters that do not depend on time
+      Float64 correction_factor = GetLoadingAgeFactor(age_at_loading) * m_RHC * m_VSC; // 2.5.1, 2.5.4, 2.5.5b
+
+      Float64* pCt = vCt.data() + j*nTimes;
+      for (IndexType i = 0; i < nTimes; i++)
+      {
+         Float64 age = GetAge(vTime[i]);
+         Float64 maturity = age - age_at_loading;
+         if (::IsLE(age,0.0) || ::IsLE(maturity,0.0))
+         {
+            continue;
+         }
+
+         Float64 tx = pow(maturity,0.6);
+         Float64 time_factor = tx/(10+tx);
+         pCt[i] = time_factor * correction_factor * m_Cu;
+      }
+   }
+
+   return vCt;
+}
+
 std::unique_ptr<ConcreteBase> ACI209Concrete::CreateClone() const
 {
    return std::make_unique<ACI209Concrete>(*this);
@@ -500,6 +547,27 @@ Float64 ACI209Concrete::GetFr(Float64 t) const
    return fr;
 }
 
+Float64 ACI209Concrete::GetLoadingAgeFactor(Float64 age_at_loading) const
+{
+   // Load Age Factor (2.5.1)
+   Float64 LA = 1.0;
+   if (m_CuringType == CuringType::Moist)
+   {
+      if ( 7 < age_at_loading )
+      {
+         LA = 1.25*pow(age_at_loading,-0.118);
+      }
+   }
+   else
+   {
+      if ( 3 < age_at_loading )
+      {
+         LA = 1.13*pow(age_at_loading,-0.094);
+      }
+   }
+   return LA;
+}
+
 // Could be using WBFL::LRFD::ConcreteUtil::ModE, except that creates a circular
 // dependency between WBFLMaterial and WBFLLrfd. Neither will link
 // without the other first being linked.
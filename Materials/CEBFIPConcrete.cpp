@@ -349,6 +349,70 @@ std::unique_ptr<ConcreteBaseCreepDetails> CEBFIPConcrete::GetCreepCoefficientDet
    return pDetails;
 }
 
+std::vector<Float64> CEBFIPConcrete::GetFreeShrinkageStrains(const std::vector<Float64>& vTime) const
+{
+   // parameters that do not depend on time
+   Float64 ecso = GetNotionalShrinkageCoefficient(); // CEB-FIP Eqn. 2.1-75
+   Float64 h = GetH();
+   h = WBFL::Units::ConvertFromSysUnits(h,WBFL::Units::Measure::Millimeter); // need h in millimeter
+   Float64 ho = 100; // 100 millimeter
+   Float64 hs = 350*pow(h/ho,2);
+   Float64 shrinkage_start = m_CureTime + m_TimeAtCasting;
+
+   IndexType nTimes = vTime.size();
+   std::vector<Float64> vEsh(nTimes,0.0);
+   for (IndexType i = 0; i < nTimes; i++)
+   {
+      Float64 shrinkage_time = vTime[i] - shrinkage_start;
+      if (0 <= shrinkage_time)
+      {
+         Float64 betaS = sqrt( shrinkage_time/(hs + shrinkage_time) ); // CEB-FIP Eqn. 2.1-79
+         vEsh[i] = ecso * betaS;
+      }
+   }
+
+   return vEsh;
+}
+
+std::vector<Float64> CEBFIPConcrete::GetCreepCoefficients(const std::vector<Float64>& vTime,const std::vector<Float64>& vLoadingTime) const
+{
+   // parameters that do not depend on time
+   Float64 phiRH = GetPhiRH();
+   Float64 beta_fcm = GetBetaFcm();
+   Float64 beta_H = GetBetaH();
+
+   IndexType nTimes = vTime.size();
+   IndexType nLoadingTimes = vLoadingTime.size();
+   std::vector<Float64> vCt(nTimes*nLoadingTimes,0.0);
+   for (IndexType j = 0; j < nLoadingTimes; j++)
+   {
+      Float64 age_at_loading = GetAge(vLoadingTime[j]);
+      if (::IsLE(age_at_loading,0.0))
+      {
+         continue; // creep coefficients are zero for this loading
+      }
+
+      Float64 beta_to = 1/(0.1 + pow(age_at_loading,0.2)); // CEB-FIP Eqn. 2.1-68
+      Float64 co = phiRH * beta_fcm * beta_to; // CEB-FIP Eqn. 2.1-65
+
+      Float64* pCt = vCt.data() + j*nTimes;
+      for (IndexType i = 0; i < nTimes; i++)
+      {
+         Float64 age = GetAge(vTime[i]);
+         Float64 maturity = age - age_at_loading;
+         if (::IsLE(age,0.0) || ::IsLE(maturity,0.0))
+         {
+            continue;
+         }
+
+         Float64 beta_c = pow(maturity/(beta_H + maturity),0.3); // CEB-FIP Eqn. 2.1-70
+         pCt[i] = co * beta_c; // CEB-FIP Eqn. 2.1-64
+      }
+   }
+
+   return vCt;
+}
+
 Float64 CEBFIPConcrete::GetH() const
 {
    Float64 h = 2*m_VS; // Eqn 2.1-69. Note that V/S ratio = Area/Perimeter
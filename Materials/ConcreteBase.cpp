@@ -308,6 +308,31 @@ CuringType ConcreteBase::GetCuringType() const
    return m_CuringType;
 }
 
+std::vector<Float64> ConcreteBase::GetFreeShrinkageStrains(const std::vector<Float64>& vTime) const
+{
+   std::vector<Float64> vEsh;
+   vEsh.reserve(vTime.size());
+   for (auto t : vTime)
+   {
+      vEsh.push_back(GetFreeShrinkageStrain(t));
+   }
+   return vEsh;
+}
+
+std::vector<Float64> ConcreteBase::GetCreepCoefficients(const std::vector<Float64>& vTime,const std::vector<Float64>& vLoadingTime) const
+{
+   std::vector<Float64> vCt;
+   vCt.reserve(vTime.size()*vLoadingTime.size());
+   for (auto tla : vLoadingTime)
+   {
+      for (auto t : vTime)
+      {
+         vCt.push_back(GetCreepCoefficient(t,tla));
+      }
+   }
+   return vCt;
+}
+
 void ConcreteBase::OnChanged()
 {
    // by default, do nothing
@@ -0,0 +1,405 @@
+///////////////////////////////////////////////////////////////////////
+// Materials - Analytical and Product modeling of civil engineering materials
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#include <Materials/MatLib.h>
+#include <Materials/DirichletSeriesCreep.h>
+
+#include <MathEx.h>
+#include <algorithm>
+
+using namespace WBFL::Materials;
+
+namespace
+{
+   // Solves the n x n system of equations A x = b by Gaussian elimination with partial pivoting. A and b are destroyed.
+   // A is stored by rows.
+   std::vector<Float64> Solve(std::vector<Float64>& A, std::vector<Float64>& b, IndexType n)
+   {
+      for (IndexType k = 0; k < n; k++)
+      {
+         IndexType p = k;
+         for (IndexType i = k + 1; i < n; i++)
+         {
+            if (fabs(A[p*n + k]) < fabs(A[i*n + k])) p = i;
+         }
+
+         if (p != k)
+         {
+            for (IndexType j = 0; j < n; j++) std::swap(A[k*n + j], A[p*n + j]);
+            std::swap(b[k], b[p]);
+         }
+
+         Float64 pivot = A[k*n + k];
+         if (IsZero(pivot, 1.0e-300))
+         {
+            continue; // singular, the unknown stays zero
+         }
+
+         for (IndexType i = k + 1; i < n; i++)
+         {
+            Float64 f = A[i*n + k] / pivot;
+            for (IndexType j = k; j < n; j++) A[i*n + j] -= f*A[k*n + j];
+            b[i] -= f*b[k];
+         }
+      }
+
+      std::vector<Float64> x(n, 0.0);
+      for (IndexType k = n; 0 < k--; )
+      {
+         Float64 pivot = A[k*n + k];
+         if (IsZero(pivot, 1.0e-300)) continue;
+
+         Float64 s = b[k];
+         for (IndexType j = k + 1; j < n; j++) s -= A[k*n + j] * x[j];
+         x[k] = s / pivot;
+      }
+      return x;
+   }
+
+   // Solves the non-negative least squares problem min |Bx - c| subject to x >= 0 by the active set method of Lawson and Hanson.
+   // The problem is given by its normal equations G = B'B (n x n, stored by rows) and h = B'c.
+   std::vector<Float64> SolveNonNegativeLeastSquares(const std::vector<Float64>& G, const std::vector<Float64>& h, IndexType n)
+   {
+      Float64 hMax = 0;
+      for (auto v : h) hMax = Max(hMax, fabs(v));
+      Float64 tolerance = 1.0e-12*Max(hMax, 1.0);
+
+      std::vector<Float64> x(n, 0.0);
+      std::vector<bool> vbPassive(n, false);
+
+      // solves the least squares problem for the passive variables, with the active variables held at zero
+      auto solve_passive = [&]()
+      {
+         std::vector<IndexType> vIdx;
+         for (IndexType i = 0; i < n; i++)
+         {
+            if (vbPassive[i]) vIdx.push_back(i);
+         }
+
+         IndexType m = vIdx.size();
+         std::vector<Float64> A(m*m), b(m);
+         for (IndexType i = 0; i < m; i++)
+         {
+            b[i] = h[vIdx[i]];
+            for (IndexType j = 0; j < m; j++) A[i*m + j] = G[vIdx[i]*n + vIdx[j]];
+         }
+         std::vector<Float64> zp = Solve(A, b, m);
+
+         std::vector<Float64> z(n, 0.0);
+         for (IndexType i = 0; i < m; i++) z[vIdx[i]] = zp[i];
+         return z;
+      };
+
+      for (IndexType iter = 0; iter < 3*n; iter++)
+      {
+         // gradient of the objective function
+         IndexType jMax = INVALID_INDEX;
+         Float64 wMax = tolerance;
+         for (IndexType j = 0; j < n; j++)
+         {
+            if (vbPassive[j]) continue;
+
+            Float64 w = h[j];
+            for (IndexType k = 0; k < n; k++) w -= G[j*n + k] * x[k];
+            if (wMax < w)
+            {
+               wMax = w;
+               jMax = j;
+            }
+         }
+
+         if (jMax == INVALID_INDEX)
+         {
+            break; // the solution is optimal
+         }
+
+         vbPassive[jMax] = true;
+
+         while (true)
+         {
+            std::vector<Float64> z = solve_passive();
+
+            Float64 alpha = 1.0;
+            bool bFeasible = true;
+            for (IndexType j = 0; j < n; j++)
+            {
+               if (vbPassive[j] && z[j] <= 0)
+               {
+                  bFeasible = false;
+                  alpha = Min(alpha, x[j] / (x[j] - z[j]));
+               }
+            }
+
+            if (bFeasible)
+            {
+               x = z;
+               break;
+            }
+
+            // move toward z as far as possible while staying feasible then drop variables that reach zero
+            for (IndexType j = 0; j < n; j++)
+            {
+               if (!vbPassive[j]) continue;
+
+               x[j] += alpha*(z[j] - x[j]);
+               if (x[j] <= tolerance)
+               {
+                  x[j] = 0;
+                  vbPassive[j] = false;
+               }
+            }
+         }
+      }
+
+      return x;
+   }
+}
+
+DirichletSeriesCreepFunction::DirichletSeriesCreepFunction(const ConcreteBase& concrete, const std::vector<Float64>& vLoadingTimes, const std::vector<Float64>& vRetardationTimes, Float64 maxDuration, IndexType nSamples) :
+   m_vRetardationTimes(vRetardationTimes.empty() ? GetDefaultRetardationTimes() : vRetardationTimes),
+   m_vLoadingTimes(vLoadingTimes)
+{
+   PRECONDITION(!vLoadingTimes.empty());
+   PRECONDITION(0 < maxDuration);
+   PRECONDITION(2 <= nSamples);
+
+   std::sort(m_vLoadingTimes.begin(), m_vLoadingTimes.end());
+   m_vLoadingTimes.erase(std::unique(m_vLoadingTimes.begin(), m_vLoadingTimes.end()), m_vLoadingTimes.end());
+
+   IndexType nUnits = m_vRetardationTimes.size();
+   IndexType nLoadingTimes = m_vLoadingTimes.size();
+   m_vCoefficients.resize(nLoadingTimes*nUnits, 0.0);
+
+   // durations of loading are logarithmically spaced so the short term and long term behavior are equally represented
+   const Float64 minDuration = Min(0.1, maxDuration);
+   std::vector<Float64> vDuration(nSamples);
+   for (IndexType i = 0; i < nSamples; i++)
+   {
+      vDuration[i] = minDuration*pow(maxDuration/minDuration, (Float64)i/(Float64)(nSamples - 1));
+   }
+
+   // value of each Kelvin unit at each duration for a unit coefficient
+   std::vector<Float64> B(nSamples*nUnits);
+   for (IndexType i = 0; i < nSamples; i++)
+   {
+      for (IndexType k = 0; k < nUnits; k++)
+      {
+         B[i*nUnits + k] = 1 - exp(-vDuration[i]/m_vRetardationTimes[k]);
+      }
+   }
+
+   // normal equations are the same for all loading times
+   std::vector<Float64> G(nUnits*nUnits, 0.0);
+   for (IndexType j = 0; j < nUnits; j++)
+   {
+      for (IndexType k = 0; k < nUnits; k++)
+      {
+         for (IndexType i = 0; i < nSamples; i++)
+         {
+            G[j*nUnits + k] += B[i*nUnits + j] * B[i*nUnits + k];
+         }
+      }
+   }
+
+   Float64 sumSquareError = 0;
+   m_FitQuality.nSamples = nSamples*nLoadingTimes;
+   for (IndexType l = 0; l < nLoadingTimes; l++)
+   {
+      Float64 tla = m_vLoadingTimes[l];
+      std::vector<Float64> vTime(nSamples);
+      std::transform(vDuration.begin(), vDuration.end(), vTime.begin(), [tla](auto d) {return tla + d;});
+      std::vector<Float64> vCt = concrete.GetCreepCoefficients(vTime, std::vector<Float64>{tla});
+
+      std::vector<Float64> h(nUnits, 0.0);
+      for (IndexType k = 0; k < nUnits; k++)
+      {
+         for (IndexType i = 0; i < nSamples; i++)
+         {
+            h[k] += B[i*nUnits + k] * vCt[i];
+         }
+      }
+
+      std::vector<Float64> a = SolveNonNegativeLeastSquares(G, h, nUnits);
+      std::copy(a.begin(), a.end(), m_vCoefficients.begin() + l*nUnits);
+
+      for (IndexType i = 0; i < nSamples; i++)
+      {
+         Float64 Ct = 0;
+         for (IndexType k = 0; k < nUnits; k++)
+         {
+            Ct += a[k] * B[i*nUnits + k];
+         }
+
+         Float64 error = fabs(Ct - vCt[i]);
+         sumSquareError += error*error;
+         if (m_FitQuality.MaxError < error)
+         {
+            m_FitQuality.MaxError = error;
+            m_FitQuality.MaxErrorTime = vTime[i];
+            m_FitQuality.MaxErrorLoadingTime = tla;
+         }
+         m_FitQuality.MaxCreepCoefficient = Max(m_FitQuality.MaxCreepCoefficient, vCt[i]);
+      }
+   }
+
+   m_FitQuality.RMSError = sqrt(sumSquareError/m_FitQuality.nSamples);
+}
+
+std::vector<Float64> DirichletSeriesCreepFunction::GetDefaultRetardationTimes()
+{
+   return std::vector<Float64>{0.1, 1.0, 10.0, 100.0, 1000.0, 10000.0};
+}
+
+IndexType DirichletSeriesCreepFunction::GetUnitCount() const
+{
+   return m_vRetardationTimes.size();
+}
+
+const std::vector<Float64>& DirichletSeriesCreepFunction::GetRetardationTimes() const
+{
+   return m_vRetardationTimes;
+}
+
+const std::vector<Float64>& DirichletSeriesCreepFunction::GetLoadingTimes() const
+{
+   return m_vLoadingTimes;
+}
+
+void DirichletSeriesCreepFunction::GetCoefficients(Float64 tla, std::vector<Float64>& vCoefficients) const
+{
+   IndexType nUnits = m_vRetardationTimes.size();
+   vCoefficients.resize(nUnits);
+
+   // coefficients are constant beyond the range of loading times
+   auto begin = m_vCoefficients.begin();
+   if (tla <= m_vLoadingTimes.front())
+   {
+      std::copy(begin, begin + nUnits, vCoefficients.begin());
+      return;
+   }
+
+   if (m_vLoadingTimes.back() <= tla)
+   {
+      std::copy(m_vCoefficients.end() - nUnits, m_vCoefficients.end(), vCoefficients.begin());
+      return;
+   }
+
+   IndexType l = std::distance(m_vLoadingTimes.begin(), std::upper_bound(m_vLoadingTimes.begin(), m_vLoadingTimes.end(), tla)) - 1;
+   Float64 t1 = m_vLoadingTimes[l];
+   Float64 t2 = m_vLoadingTimes[l + 1];
+   for (IndexType k = 0; k < nUnits; k++)
+   {
+      vCoefficients[k] = ::LinInterp(tla - t1, m_vCoefficients[l*nUnits + k], m_vCoefficients[(l + 1)*nUnits + k], t2 - t1);
+   }
+}
+
+Float64 DirichletSeriesCreepFunction::GetCreepCoefficient(Float64 t, Float64 tla) const
+{
+   if (t <= tla)
+   {
+      return 0.0;
+   }
+
+   std::vector<Float64> vCoefficients;
+   GetCoefficients(tla, vCoefficients);
+
+   Float64 Ct = 0;
+   IndexType nUnits = m_vRetardationTimes.size();
+   for (IndexType k = 0; k < nUnits; k++)
+   {
+      Ct += vCoefficients[k] * (1 - exp(-(t - tla)/m_vRetardationTimes[k]));
+   }
+   return Ct;
+}
+
+const DirichletSeriesCreepFitQuality& DirichletSeriesCreepFunction::GetFitQuality() const
+{
+   return m_FitQuality;
+}
+
+//////////////////////////////////////////////////////////////////////////
+DirichletSeriesCreepIntegrator::DirichletSeriesCreepIntegrator(std::shared_ptr<const DirichletSeriesCreepFunction> creepFunction, Float64 t) :
+   m_CreepFunction(creepFunction)
+{
+   PRECONDITION(m_CreepFunction != nullptr);
+   Reset(t);
+}
+
+void DirichletSeriesCreepIntegrator::Reset(Float64 t)
+{
+   m_Time = t;
+   m_vUltimate.assign(m_CreepFunction->GetUnitCount(), 0.0);
+   m_vRemaining.assign(m_CreepFunction->GetUnitCount(), 0.0);
+}
+
+Float64 DirichletSeriesCreepIntegrator::GetTime() const
+{
+   return m_Time;
+}
+
+Float64 DirichletSeriesCreepIntegrator::GetCreepStrainIncrement(Float64 t) const
+{
+   PRECONDITION(m_Time <= t);
+   const auto& vRetardationTimes = m_CreepFunction->GetRetardationTimes();
+   Float64 de = 0;
+   IndexType nUnits = vRetardationTimes.size();
+   for (IndexType k = 0; k < nUnits; k++)
+   {
+      de += m_vRemaining[k] * (1 - exp(-(t - m_Time)/vRetardationTimes[k]));
+   }
+   return de;
+}
+
+void DirichletSeriesCreepIntegrator::Advance(Float64 t)
+{
+   PRECONDITION(m_Time <= t);
+   const auto& vRetardationTimes = m_CreepFunction->GetRetardationTimes();
+   IndexType nUnits = vRetardationTimes.size();
+   for (IndexType k = 0; k < nUnits; k++)
+   {
+      m_vRemaining[k] *= exp(-(t - m_Time)/vRetardationTimes[k]);
+   }
+   m_Time = t;
+}
+
+void DirichletSeriesCreepIntegrator::AddStrainIncrement(Float64 de)
+{
+   m_CreepFunction->GetCoefficients(m_Time, m_vCoefficients);
+   IndexType nUnits = m_vCoefficients.size();
+   for (IndexType k = 0; k < nUnits; k++)
+   {
+      m_vUltimate[k] += de*m_vCoefficients[k];
+      m_vRemaining[k] += de*m_vCoefficients[k];
+   }
+}
+
+Float64 DirichletSeriesCreepIntegrator::GetCreepStrain() const
+{
+   Float64 e = 0;
+   IndexType nUnits = m_vUltimate.size();
+   for (IndexType k = 0; k < nUnits; k++)
+   {
+      e += m_vUltimate[k] - m_vRemaining[k];
+   }
+   return e;
+}
@@ -197,5 +197,50 @@ namespace MaterialsUnitTest
 			Assert::AreEqual(1.1496757127213619, concrete.GetCreepCoefficient(56, 1));
 			Assert::AreEqual(1.4146989580422951, concrete.GetCreepCoefficient(128, 1));
 		}
+
+		TEST_METHOD(TimeGrid)
+		{
+			ACI209Concrete concrete;
+			concrete.SetA(4.0);
+			concrete.SetBeta(0.85);
+			concrete.SetCuringType(CuringType::Moist);
+			concrete.SetCureTime(3);
+			concrete.SetAgeAtInitialLoading(1.0);
+			concrete.SetTimeAtCasting(0.0);
+			concrete.SetFc28(WBFL::Units::ConvertToSysUnits(5.0, WBFL::Units::Measure::KSI));
+			concrete.SetEc28(WBFL::Units::ConvertToSysUnits(4000, WBFL::Units::Measure::KSI));
+			concrete.SetStrengthDensity(WBFL::Units::ConvertToSysUnits(0.150, WBFL::Units::Measure::KipPerFeet3));
+			concrete.SetWeightDensity(WBFL::Units::ConvertToSysUnits(0.155, WBFL::Units::Measure::KipPerFeet3));
+			concrete.SetRelativeHumidity(70);
+			concrete.SetUltimateCreepCoefficient(3.5);
+			concrete.SetUltimateShrinkageStrain(480e-03);
+			concrete.SetVSRatio(WBFL::Units::ConvertToSysUnits(3.5, WBFL::Units::Measure::Inch));
+
+			std::vector<Float64> vTime{ 0, 1, 3, 5, 10, 28, 56, 90, 128, 1000, 10000 };
+			std::vector<Float64> vLoadingTime{ 0, 1, 3, 10, 90 };
+
+			// batch evaluation must match the scalar evaluation for both curing types
+			for (auto curingType : { CuringType::Moist, CuringType::Steam })
+			{
+				concrete.SetCuringType(curingType);
+
+				auto vEsh = concrete.GetFreeShrinkageStrains(vTime);
+				Assert::AreEqual(vTime.size(), vEsh.size());
+				for (IndexType i = 0; i < vTime.size(); i++)
+				{
+					Assert::AreEqual(concrete.GetFreeShrinkageStrain(vTime[i]), vEsh[i]);
+				}
+
+				auto vCt = concrete.GetCreepCoefficients(vTime, vLoadingTime);
+				Assert::AreEqual(vTime.size() * vLoadingTime.size(), vCt.size());
+				for (IndexType j = 0; j < vLoadingTime.size(); j++)
+				{
+					for (IndexType i = 0; i < vTime.size(); i++)
+					{
+						Assert::AreEqual(concrete.GetCreepCoefficient(vTime[i], vLoadingTime[j]), vCt[j * vTime.size() + i]);
+					}
+				}
+			}
+		}
 	};
 }
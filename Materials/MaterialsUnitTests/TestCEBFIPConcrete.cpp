@@ -399,5 +399,41 @@ namespace MaterialsUnitTest
 			Assert::AreEqual(1.9657998114343658, concrete.GetCreepCoefficient(56, 1));
 			Assert::AreEqual(2.4400921043933184, concrete.GetCreepCoefficient(128, 1));
 		}
+
+		TEST_METHOD(TimeGrid)
+		{
+			CEBFIPConcrete concrete;
+			Float64 S, BetaSC;
+			CEBFIPConcrete::GetModelParameters(CEBFIPConcrete::CementType::N, &S, &BetaSC);
+			concrete.SetCureTime(3.0);
+			concrete.SetS(S);
+			concrete.SetBetaSc(BetaSC);
+			concrete.SetFc28(WBFL::Units::ConvertToSysUnits(5.0, WBFL::Units::Measure::KSI));
+			concrete.SetStrengthDensity(WBFL::Units::ConvertToSysUnits(0.150, WBFL::Units::Measure::KipPerFeet3));
+			concrete.SetWeightDensity(WBFL::Units::ConvertToSysUnits(0.155, WBFL::Units::Measure::KipPerFeet3));
+			concrete.SetRelativeHumidity(70);
+			concrete.SetVSRatio(WBFL::Units::ConvertToSysUnits(3.5, WBFL::Units::Measure::Inch));
+
+			// batch evaluation must match the scalar evaluation
+			std::vector<Float64> vTime{ 0, 1, 3, 5, 10, 28, 56, 90, 128, 1000, 10000 };
+			std::vector<Float64> vLoadingTime{ 0, 1, 3, 10, 90 };
+
+			auto vEsh = concrete.GetFreeShrinkageStrains(vTime);
+			Assert::AreEqual(vTime.size(), vEsh.size());
+			for (IndexType i = 0; i < vTime.size(); i++)
+			{
+				Assert::AreEqual(concrete.GetFreeShrinkageStrain(vTime[i]), vEsh[i]);
+			}
+
+			auto vCt = concrete.GetCreepCoefficients(vTime, vLoadingTime);
+			Assert::AreEqual(vTime.size() * vLoadingTime.size(), vCt.size());
+			for (IndexType j = 0; j < vLoadingTime.size(); j++)
+			{
+				for (IndexType i = 0; i < vTime.size(); i++)
+				{
+					Assert::AreEqual(concrete.GetCreepCoefficient(vTime[i], vLoadingTime[j]), vCt[j * vTime.size() + i]);
+				}
+			}
+		}
 	};
 }
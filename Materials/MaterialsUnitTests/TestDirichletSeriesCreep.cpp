@@ -0,0 +1,108 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace WBFL::Materials;
+
+namespace MaterialsUnitTest
+{
+	TEST_CLASS(TestDirichletSeriesCreep)
+	{
+	public:
+		
+		TEST_METHOD(FitQuality)
+		{
+			ACI209Concrete concrete;
+			concrete.SetCuringType(CuringType::Moist);
+			concrete.SetCureTime(3);
+			concrete.SetTimeAtCasting(0.0);
+			concrete.SetFc28(WBFL::Units::ConvertToSysUnits(5.0, WBFL::Units::Measure::KSI));
+			concrete.SetStrengthDensity(WBFL::Units::ConvertToSysUnits(0.150, WBFL::Units::Measure::KipPerFeet3));
+			concrete.SetWeightDensity(WBFL::Units::ConvertToSysUnits(0.155, WBFL::Units::Measure::KipPerFeet3));
+			concrete.SetRelativeHumidity(70);
+			concrete.SetVSRatio(WBFL::Units::ConvertToSysUnits(3.5, WBFL::Units::Measure::Inch));
+
+			std::vector<Float64> vLoadingTimes{ 90, 1, 7, 28, 3, 365 }; // unsorted on purpose
+			DirichletSeriesCreepFunction creep(concrete, vLoadingTimes);
+
+			Assert::AreEqual((IndexType)6, creep.GetUnitCount());
+			Assert::IsTrue(std::is_sorted(creep.GetLoadingTimes().begin(), creep.GetLoadingTimes().end()));
+
+			const auto& fit = creep.GetFitQuality();
+			Assert::AreEqual((IndexType)(50 * vLoadingTimes.size()), fit.nSamples);
+			Assert::IsTrue(0 < fit.MaxCreepCoefficient);
+			Assert::IsTrue(fit.MaxError < 0.02 * fit.MaxCreepCoefficient);
+			Assert::IsTrue(fit.RMSError <= fit.MaxError);
+
+			// the fitted function approximates the creep coefficient of the concrete
+			for (auto tla : { 1.0, 7.0, 28.0, 90.0 })
+			{
+				Assert::AreEqual(0.0, creep.GetCreepCoefficient(tla, tla));
+				for (auto duration : { 1.0, 10.0, 100.0, 1000.0 })
+				{
+					Assert::AreEqual(concrete.GetCreepCoefficient(tla + duration, tla), creep.GetCreepCoefficient(tla + duration, tla), 0.02 * fit.MaxCreepCoefficient);
+				}
+			}
+
+			// Kelvin unit coefficients are non-negative
+			std::vector<Float64> vCoefficients;
+			creep.GetCoefficients(28, vCoefficients);
+			Assert::AreEqual(creep.GetUnitCount(), vCoefficients.size());
+			for (auto a : vCoefficients)
+			{
+				Assert::IsTrue(0 <= a);
+			}
+		}
+
+		TEST_METHOD(Integrator)
+		{
+			CEBFIPConcrete concrete;
+			Float64 S, BetaSC;
+			CEBFIPConcrete::GetModelParameters(CEBFIPConcrete::CementType::N, &S, &BetaSC);
+			concrete.SetCureTime(3.0);
+			concrete.SetS(S);
+			concrete.SetBetaSc(BetaSC);
+			concrete.SetFc28(WBFL::Units::ConvertToSysUnits(5.0, WBFL::Units::Measure::KSI));
+			concrete.SetStrengthDensity(WBFL::Units::ConvertToSysUnits(0.150, WBFL::Units::Measure::KipPerFeet3));
+			concrete.SetWeightDensity(WBFL::Units::ConvertToSysUnits(0.155, WBFL::Units::Measure::KipPerFeet3));
+			concrete.SetRelativeHumidity(70);
+			concrete.SetVSRatio(WBFL::Units::ConvertToSysUnits(3.5, WBFL::Units::Measure::Inch));
+
+			auto creep = std::make_shared<DirichletSeriesCreepFunction>(concrete, std::vector<Float64>{ 1, 3, 7, 14, 28, 56, 90, 180, 365, 1000 });
+
+			// the creep strain from the integrator must match the superposition of the fitted creep function
+			// over the entire strain history
+			DirichletSeriesCreepIntegrator integrator(creep, 1.0);
+			std::vector<Float64> vTime, vStrain;
+			Float64 t = 1.0;
+			for (IndexType i = 0; i < 200; i++)
+			{
+				Float64 de = (i % 10 == 0 ? 1.0e-4 : -2.0e-6);
+
+				Float64 increment = integrator.GetCreepStrainIncrement(t);
+				Float64 e = integrator.GetCreepStrain();
+				integrator.Advance(t);
+				Assert::AreEqual(t, integrator.GetTime());
+				Assert::AreEqual(integrator.GetCreepStrain() - e, increment, 1.0e-15);
+
+				integrator.AddStrainIncrement(de);
+				vTime.push_back(t);
+				vStrain.push_back(de);
+
+				Float64 ecr = 0;
+				for (IndexType j = 0; j < vTime.size(); j++)
+				{
+					ecr += vStrain[j] * creep->GetCreepCoefficient(t, vTime[j]);
+				}
+				Assert::AreEqual(ecr, integrator.GetCreepStrain(), 1.0e-12);
+
+				t *= 1.05;
+			}
+
+			integrator.Reset(10.0);
+			Assert::AreEqual(10.0, integrator.GetTime());
+			Assert::AreEqual(0.0, integrator.GetCreepStrain());
+		}
+	};
+}
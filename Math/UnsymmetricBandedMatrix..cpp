@@ -22,9 +22,8 @@
 
 #include <Math\MathLib.h>
 #include <Math/UnsymmetricBandedMatrix.h>
-#include <System\Threads.h>
+#include <System\TaskPool.h>
 #include <vector>
-#include <future>
 
 using namespace WBFL::Math;
 
@@ -115,23 +114,7 @@ std::vector<Float64> UnsymmetricBandedMatrix::Solve()
          IndexType kmin = max(j, j < half_band_width ? 0 : j - half_band_width);
          IndexType kmax = min(j + half_band_width, N - 1);
 
-         IndexType nWorkerThreads, nElementsPerThread;
-         WBFL::System::Threads::GetThreadParameters(kmax - kmin + 1, nWorkerThreads, nElementsPerThread);
-         std::vector<std::future<void>> vFutures;
-         IndexType kStart = kmin;
-         for (IndexType t = 0; t < nWorkerThreads; t++)
-         {
-            IndexType kEnd = kStart + nElementsPerThread - 1;
-            vFutures.emplace_back(std::async([this, c, i, j, kStart, kEnd] {ReduceRow(c, i, j, kStart, kEnd);}));
-            kStart = kEnd + 1;
-         }
-
-         ReduceRow(c, i, j, kStart, kmax);
-
-         for (auto& f : vFutures)
-         {
-            f.get();
-         }
+         WBFL::System::TaskPool::ParallelFor(kmin, kmax + 1, [this, c, i, j](IndexType kStart, IndexType kEnd) {ReduceRow(c, i, j, kStart, kEnd - 1); });
          b[i] -= c*b[j];
       }
    }
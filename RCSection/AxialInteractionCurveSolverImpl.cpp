@@ -24,6 +24,7 @@
 #include <RCSection/RCSectionLib.h>
 #include "AxialInteractionCurveSolverImpl.h"
 #include <RCSection/XRCSection.h>
+#include <System/Trace.h>
 
 #define MAX_FAIL 4
 
@@ -91,6 +92,7 @@ const CapacityLimit& AxialInteractionCurveSolverImpl::GetTensionLimit() const
 
 std::unique_ptr<InteractionCurveSolution> AxialInteractionCurveSolverImpl::Solve(Float64 na, IndexType nFzSteps) const
 {
+   WBFL_TRACE_FUNCTION();
    auto solution(std::make_unique<InteractionCurveSolution>());
 
    const auto& tension_capacity_limit = GetTensionLimit();
@@ -24,6 +24,7 @@
 #include <RCSection/RCSectionLib.h>
 #include "CrackedSectionSolverImpl.h"
 #include <RCSection/XRCSection.h>
+#include <System/Trace.h>
 
 #if defined _DEBUG_LOGGING
 #include <sstream>
@@ -95,6 +96,7 @@ IndexType CrackedSectionSolverImpl::GetMaxIterations() const
 
 std::unique_ptr<CrackedSectionSolution> CrackedSectionSolverImpl::Solve(Float64 naAngle) const
 {
+   WBFL_TRACE_FUNCTION();
    m_Angle = naAngle;
    DecomposeSection();
 
@@ -24,6 +24,7 @@
 #include <RCSection/RCSectionLib.h>
 #include "MomentCapacitySolverImpl.h"
 #include <RCSection/XRCSection.h>
+#include <System/Trace.h>
 #include <GeomModel/GeomOp2d.h>
 
 using namespace WBFL::RCSection;
@@ -81,6 +82,7 @@ IndexType MomentCapacitySolverImpl::GetMaxIterations() const
 
 std::unique_ptr<MomentCapacitySolution> MomentCapacitySolverImpl::Solve(Float64 Fz, Float64 angle, Float64 k_or_ec, Float64 strainLocation, MomentCapacitySolver::SolutionMethod solutionMethod) const
 {
+   WBFL_TRACE_FUNCTION();
    // initialize some parameters using during the solution
    m_bAnalysisPointUpdated = false;
 
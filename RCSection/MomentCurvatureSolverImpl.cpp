@@ -24,6 +24,7 @@
 #include <RCSection/RCSectionLib.h>
 #include "MomentCurvatureSolverImpl.h"
 #include <RCSection/XRCSection.h>
+#include <System/Trace.h>
 
 #define MAX_FAIL 4
 
@@ -91,6 +92,7 @@ Float64 MomentCurvatureSolverImpl::GetInitialCurvatureStep() const
 
 std::unique_ptr<MomentCurvatureSolution> MomentCurvatureSolverImpl::Solve(Float64 Fz, Float64 angle) const
 {
+   WBFL_TRACE_FUNCTION();
    auto solution(std::make_unique<MomentCurvatureSolution>());
 
    Uint32 nFail = 0;
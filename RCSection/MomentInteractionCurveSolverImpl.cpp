@@ -24,6 +24,7 @@
 #include <RCSection/RCSectionLib.h>
 #include "MomentInteractionCurveSolverImpl.h"
 #include <RCSection/XRCSection.h>
+#include <System/Trace.h>
 
 #define MAX_FAIL 4
 
@@ -91,6 +92,7 @@ const CapacityLimit& MomentInteractionCurveSolverImpl::GetTensionLimit() const
 
 std::unique_ptr<InteractionCurveSolution> MomentInteractionCurveSolverImpl::Solve(Float64 Fz, Float64 startNA, Float64 endNA, IndexType nSteps) const
 {
+   WBFL_TRACE_FUNCTION();
    auto solution(std::make_unique<InteractionCurveSolution>());
 
    const auto& tension_capacity_limit = GetTensionLimit();
@@ -27,6 +27,7 @@
 #include <ReportManager\ReportSpecificationBuilder.h>
 #include <ReportManager\TimeChapterBuilder.h>
 #include <Reporter\Reporter.h>
+#include <System\Trace.h>
 
 using namespace WBFL::Reporting;
 
@@ -214,6 +215,7 @@ bool ReportBuilder::NeedsUpdate(const std::shared_ptr<const ReportHint> pHint, c
 
 std::shared_ptr<rptReport> ReportBuilder::CreateReport(const std::shared_ptr<const ReportSpecification> pRptSpec) const
 {
+   WBFL_TRACE_FUNCTION();
    WBFL::System::Time start;
 
    std::shared_ptr<rptReport> pReport( std::make_shared<rptReport>(pRptSpec->GetReportName()) );
@@ -26,6 +26,158 @@
 
 using namespace WBFL::Stability;
 
+namespace
+{
+   // The checks only depend on the analysis results and the criteria. They are implemented here
+   // so they can be evaluated without an artifact (which holds a copy of the results)
+
+#if defined REBAR_FOR_DIRECT_TENSION
+   Float64 GetTensionLimit(const HaulingCriteria& criteria, HaulingSlope slope, const HaulingSectionResult& sectionResult, ImpactDirection impact)
+   {
+      return criteria.TensionStressLimit->GetTensionLimit(slope, sectionResult, impact);
+   }
+#else
+   Float64 GetTensionLimit(const HaulingCriteria& criteria, HaulingSlope slope, const HaulingSectionResult& sectionResult, ImpactDirection impact, WindDirection wind)
+   {
+      return criteria.TensionStressLimit->GetTensionLimit(slope, sectionResult, impact, wind);
+   }
+#endif
+
+   bool CheckCracking(const HaulingResults& results, const HaulingCriteria& criteria, HaulingSlope slope)
+   {
+      return criteria.MinFScr < results.MinFScr[+slope];
+   }
+
+   bool CheckFailure(const HaulingResults& results, const HaulingCriteria& criteria, HaulingSlope slope)
+   {
+      return criteria.MinFSf < results.MinFsFailure[+slope];
+   }
+
+   bool CheckRollover(const HaulingResults& results, const HaulingCriteria& criteria, HaulingSlope slope)
+   {
+      return criteria.MinFSf < results.MinFsRollover[+slope];
+   }
+
+   bool CheckDirectCompression(const HaulingResults& results, const HaulingCriteria& criteria, HaulingSlope slope)
+   {
+      return (::IsLE(criteria.AllowableCompression_GlobalStress, results.MinDirectStress[+slope]) ? true : false);
+   }
+
+   bool CheckDirectTension(const HaulingResults& results, const HaulingCriteria& criteria, HaulingSlope slope)
+   {
+      // since the allowable tension can change based on the amount of reinforcement
+      // in the tension region, we have to check every point for every condition
+      // against its associated allowable
+      for (const auto& sectionResult : results.vSectionResults)
+      {
+         for (IndexType i = 0; i < 3; i++)
+         {
+            ImpactDirection impact = (ImpactDirection)i;
+            for (IndexType c = 0; c < 4; c++)
+            {
+               Corner corner = (Corner)c;
+               Float64 f = sectionResult.fDirect[+slope][+impact][+corner];
+
+#if defined REBAR_FOR_DIRECT_TENSION
+               Float64 fAllow = GetTensionLimit(criteria, slope, sectionResult, impact);
+               if (::IsLE(fAllow, f))
+               {
+                  return false;
+               }
+#else
+               for (IndexType w = 0; w < 2; w++)
+               {
+                  WindDirection wind = (WindDirection)w;
+                  Float64 fAllow = GetTensionLimit(criteria, slope, sectionResult, impact, wind);
+                  if (::IsLE(fAllow, f))
+                  {
+                     return false;
+                  }
+               }
+#endif
+            }
+         }
+      }
+
+      return true;
+   }
+
+   bool CheckCompression(const HaulingResults& results, const HaulingCriteria& criteria, HaulingSlope slope)
+   {
+      return (::IsLE(criteria.AllowableCompression_PeakStress, results.MinStress[+slope]) ? true : false);
+   }
+
+   bool CheckTension(const HaulingResults& results, const HaulingCriteria& criteria, HaulingSlope slope)
+   {
+      // since the allowable tension can change based on the amount of reinforcement
+      // in the tension region, we have to check every point for every condition
+      // against its associated allowable
+      for (const auto& sectionResult : results.vSectionResults)
+      {
+         for (IndexType i = 0; i < 3; i++)
+         {
+            ImpactDirection impact = (ImpactDirection)i;
+            for (IndexType c = 0; c < 4; c++)
+            {
+               Corner corner = (Corner)c;
+#if defined REBAR_FOR_DIRECT_TENSION
+               Float64 fAllow = GetTensionLimit(criteria, slope, sectionResult, impact);
+#endif // REBAR_FOR_DIRECT_TENSION
+               for (IndexType w = 0; w < 2; w++)
+               {
+                  WindDirection wind = (WindDirection)w;
+
+#if !defined REBAR_FOR_DIRECT_TENSION
+                  Float64 fAllow = GetTensionLimit(criteria, slope, sectionResult, impact, wind);
+#endif // REBAR_FOR_DIRECT_TENSION
+
+                  Float64 f = sectionResult.f[+slope][+impact][+wind][+corner];
+                  if (::IsLE(fAllow, f))
+                  {
+                     return false;
+                  }
+               }
+
+            }
+         }
+      }
+
+      return true;
+   }
+
+   bool CheckSlope(const HaulingResults& results, const HaulingCriteria& criteria, HaulingSlope slope)
+   {
+      for (int i = 0; i < 3; i++)
+      {
+         ImpactDirection impact = (ImpactDirection)i;
+         for (int w = 0; w < 2; w++)
+         {
+            WindDirection wind = (WindDirection)w;
+            if (!results.bRotationalStability[+slope][+impact][+wind] || !results.bRolloverStability[+slope][+impact][+wind])
+            {
+               return false;
+            }
+         }
+      }
+      return (CheckCracking(results, criteria, slope) && CheckFailure(results, criteria, slope) && CheckRollover(results, criteria, slope) && CheckCompression(results, criteria, slope) && CheckTension(results, criteria, slope));
+   }
+
+   bool CheckClearSpan(const HaulingResults& results, const HaulingCriteria& criteria)
+   {
+      return ::IsLE(results.Ls, criteria.MaxClearSpan);
+   }
+
+   bool CheckLeadingOverhang(const HaulingResults& results, const HaulingCriteria& criteria)
+   {
+      return ::IsLE(results.Lr, criteria.MaxLeadingOverhang);
+   }
+
+   bool CheckMaxWeight(const HaulingResults& results, const HaulingCriteria& criteria)
+   {
+      return ::IsLE(results.Wg, criteria.MaxGirderWeight);
+   }
+}
+
 HaulingCheckArtifact::HaulingCheckArtifact()
 {
 }
@@ -167,45 +319,44 @@ ControllingPeakCompressionCase HaulingCheckArtifact::GetControllingPeakCompressi
 
 bool HaulingCheckArtifact::Passed(bool bIgnoreConfigurationLimits) const
 {
-   bool bPassed = (Passed(HaulingSlope::CrownSlope) && Passed(HaulingSlope::Superelevation) ? true : false);
-   bPassed = bPassed && PassedDirectStressCheck(HaulingSlope::CrownSlope) && PassedDirectStressCheck(HaulingSlope::Superelevation);
+   return Passed(m_Results, m_Criteria, bIgnoreConfigurationLimits);
+}
+
+bool HaulingCheckArtifact::Passed(const HaulingResults& results, const HaulingCriteria& criteria, bool bIgnoreConfigurationLimits)
+{
+   bool bPassed = (CheckSlope(results, criteria, HaulingSlope::CrownSlope) && CheckSlope(results, criteria, HaulingSlope::Superelevation) ? true : false);
+   bPassed = bPassed && CheckDirectCompression(results, criteria, HaulingSlope::CrownSlope) && CheckDirectTension(results, criteria, HaulingSlope::CrownSlope);
+   bPassed = bPassed && CheckDirectCompression(results, criteria, HaulingSlope::Superelevation) && CheckDirectTension(results, criteria, HaulingSlope::Superelevation);
    if (!bIgnoreConfigurationLimits)
    {
-      bPassed = bPassed && PassedClearSpan() && PassedLeadingOverhang() && PassedMaxWeight();
+      bPassed = bPassed && PassedConfigurationLimits(results, criteria);
    }
    return bPassed;
 }
 
+bool HaulingCheckArtifact::PassedConfigurationLimits(const HaulingResults& results, const HaulingCriteria& criteria)
+{
+   return CheckClearSpan(results, criteria) && CheckLeadingOverhang(results, criteria) && CheckMaxWeight(results, criteria);
+}
+
 bool HaulingCheckArtifact::Passed(HaulingSlope slope) const
 {
-   for (int i = 0; i < 3; i++)
-   {
-      ImpactDirection impact = (ImpactDirection)i;
-      for (int w = 0; w < 2; w++)
-      {
-         WindDirection wind = (WindDirection)w;
-         if (!m_Results.bRotationalStability[+slope][+impact][+wind] || !m_Results.bRolloverStability[+slope][+impact][+wind])
-         {
-            return false;
-         }
-      }
-   }
-   return (PassedCrackingCheck(slope) && PassedFailureCheck(slope) && PassedRolloverCheck(slope) && PassedStressCheck(slope));
+   return CheckSlope(m_Results, m_Criteria, slope);
 }
 
 bool HaulingCheckArtifact::PassedCrackingCheck(HaulingSlope slope) const
 {
-   return m_Criteria.MinFScr < m_Results.MinFScr[+slope];
+   return CheckCracking(m_Results, m_Criteria, slope);
 }
 
 bool HaulingCheckArtifact::PassedFailureCheck(HaulingSlope slope) const
 {
-   return m_Criteria.MinFSf < m_Results.MinFsFailure[+slope];
+   return CheckFailure(m_Results, m_Criteria, slope);
 }
 
 bool HaulingCheckArtifact::PassedRolloverCheck(HaulingSlope slope) const
 {
-   return m_Criteria.MinFSf < m_Results.MinFsRollover[+slope];
+   return CheckRollover(m_Results, m_Criteria, slope);
 }
 
 bool HaulingCheckArtifact::PassedStressCheck(HaulingSlope slope) const
@@ -220,116 +371,49 @@ bool HaulingCheckArtifact::PassedDirectStressCheck(HaulingSlope slope) const
 
 bool HaulingCheckArtifact::PassedDirectCompressionCheck(HaulingSlope slope) const
 {
-   return (::IsLE(m_Criteria.AllowableCompression_GlobalStress, m_Results.MinDirectStress[+slope]) ? true : false);
+   return CheckDirectCompression(m_Results, m_Criteria, slope);
 }
 
 bool HaulingCheckArtifact::PassedDirectTensionCheck(HaulingSlope slope) const
 {
-   // since the allowable tension can change based on the amount of reinforcement
-   // in the tension region, we have to check every point for every condition
-   // against its associated allowable
-   for (const auto& sectionResult : m_Results.vSectionResults)
-   {
-      for (IndexType i = 0; i < 3; i++)
-      {
-         ImpactDirection impact = (ImpactDirection)i;
-         for (IndexType c = 0; c < 4; c++)
-         {
-            Corner corner = (Corner)c;
-            Float64 f = sectionResult.fDirect[+slope][+impact][+corner];
-
-#if defined REBAR_FOR_DIRECT_TENSION
-            Float64 fAllow = GetAllowableTension(slope, sectionResult, impact);
-            if (::IsLE(fAllow, f))
-            {
-               return false;
-            }
-#else
-            for (IndexType w = 0; w < 2; w++)
-            {
-               WindDirection wind = (WindDirection)w;
-               Float64 fAllow = GetAllowableTension(slope, sectionResult, impact, wind);
-               if (::IsLE(fAllow, f))
-               {
-                  return false;
-               }
-            }
-#endif
-         }
-      }
-   }
-
-   return true;
+   return CheckDirectTension(m_Results, m_Criteria, slope);
 }
 
 bool HaulingCheckArtifact::PassedCompressionCheck(HaulingSlope slope) const
 {
-   return (::IsLE(m_Criteria.AllowableCompression_PeakStress, m_Results.MinStress[+slope]) ? true : false);
+   return CheckCompression(m_Results, m_Criteria, slope);
 }
 
 bool HaulingCheckArtifact::PassedTensionCheck(HaulingSlope slope) const
 {
-   // since the allowable tension can change based on the amount of reinforcement
-   // in the tension region, we have to check every point for every condition
-   // against its associated allowable
-   for (const auto& sectionResult : m_Results.vSectionResults)
-   {
-      for (IndexType i = 0; i < 3; i++)
-      {
-         ImpactDirection impact = (ImpactDirection)i;
-         for (IndexType c = 0; c < 4; c++)
-         {
-            Corner corner = (Corner)c;
-#if defined REBAR_FOR_DIRECT_TENSION
-            Float64 fAllow = GetAllowableTension(slope, sectionResult, impact);
-#endif // REBAR_FOR_DIRECT_TENSION
-            for (IndexType w = 0; w < 2; w++)
-            {
-               WindDirection wind = (WindDirection)w;
-
-#if !defined REBAR_FOR_DIRECT_TENSION
-               Float64 fAllow = GetAllowableTension(slope, sectionResult, impact, wind);
-#endif // REBAR_FOR_DIRECT_TENSION
-
-               Float64 f = sectionResult.f[+slope][+impact][+wind][+corner];
-               if (::IsLE(fAllow, f))
-               {
-                  return false;
-               }
-            }
-
-         }
-      }
-   }
-
-   return true;
+   return CheckTension(m_Results, m_Criteria, slope);
 }
 
 #if defined REBAR_FOR_DIRECT_TENSION
 Float64 HaulingCheckArtifact::GetAllowableTension(HaulingSlope slope, const HaulingSectionResult& sectionResult, ImpactDirection impact) const
 {
-   return m_Criteria.TensionStressLimit->GetTensionLimit(slope, sectionResult, impact);
+   return GetTensionLimit(m_Criteria, slope, sectionResult, impact);
 }
 #else
 Float64 HaulingCheckArtifact::GetAllowableTension(HaulingSlope slope, const HaulingSectionResult& sectionResult, ImpactDirection impact, WindDirection wind) const
 {
-   return m_Criteria.TensionStressLimit->GetTensionLimit(slope, sectionResult, impact, wind);
+   return GetTensionLimit(m_Criteria, slope, sectionResult, impact, wind);
 }
 #endif
 
 bool HaulingCheckArtifact::PassedClearSpan() const
 {
-   return ::IsLE(m_Results.Ls, m_Criteria.MaxClearSpan);
+   return CheckClearSpan(m_Results, m_Criteria);
 }
 
 bool HaulingCheckArtifact::PassedLeadingOverhang() const
 {
-   return ::IsLE(m_Results.Lr, m_Criteria.MaxLeadingOverhang);
+   return CheckLeadingOverhang(m_Results, m_Criteria);
 }
 
 bool HaulingCheckArtifact::PassedMaxWeight() const
 {
-   return ::IsLE(m_Results.Wg, m_Criteria.MaxGirderWeight);
+   return CheckMaxWeight(m_Results, m_Criteria);
 }
 
 Float64 HaulingCheckArtifact::RequiredFcCompression(HaulingSlope slope) const
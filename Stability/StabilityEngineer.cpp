@@ -23,6 +23,7 @@
 
 #include <Stability/StabilityLib.h>
 #include <Stability/StabilityEngineer.h>
+#include <Stability/AnalysisPointImp.h>
 
 #include <WBFLFem2d_i.c>
 
@@ -32,6 +33,7 @@
 #include <Units\Units.h>
 #include <LRFD\ConcreteUtil.h>
 #include <Math\CubicSolver.h>
+#include <System\TaskPool.h>
 
 #include <WBFLGenericBridge.h>
 #include <WBFLGenericBridge_i.c>
@@ -48,6 +50,332 @@
 
 using namespace WBFL::Stability;
 
+namespace
+{
+   // Stability problem that forwards to another stability problem. Derived classes replace selected parameters
+   // so a stability problem can be evaluated with different parameters without modifying or copying it.
+   template <class I>
+   class ForwardingProblem : public I
+   {
+   public:
+      ForwardingProblem(const I* pProblem) : m_pProblem(pProblem)
+      {
+      }
+
+      virtual std::vector<LPCTSTR> GetPrestressNames() const override { return m_pProblem->GetPrestressNames(); }
+      virtual bool GetFpe(LPCTSTR strName, Float64 X, Float64* pFpe, Float64* pXps, Float64* pYps) const override { return m_pProblem->GetFpe(strName, X, pFpe, pXps, pYps); }
+      virtual const WBFL::Materials::SimpleConcrete& GetConcrete() const override { return m_pProblem->GetConcrete(); }
+      virtual Float64 GetRebarYieldStrength() const override { return m_pProblem->GetRebarYieldStrength(); }
+      virtual Float64 GetMaxCoverToUseHigherTensionStressLimit() const override { return m_pProblem->GetMaxCoverToUseHigherTensionStressLimit(); }
+      virtual void GetSupportLocations(Float64* pLeft, Float64* pRight) const override { m_pProblem->GetSupportLocations(pLeft, pRight); }
+      virtual Float64 GetYRollAxis() const override { return m_pProblem->GetYRollAxis(); }
+      virtual Float64 GetSweepTolerance() const override { return m_pProblem->GetSweepTolerance(); }
+      virtual Float64 GetSweepGrowth() const override { return m_pProblem->GetSweepGrowth(); }
+      virtual Float64 GetSupportPlacementTolerance() const override { return m_pProblem->GetSupportPlacementTolerance(); }
+      virtual Float64 GetCamber() const override { return m_pProblem->GetCamber(); }
+      virtual Float64 GetCamberMultiplier() const override { return m_pProblem->GetCamberMultiplier(); }
+      virtual Float64 GetLateralCamber() const override { return m_pProblem->GetLateralCamber(); }
+      virtual bool IncludeLateralRollAxisOffset() const override { return m_pProblem->IncludeLateralRollAxisOffset(); }
+      virtual void GetImpact(Float64* pIMup, Float64* pIMdown) const override { m_pProblem->GetImpact(pIMup, pIMdown); }
+      virtual void GetWindLoading(WindLoadType* pType, Float64* pLoad) const override { m_pProblem->GetWindLoading(pType, pLoad); }
+      virtual void GetAppurtenanceLoading(Float64* pex, Float64* pW) const override { m_pProblem->GetAppurtenanceLoading(pex, pW); }
+      virtual const std::vector<std::unique_ptr<IAnalysisPoint>>& GetAnalysisPoints() const override { return m_pProblem->GetAnalysisPoints(); }
+      virtual const std::unique_ptr<IAnalysisPoint>& GetAnalysisPoint(IndexType idx) const override { return m_pProblem->GetAnalysisPoint(idx); }
+
+   protected:
+      const I* m_pProblem;
+   };
+
+   class ForwardingLiftingProblem : public ForwardingProblem<ILiftingStabilityProblem>
+   {
+   public:
+      using ForwardingProblem::ForwardingProblem;
+      virtual Float64 GetLiftAngle() const override { return m_pProblem->GetLiftAngle(); }
+   };
+
+   template <class I>
+   class ForwardingSeatedProblem : public ForwardingProblem<I>
+   {
+   public:
+      using ForwardingProblem<I>::ForwardingProblem;
+      virtual Float64 GetRotationalStiffness() const override { return this->m_pProblem->GetRotationalStiffness(); }
+      virtual Float64 GetSupportWidth() const override { return this->m_pProblem->GetSupportWidth(); }
+      virtual Float64 GetHeightOfRollAxis() const override { return this->m_pProblem->GetHeightOfRollAxis(); }
+      virtual Float64 GetSupportSlope() const override { return this->m_pProblem->GetSupportSlope(); }
+   };
+
+   class ForwardingHaulingProblem : public ForwardingSeatedProblem<IHaulingStabilityProblem>
+   {
+   public:
+      using ForwardingSeatedProblem::ForwardingSeatedProblem;
+      virtual HaulingImpact GetImpactUsage() const override { return m_pProblem->GetImpactUsage(); }
+      virtual Float64 GetSuperelevation() const override { return m_pProblem->GetSuperelevation(); }
+      virtual Float64 GetVelocity() const override { return m_pProblem->GetVelocity(); }
+      virtual Float64 GetTurningRadius() const override { return m_pProblem->GetTurningRadius(); }
+      virtual CFType GetCentrifugalForceType() const override { return m_pProblem->GetCentrifugalForceType(); }
+   };
+
+   class ForwardingOneEndSeatedProblem : public ForwardingSeatedProblem<IOneEndSeatedStabilityProblem>
+   {
+   public:
+      using ForwardingSeatedProblem::ForwardingSeatedProblem;
+      virtual GirderSide GetSeatedEnd() const override { return m_pProblem->GetSeatedEnd(); }
+      virtual Float64 GetRotationalStiffnessAdjustmentFactor() const override { return m_pProblem->GetRotationalStiffnessAdjustmentFactor(); }
+      virtual Float64 GetYRollLiftEnd() const override { return m_pProblem->GetYRollLiftEnd(); }
+      virtual Float64 GetLiftPlacementTolerance() const override { return m_pProblem->GetLiftPlacementTolerance(); }
+   };
+
+   // Stability problem that replaces the support locations of another stability problem.
+   // B is one of the forwarding problem classes.
+   //
+   // The peak support moment occurs at the supports so analysis points are added at the support locations,
+   // and at the midpoint between the supports, if the original stability problem doesn't already have them.
+   // The analysis points are created once when the problem is created.
+   template <class B>
+   class SupportLocationProblem : public B
+   {
+   public:
+      template <class I>
+      SupportLocationProblem(const IGirder* pGirder, const I* pProblem, SupportLocationSweep::Support support, Float64 location) :
+         B(pProblem), m_Support(support), m_Location(location)
+      {
+         Float64 Ll, Lr;
+         GetSupportLocations(&Ll, &Lr);
+         Float64 Lg = pGirder->GetGirderLength();
+
+         const auto& vAnalysisPoints = this->m_pProblem->GetAnalysisPoints();
+         m_vAnalysisPoints.reserve(vAnalysisPoints.size() + 3);
+         for (const auto& pAnalysisPoint : vAnalysisPoints)
+         {
+            m_vAnalysisPoints.emplace_back(pAnalysisPoint->Clone());
+         }
+
+         for (auto X : { Ll, Lg - Lr, 0.5 * (Ll + Lg - Lr) })
+         {
+            if (std::none_of(vAnalysisPoints.begin(), vAnalysisPoints.end(), [X](const auto& pAnalysisPoint) {return ::IsEqual(X, pAnalysisPoint->GetLocation()); }))
+            {
+               m_vAnalysisPoints.emplace_back(std::make_unique<AnalysisPoint>(X));
+            }
+         }
+
+         std::stable_sort(m_vAnalysisPoints.begin(), m_vAnalysisPoints.end(), [](const auto& pA, const auto& pB) {return pA->GetLocation() < pB->GetLocation(); });
+      }
+
+      virtual void GetSupportLocations(Float64* pLeft, Float64* pRight) const override
+      {
+         this->m_pProblem->GetSupportLocations(pLeft, pRight);
+         if (m_Support != SupportLocationSweep::Support::Right) *pLeft = m_Location;
+         if (m_Support != SupportLocationSweep::Support::Left) *pRight = m_Location;
+      }
+
+      virtual const std::vector<std::unique_ptr<IAnalysisPoint>>& GetAnalysisPoints() const override { return m_vAnalysisPoints; }
+      virtual const std::unique_ptr<IAnalysisPoint>& GetAnalysisPoint(IndexType idx) const override { return m_vAnalysisPoints[idx]; }
+
+   private:
+      SupportLocationSweep::Support m_Support;
+      Float64 m_Location;
+      std::vector<std::unique_ptr<IAnalysisPoint>> m_vAnalysisPoints;
+   };
+
+   using LiftingSupportLocationProblem = SupportLocationProblem<ForwardingLiftingProblem>;
+   using HaulingSupportLocationProblem = SupportLocationProblem<ForwardingHaulingProblem>;
+   using OneEndSeatedSupportLocationProblem = SupportLocationProblem<ForwardingOneEndSeatedProblem>;
+
+   // Hauling stability problem that replaces the truck parameters of another hauling stability problem
+   // with the parameters of a hauling criteria variant
+   class HaulingVariantProblem : public ForwardingHaulingProblem
+   {
+   public:
+      HaulingVariantProblem(const IHaulingStabilityProblem* pProblem, const HaulingCriteriaVariant& variant) :
+         ForwardingHaulingProblem(pProblem), m_Variant(variant)
+      {
+      }
+
+      virtual Float64 GetRotationalStiffness() const override { return m_Variant.RotationalStiffness.value_or(m_pProblem->GetRotationalStiffness()); }
+      virtual Float64 GetSupportWidth() const override { return m_Variant.SupportWidth.value_or(m_pProblem->GetSupportWidth()); }
+      virtual Float64 GetHeightOfRollAxis() const override { return m_Variant.HeightOfRollAxis.value_or(m_pProblem->GetHeightOfRollAxis()); }
+
+   private:
+      const HaulingCriteriaVariant& m_Variant;
+   };
+
+   // The Fem2d model is an apartment threaded COM object. Each thread that analyzes a stability problem
+   // needs its own apartment so that its models are used directly instead of through marshaling.
+   class ComApartment
+   {
+   public:
+      ComApartment() : m_bInitialized(SUCCEEDED(::CoInitializeEx(nullptr, COINIT_APARTMENTTHREADED))) {}
+      ComApartment(const ComApartment&) = delete;
+      ~ComApartment() { if (m_bInitialized) ::CoUninitialize(); }
+      ComApartment& operator=(const ComApartment&) = delete;
+
+   private:
+      bool m_bInitialized;
+   };
+
+   // Stresses at the four corners of the girder section for every analysis point and load case of a girder.
+   // The stresses are stored contiguously as [analysis point][load case][corner] so the stress terms can be
+   // computed in simple passes over the entire girder and the extreme stresses found by reductions over the array.
+   class StressArray
+   {
+   public:
+      StressArray(IndexType nPoints, IndexType nCases) :
+         m_nCases(nCases), m_Stress(nPoints * nCases * 4, 0.0)
+      {
+      }
+
+      Float64* operator()(IndexType pointIdx, IndexType caseIdx) { return &m_Stress[(pointIdx * m_nCases + caseIdx) * 4]; }
+      const Float64* operator()(IndexType pointIdx, IndexType caseIdx) const { return &m_Stress[(pointIdx * m_nCases + caseIdx) * 4]; }
+
+   private:
+      IndexType m_nCases;
+      std::vector<Float64> m_Stress;
+   };
+
+   // Index of the unit load stresses in the unit stress array
+   enum UnitStress { UnitPrestress, UnitGirder, UnitWind, UnitCF, UnitCable, nUnitStresses };
+
+   // Section data at an analysis point needed to evaluate cracking and tension reinforcement after the stresses are computed
+   struct SectionData
+   {
+      Float64 Ixx, Ixy, D;
+      std::array<Point, 4> pntStress;
+      CComPtr<IShape> shape;
+      CComPtr<IRebarSection> rebarSection;
+   };
+
+   // An extreme stress found by reducing a StressArray
+   struct StressExtreme
+   {
+      Float64 f;
+      IndexType PointIdx;
+      IndexType CaseIdx;
+      Corner corner;
+   };
+
+   // Reduces the stresses for load cases [firstCase,firstCase+nCases) at an analysis point to the max and min stress on each face of the girder.
+   // The extremes are updated in place and only replaced by stresses that are more extreme.
+   // Load cases where vbEvaluated is false are skipped. vbEvaluated is indexed by firstCase-relative load case.
+   void ReduceFaceStresses(const StressArray& stress, IndexType pointIdx, IndexType firstCase, IndexType nCases, const std::vector<bool>& vbEvaluated, std::array<StressExtreme, 2>& maxStress, std::array<StressExtreme, 2>& minStress)
+   {
+      for (IndexType caseIdx = 0; caseIdx < nCases; caseIdx++)
+      {
+         if (!vbEvaluated[caseIdx]) continue;
+
+         const Float64* f = stress(pointIdx, firstCase + caseIdx);
+         for (int c = 0; c < 4; c++)
+         {
+            Corner corner = (Corner)c;
+            GirderFace face = GetFace(corner);
+            if (::IsLT(maxStress[+face].f, f[c])) maxStress[+face] = { f[c], pointIdx, caseIdx, corner };
+            if (::IsLT(f[c], minStress[+face].f)) minStress[+face] = { f[c], pointIdx, caseIdx, corner };
+         }
+      }
+   }
+
+   // Reduces the stresses for load cases [firstCase,firstCase+nCases) at all analysis points to the overall max and min stress.
+   void ReduceStresses(const StressArray& stress, IndexType nPoints, IndexType firstCase, IndexType nCases, const std::vector<bool>& vbEvaluated, StressExtreme& maxStress, StressExtreme& minStress)
+   {
+      for (IndexType pointIdx = 0; pointIdx < nPoints; pointIdx++)
+      {
+         for (IndexType caseIdx = 0; caseIdx < nCases; caseIdx++)
+         {
+            if (!vbEvaluated[caseIdx]) continue;
+
+            const Float64* f = stress(pointIdx, firstCase + caseIdx);
+            for (int c = 0; c < 4; c++)
+            {
+               if (::IsLT(maxStress.f, f[c])) maxStress = { f[c], pointIdx, caseIdx, (Corner)c };
+               if (::IsLT(f[c], minStress.f)) minStress = { f[c], pointIdx, caseIdx, (Corner)c };
+            }
+         }
+      }
+   }
+
+   // Evaluates the minimum factor of safety at equally spaced support locations, then refines the optimum
+   // location with a golden-section search between the neighbors of the best location.
+   // evaluate(location) returns the minimum factor of safety at a support location. It is called concurrently.
+   template <class F>
+   SupportLocationSweepResults SweepSupportLocations(const IGirder* pGirder, const SupportLocationSweep& sweep, F evaluate)
+   {
+      PRECONDITION(2 <= sweep.nLocations);
+      PRECONDITION(sweep.Start <= sweep.End);
+
+      pGirder->GetGirderLength(); // the girder length is computed on first request. get it now so the worker threads only read the girder
+
+      IndexType nLocations = sweep.nLocations;
+      Float64 spacing = (sweep.End - sweep.Start) / (nLocations - 1);
+
+      SupportLocationSweepResults results;
+      results.FS.resize(nLocations);
+
+      // Evaluates locations in the range [firstIdx,lastIdx]. Each location writes to its own element of results.FS
+      auto evaluate_range = [&](IndexType firstIdx, IndexType lastIdx)
+      {
+         ComApartment apartment;
+         for (IndexType i = firstIdx; i <= lastIdx; i++)
+         {
+            Float64 location = (i == nLocations - 1 ? sweep.End : sweep.Start + i * spacing);
+            results.FS[i] = std::make_pair(location, evaluate(location));
+         }
+      };
+
+      WBFL::System::TaskPool::ParallelFor(0, nLocations, [&evaluate_range](IndexType beginIdx, IndexType endIdx) {evaluate_range(beginIdx, endIdx - 1); });
+
+      results.nEvaluations = nLocations;
+
+      auto best = std::max_element(results.FS.begin(), results.FS.end(), [](const auto& a, const auto& b) {return a.second < b.second; });
+      std::tie(results.OptimumLocation, results.OptimumFS) = *best;
+
+      // Refine the optimum location. The minimum factor of safety is assumed to be unimodal between the neighbors of the best location.
+      IndexType bestIdx = std::distance(results.FS.begin(), best);
+      Float64 a = results.FS[bestIdx == 0 ? 0 : bestIdx - 1].first;
+      Float64 b = results.FS[bestIdx == nLocations - 1 ? bestIdx : bestIdx + 1].first;
+      Float64 tolerance = (0 < sweep.Tolerance ? sweep.Tolerance : 0.01 * spacing);
+      if (tolerance <= 0 || b - a <= tolerance) return results;
+
+      ComApartment apartment;
+      auto evaluate_and_track = [&](Float64 location)
+      {
+         Float64 fs = evaluate(location);
+         results.nEvaluations++;
+         if (results.OptimumFS < fs)
+         {
+            results.OptimumLocation = location;
+            results.OptimumFS = fs;
+         }
+         return fs;
+      };
+
+      const Float64 r = (sqrt(5.0) - 1.0) / 2.0;
+      Float64 x1 = b - r * (b - a);
+      Float64 x2 = a + r * (b - a);
+      Float64 f1 = evaluate_and_track(x1);
+      Float64 f2 = evaluate_and_track(x2);
+      while (tolerance < b - a)
+      {
+         if (f1 < f2)
+         {
+            a = x1;
+            x1 = x2;
+            f1 = f2;
+            x2 = a + r * (b - a);
+            f2 = evaluate_and_track(x2);
+         }
+         else
+         {
+            b = x2;
+            x2 = x1;
+            f2 = f1;
+            x1 = b - r * (b - a);
+            f1 = evaluate_and_track(x1);
+         }
+      }
+
+      return results;
+   }
+};
+
 StabilityEngineer::StabilityEngineer()
 {
 }
@@ -100,6 +428,146 @@ OneEndSeatedCheckArtifact StabilityEngineer::CheckOneEndSeated(const IGirder* pG
    return artifact;
 }
 
+std::vector<HaulingCheckRecord> StabilityEngineer::CheckHauling(const std::vector<HaulingCheckItem>& vItems, const std::vector<HaulingCriteriaVariant>& vVariants, bool bCreateArtifacts) const
+{
+   IndexType nItems = vItems.size();
+   IndexType nVariants = vVariants.size();
+
+   std::vector<HaulingCheckRecord> vRecords(nItems * nVariants);
+   if (vRecords.empty()) return vRecords;
+
+   // The analysis results depend on the truck parameters, but not on the check criteria.
+   // Group the variants by truck parameters so each girder is analyzed once per group.
+   std::vector<std::vector<IndexType>> vGroups;
+   for (IndexType variantIdx = 0; variantIdx < nVariants; variantIdx++)
+   {
+      const auto& variant = vVariants[variantIdx];
+      auto found = std::find_if(vGroups.begin(), vGroups.end(), [&variant, &vVariants](const auto& group)
+         {
+            const auto& other = vVariants[group.front()];
+            return variant.RotationalStiffness == other.RotationalStiffness && variant.SupportWidth == other.SupportWidth && variant.HeightOfRollAxis == other.HeightOfRollAxis;
+         });
+
+      if (found == vGroups.end())
+      {
+         vGroups.emplace_back(1, variantIdx);
+      }
+      else
+      {
+         found->push_back(variantIdx);
+      }
+   }
+
+   for (const auto& item : vItems)
+   {
+      item.pGirder->GetGirderLength(); // the girder length is computed on first request. get it now so the worker threads only read the girder
+   }
+
+   // Each work unit is one girder analyzed for one group of variants. Every work unit writes only to its own records.
+   IndexType nGroups = vGroups.size();
+   IndexType nWorkUnits = nItems * nGroups;
+   auto check_range = [&](IndexType firstIdx, IndexType lastIdx)
+   {
+      ComApartment apartment;
+      for (IndexType workIdx = firstIdx; workIdx <= lastIdx; workIdx++)
+      {
+         IndexType itemIdx = workIdx / nGroups;
+         const auto& item = vItems[itemIdx];
+         const auto& group = vGroups[workIdx % nGroups];
+
+         // each work unit uses its own engineer because the engineer keeps state during an analysis
+         HaulingVariantProblem problem(item.pStabilityProblem, vVariants[group.front()]);
+         StabilityEngineer engineer;
+         HaulingResults results = engineer.AnalyzeHauling(item.pGirder, &problem);
+
+         Float64 MinFScr = Float64_Max;
+         Float64 MinFsFailure = Float64_Max;
+         Float64 MinFsRollover = Float64_Max;
+         Float64 MinFS = Float64_Max;
+         HaulingSlope controllingSlope = HaulingSlope::CrownSlope;
+         for (int s = 0; s < 2; s++)
+         {
+            HaulingSlope slope = (HaulingSlope)s;
+            MinFScr = Min(MinFScr, results.MinFScr[+slope]);
+            MinFsFailure = Min(MinFsFailure, results.MinAdjFsFailure[+slope]);
+            MinFsRollover = Min(MinFsRollover, results.MinFsRollover[+slope]);
+
+            Float64 fs = Min(results.MinFScr[+slope], results.MinAdjFsFailure[+slope], results.MinFsRollover[+slope]);
+            if (fs < MinFS)
+            {
+               MinFS = fs;
+               controllingSlope = slope;
+            }
+         }
+
+         for (auto variantIdx : group)
+         {
+            const auto& criteria = vVariants[variantIdx].Criteria;
+
+            // evaluate the check directly from the results so an artifact, which holds a copy
+            // of the results and criteria, is only created when the caller asks for it
+            auto& record = vRecords[itemIdx * nVariants + variantIdx];
+            record.ItemIndex = itemIdx;
+            record.VariantIndex = variantIdx;
+            record.bPassed = HaulingCheckArtifact::Passed(results, criteria, true);
+            record.bPassedConfigurationLimits = HaulingCheckArtifact::PassedConfigurationLimits(results, criteria);
+            record.MinFScr = MinFScr;
+            record.MinFsFailure = MinFsFailure;
+            record.MinFsRollover = MinFsRollover;
+            record.ControllingSlope = controllingSlope;
+            if (bCreateArtifacts)
+            {
+               record.Artifact = std::make_shared<HaulingCheckArtifact>(results, criteria);
+            }
+         }
+      }
+   };
+
+   WBFL::System::TaskPool::ParallelFor(0, nWorkUnits, [&check_range](IndexType beginIdx, IndexType endIdx) {check_range(beginIdx, endIdx - 1); });
+
+   return vRecords;
+}
+
+SupportLocationSweepResults StabilityEngineer::SweepLifting(const IGirder* pGirder, const ILiftingStabilityProblem* pStabilityProblem, const SupportLocationSweep& sweep) const
+{
+   return SweepSupportLocations(pGirder, sweep, [pGirder, pStabilityProblem, &sweep](Float64 location)
+      {
+         // each evaluation uses its own engineer because the engineer keeps state during an analysis
+         LiftingSupportLocationProblem problem(pGirder, pStabilityProblem, sweep.MovingSupport, location);
+         StabilityEngineer engineer;
+         auto results = engineer.AnalyzeLifting(pGirder, &problem);
+         return Min(results.FScrMin, results.MinAdjFsFailure);
+      });
+}
+
+SupportLocationSweepResults StabilityEngineer::SweepHauling(const IGirder* pGirder, const IHaulingStabilityProblem* pStabilityProblem, const SupportLocationSweep& sweep) const
+{
+   return SweepSupportLocations(pGirder, sweep, [pGirder, pStabilityProblem, &sweep](Float64 location)
+      {
+         HaulingSupportLocationProblem problem(pGirder, pStabilityProblem, sweep.MovingSupport, location);
+         StabilityEngineer engineer;
+         auto results = engineer.AnalyzeHauling(pGirder, &problem);
+         Float64 fs = Float64_Max;
+         for (int s = 0; s < 2; s++)
+         {
+            HaulingSlope slope = (HaulingSlope)s;
+            fs = Min(fs, Min(results.MinFScr[+slope], results.MinAdjFsFailure[+slope], results.MinFsRollover[+slope]));
+         }
+         return fs;
+      });
+}
+
+SupportLocationSweepResults StabilityEngineer::SweepOneEndSeated(const IGirder* pGirder, const IOneEndSeatedStabilityProblem* pStabilityProblem, const SupportLocationSweep& sweep) const
+{
+   return SweepSupportLocations(pGirder, sweep, [pGirder, pStabilityProblem, &sweep](Float64 location)
+      {
+         OneEndSeatedSupportLocationProblem problem(pGirder, pStabilityProblem, sweep.MovingSupport, location);
+         StabilityEngineer engineer;
+         auto results = engineer.AnalyzeOneEndSeated(pGirder, &problem);
+         return Min(results.MinFScr, results.MinAdjFsFailure, results.MinFsRollover);
+      });
+}
+
 void StabilityEngineer::PrepareResults(const IGirder* pGirder,const IStabilityProblem* pStabilityProblem,Results& results) const
 {
    Float64 Ll,Lr;
@@ -147,6 +615,7 @@ void StabilityEngineer::PrepareResults(const IGirder* pGirder,const IStabilityPr
 void StabilityEngineer::Analyze(const IGirder* pGirder,const IStabilityProblem* pStabilityProblem,Results& results,IFem2dModel** ppModel) const
 {
    BuildModel(pGirder,pStabilityProblem,results,ppModel);
+   ExtractUnitLoadResults(pStabilityProblem,*ppModel,results);
 
    Float64 Lg = pGirder->GetGirderLength();
    Float64 Wg = results.Wg;
@@ -279,14 +748,6 @@ void StabilityEngineer::AnalyzeLifting(const IGirder* pGirder,const ILiftingStab
 
    std::shared_ptr<IAlternateTensStressDataProvider> pAlternateTensStressDataProvider = pGirder->GetAlternateTensStressDataProvider();
 
-   // Get deflection due to horizontal component of lifting cable force
-   CComQIPtr<IFem2dModelResults> femResults(model);
-   // recall that the deflection is based on a unit force, so scale the value from the fem model by the actual force
-   Float64 dx,dy1,dy2,rz;
-   femResults->ComputePOIDeflections(LCID_LIFT,m_StartPoi,lotMember,&dx,&dy1,&rz);
-   femResults->ComputePOIDeflections(LCID_LIFT,m_MidSpanPoi,lotMember,&dx,&dy2,&rz);
-   //results.dLift = results.Plift*(dy2 - dy1); // does not include impact... measured relative to the ends of the girder
-
    for ( IndexType i = 0; i < 3; i++ )
    {
       ImpactDirection impact = (ImpactDirection)i;
@@ -352,16 +813,25 @@ void StabilityEngineer::AnalyzeLifting(const IGirder* pGirder,const ILiftingStab
    // this puts the force furthest from the arc which is conservative
    Float64 a = Min(Ll,Lr);
 
-   PoiIDType poiID = 0;
-   IndexType analysisPointIdx = 0;
+   // Stresses are computed for all analysis points in three steps. First, the section properties and the stresses due to
+   // unit loads are computed at each analysis point. Second, the direct, tilt, and total stresses for all load cases are computed
+   // by superposition in passes over contiguous stress arrays, and the extreme stresses are found by reductions over those arrays.
+   // Last, cracking is evaluated at each analysis point.
    const auto& vAnalysisPoints = pStabilityProblem->GetAnalysisPoints();
-   for( const auto& pAnalysisPoint : vAnalysisPoints)
+   IndexType nPoints = vAnalysisPoints.size();
+   StressArray fUnit(nPoints, nUnitStresses);
+   StressArray cTilt(nPoints, 1); // stress at each corner due to a unit lateral moment
+   std::vector<SectionData> vSections;
+   vSections.reserve(nPoints);
+   std::vector<Float64> vPlift; // horizontal component of the lift cable force at each analysis point
+   vPlift.reserve(nPoints);
+   for (IndexType pointIdx = 0; pointIdx < nPoints; pointIdx++)
    {
-      Float64 X = pAnalysisPoint->GetLocation();
+      Float64 X = vAnalysisPoints[pointIdx]->GetLocation();
 
       LiftingSectionResult sectionResult;
 
-      sectionResult.AnalysisPointIndex = analysisPointIdx++;
+      sectionResult.AnalysisPointIndex = pointIdx;
 
       CComPtr<IRebarSection> rebarSection;
       CComPtr<IShape> shape;
@@ -386,16 +856,8 @@ void StabilityEngineer::AnalyzeLifting(const IGirder* pGirder,const ILiftingStab
       sectionResult.OffsetFactor = IsZero(sectionResult.OffsetFactor) ? 0.0 : sectionResult.OffsetFactor;
 
       // Get forces from external loads
-      Float64 fx,fy,mz;
-      femResults->ComputePOIForces(LCID_GIRDER,poiID,mftLeft,lotMember,&fx,&fy,&mz);
-      CHECK(IsZero(fx));
-      mz = IsZero(mz) ? 0 : mz;
-      sectionResult.Mg = mz;
-
-      femResults->ComputePOIForces(LCID_WIND,poiID,mftLeft,lotMember,&fx,&fy,&mz);
-      CHECK(IsZero(fx));
-      mz = IsZero(mz) ? 0 : mz;
-      sectionResult.Mw = mz;
+      sectionResult.Mg = m_UnitLoadResults.Mg[sectionResult.AnalysisPointIndex];
+      sectionResult.Mw = m_UnitLoadResults.Mw[sectionResult.AnalysisPointIndex];
 
       Float64 Hg,Ag,Ixx,Iyy,Ixy,Xleft,Ytop,Wtf,Wbf;
       pGirder->GetSectionProperties(X,&Ag,&Ixx,&Iyy,&Ixy,&Xleft,&Ytop,&Hg,&Wtf,&Wbf);
@@ -456,124 +918,201 @@ void StabilityEngineer::AnalyzeLifting(const IGirder* pGirder,const ILiftingStab
          sectionResult.fw[+corner] = ((MyWind*Ixx + MxWind*Ixy)*pntStress[+corner].X() - (MxWind*Iyy + MyWind*Ixy)*pntStress[+corner].Y()) / D;
       } // next corner
 
-      // analyze the girder for all the combinations of impact and wind
-      for ( IndexType i = 0; i < 3; i++ )
+      for (IndexType i = 0; i < 3; i++)
       {
          ImpactDirection impact = (ImpactDirection)i;
-
-         for (IndexType c = 0; c < 4; c++)
+         for (IndexType w = 0; w < 2; w++)
          {
-            Corner corner = (Corner)c;
+            WindDirection wind = (WindDirection)w;
+            // if there isn't a lifting force, the force cannot be eccentric so eh and Mh remain zero
+            if (results.bIsStable[+impact][+wind] && !IsZero(Plift))
+            {
+               Float64 windSign = (wind == WindDirection::Left ? 1 : -1);
 
-            GirderFace face = GetFace(corner);
-            GirderSide side = GetSide(corner);
+               // Because there is lateral deflection of the girder, the force in the inclined lift cable creates a moment about the Y-axis
+               // Compute the eccentricity of the force and the moment at this section
+               sectionResult.eh[+impact][+wind] = SupportPlacementTolerance*results.emag[+impact] * (1 - sectionResult.OffsetFactor) + (results.EccLateralSweep[+impact] + windSign*results.ZoWind[+impact])*sectionResult.OffsetFactor;
+               sectionResult.Mh[+impact][+wind] = -Plift*sectionResult.eh[+impact][+wind];
+            }
+         }
+      }
 
-            Float64 sideSign = (side == GirderSide::Left ? -1 : 1);
+      // gather the unit stresses and tilt stress coefficients for the vectorized passes below
+      std::copy(sectionResult.fps.begin(), sectionResult.fps.end(), fUnit(pointIdx, UnitPrestress));
+      std::copy(sectionResult.fg.begin(), sectionResult.fg.end(), fUnit(pointIdx, UnitGirder));
+      std::copy(sectionResult.fw.begin(), sectionResult.fw.end(), fUnit(pointIdx, UnitWind));
+      std::copy(sectionResult.fcable.begin(), sectionResult.fcable.end(), fUnit(pointIdx, UnitCable));
+      Float64* c = cTilt(pointIdx, 0);
+      for (int cn = 0; cn < 4; cn++)
+      {
+         c[cn] = (Ixx*pntStress[cn].X() - Ixy*pntStress[cn].Y()) / D;
+      }
 
-            // stress due to direct loads
-            sectionResult.fDirect[+impact][+corner] = sectionResult.fps[+corner] + IM[+impact] * (sectionResult.fg[+corner] + sectionResult.fcable[+corner]);
+      vSections.push_back({ Ixx, Ixy, D, pntStress, shape, rebarSection });
+      vPlift.push_back(Plift);
+      results.vSectionResults.push_back(sectionResult);
+   } // next analysis point
 
-            if (::IsLT(sectionResult.fMaxDirect[+face], sectionResult.fDirect[+impact][+corner]))
-            {
-               sectionResult.fMaxDirect[+face] = sectionResult.fDirect[+impact][+corner];
-               sectionResult.MaxDirectStressImpactDirection[+face] = impact;
-               sectionResult.MaxDirectStressCorner[+face] = corner;
-            }
+   // Load cases are indexed as [ImpactDirection] for direct stresses and [ImpactDirection][WindDirection] for total stresses
+   constexpr IndexType nDirectCases = 3;
+   constexpr IndexType nCases = 6;
+   std::array<Float64, nCases> windFactor;
+   std::vector<bool> vbStable(nCases);
+   for (int i = 0; i < 3; i++)
+   {
+      ImpactDirection impact = (ImpactDirection)i;
+      for (int w = 0; w < 2; w++)
+      {
+         WindDirection wind = (WindDirection)w;
+         IndexType caseIdx = 2*i + w;
+         vbStable[caseIdx] = results.bIsStable[+impact][+wind];
+         windFactor[caseIdx] = (wind == WindDirection::Left ? 1 : -1);
+      }
+   }
 
-            if (::IsLT(sectionResult.fDirect[+impact][+corner], sectionResult.fMinDirect[+face]))
-            {
-               sectionResult.fMinDirect[+face] = sectionResult.fDirect[+impact][+corner];
-               sectionResult.MinDirectStressImpactDirection[+face] = impact;
-               sectionResult.MinDirectStressCorner[+face] = corner;
-            }
+   // the tilt stress coefficients assume tilt to the left so flip the sign if the girder is assumed to tilt to the right
+   Float64 tiltSign = (results.AssumedTiltDirection == GirderSide::Right ? -1 : 1);
 
-            // Overall max direct stress
-            if (::IsLT(results.MaxDirectStress, sectionResult.fDirect[+impact][+corner]))
-            {
-               results.MaxDirectStress = sectionResult.fDirect[+impact][+corner];
-               results.MaxDirectStressAnalysisPointIndex = sectionResult.AnalysisPointIndex;
-               results.MaxDirectStressImpactDirection = impact;
-               results.MaxDirectStressCorner = corner;
-            }
+   // compute stresses by superposition of unit load stresses
+   StressArray fDirect(nPoints, nDirectCases);
+   StressArray fTilt(nPoints, nCases);
+   StressArray fTotal(nPoints, nCases);
+   for (IndexType pointIdx = 0; pointIdx < nPoints; pointIdx++)
+   {
+      const auto& sectionResult = results.vSectionResults[pointIdx];
+      const Float64* fps = fUnit(pointIdx, UnitPrestress);
+      const Float64* fg = fUnit(pointIdx, UnitGirder);
+      const Float64* fw = fUnit(pointIdx, UnitWind);
+      const Float64* fcable = fUnit(pointIdx, UnitCable);
+      const Float64* c = cTilt(pointIdx, 0);
+      Float64 Plift = vPlift[pointIdx];
+
+      // stress due to direct loads
+      for (IndexType directCaseIdx = 0; directCaseIdx < nDirectCases; directCaseIdx++)
+      {
+         Float64* fd = fDirect(pointIdx, directCaseIdx);
+         for (int cn = 0; cn < 4; cn++)
+         {
+            fd[cn] = fps[cn] + IM[directCaseIdx]*(fg[cn] + fcable[cn]);
+         }
+      }
 
-            // Overall min direct stress
-            if (::IsLT(sectionResult.fDirect[+impact][+corner], results.MinDirectStress))
-            {
-               results.MinDirectStress = sectionResult.fDirect[+impact][+corner];
-               results.MinDirectStressAnalysisPointIndex = sectionResult.AnalysisPointIndex;
-               results.MinDirectStressImpactDirection = impact;
-               results.MinDirectStressCorner = corner;
-            }
-            
-            for (IndexType w = 0; w < 2; w++)
-            {
-               WindDirection wind = (WindDirection)w;
-               if (results.bIsStable[+impact][+wind])
-               {
-                  Float64 windSign = (wind == WindDirection::Left ? 1 : -1);
+      for (IndexType caseIdx = 0; caseIdx < nCases; caseIdx++)
+      {
+         if (!vbStable[caseIdx]) continue;
 
-                  if (IsZero(Plift))
-                  {
-                     // if there isn't a lifting force, the force cannot be eccentric
-                     sectionResult.eh[+impact][+wind] = 0;
-                     sectionResult.Mh[+impact][+wind] = 0;
-                  }
-                  else
-                  {
-                     // Because there is lateral deflection of the girder, the force in the inclined lift cable creates a moment about the Y-axis
-                     // Compute the eccentricity of the force and the moment at this section
-                     sectionResult.eh[+impact][+wind] = SupportPlacementTolerance*results.emag[+impact] * (1 - sectionResult.OffsetFactor) + (results.EccLateralSweep[+impact] + windSign*results.ZoWind[+impact])*sectionResult.OffsetFactor;
-                     sectionResult.Mh[+impact][+wind] = -Plift*sectionResult.eh[+impact][+wind];
-                  }
+         IndexType i = caseIdx/2;
+         IndexType w = caseIdx%2;
 
-                  // stress due to lateral loads caused by the girder being tilted
-                  //Float64 Mx = 0;
-                  Float64 My = -1.0*IM[+impact] * ((sectionResult.Mg - Plift*results.Zo[+impact])*results.ThetaEq[+impact][+wind] + sectionResult.Mh[+impact][+wind]);
-                  Float64 f = ((My*Ixx/* + Mx*Ixy*/)*pntStress[+corner].X() - (/*Mx*Iyy + */My*Ixy)*pntStress[+corner].Y()) / D;
-                  if (results.AssumedTiltDirection == GirderSide::Right)
-                  {
-                     // girder is tilted to the right so flip the sign
-                     // f is computed assuming tilt to the left
-                     f *= -1;
-                  }
-                  sectionResult.fTilt[+impact][+wind][+corner] = f;
+         // stress due to lateral loads caused by the girder being tilted and total stress
+         const Float64* fd = fDirect(pointIdx, i);
+         Float64* ft = fTilt(pointIdx, caseIdx);
+         Float64* ftotal = fTotal(pointIdx, caseIdx);
+         Float64 My = -1.0*tiltSign*IM[i]*((sectionResult.Mg - Plift*results.Zo[i])*results.ThetaEq[i][w] + sectionResult.Mh[i][w]);
+         for (int cn = 0; cn < 4; cn++)
+         {
+            ft[cn] = My*c[cn];
+            ftotal[cn] = fd[cn] + windFactor[caseIdx]*fw[cn] + ft[cn];
+         }
+      }
+   }
 
-                  // total stress
-                  sectionResult.f[+impact][+wind][+corner] = sectionResult.fDirect[+impact][+corner] + windSign*sectionResult.fw[+corner] + sectionResult.fTilt[+impact][+wind][+corner];
+   // find the extreme stresses
+   std::vector<bool> vbAllDirect(nDirectCases, true);
+   for (IndexType pointIdx = 0; pointIdx < nPoints; pointIdx++)
+   {
+      auto& sectionResult = results.vSectionResults[pointIdx];
 
-                  if (::IsLT(sectionResult.fMax[+face], sectionResult.f[+impact][+wind][+corner]))
-                  {
-                     sectionResult.fMax[+face] = sectionResult.f[+impact][+wind][+corner];
-                     sectionResult.MaxStressImpactDirection[+face] = impact;
-                     sectionResult.MaxStressWindDirection[+face] = wind;
-                     sectionResult.MaxStressCorner[+face] = corner;
-                  }
+      std::array<StressExtreme, 2> maxStress, minStress;
+      for (int fc = 0; fc < 2; fc++)
+      {
+         maxStress[fc] = { sectionResult.fMaxDirect[fc], pointIdx, (IndexType)sectionResult.MaxDirectStressImpactDirection[fc], sectionResult.MaxDirectStressCorner[fc] };
+         minStress[fc] = { sectionResult.fMinDirect[fc], pointIdx, (IndexType)sectionResult.MinDirectStressImpactDirection[fc], sectionResult.MinDirectStressCorner[fc] };
+      }
+      ReduceFaceStresses(fDirect, pointIdx, 0, nDirectCases, vbAllDirect, maxStress, minStress);
+      for (int fc = 0; fc < 2; fc++)
+      {
+         sectionResult.fMaxDirect[fc] = maxStress[fc].f;
+         sectionResult.MaxDirectStressImpactDirection[fc] = (ImpactDirection)maxStress[fc].CaseIdx;
+         sectionResult.MaxDirectStressCorner[fc] = maxStress[fc].corner;
+         sectionResult.fMinDirect[fc] = minStress[fc].f;
+         sectionResult.MinDirectStressImpactDirection[fc] = (ImpactDirection)minStress[fc].CaseIdx;
+         sectionResult.MinDirectStressCorner[fc] = minStress[fc].corner;
+
+         maxStress[fc] = { sectionResult.fMax[fc], pointIdx, 2*(IndexType)sectionResult.MaxStressImpactDirection[fc] + (IndexType)sectionResult.MaxStressWindDirection[fc], sectionResult.MaxStressCorner[fc] };
+         minStress[fc] = { sectionResult.fMin[fc], pointIdx, 2*(IndexType)sectionResult.MinStressImpactDirection[fc] + (IndexType)sectionResult.MinStressWindDirection[fc], sectionResult.MinStressCorner[fc] };
+      }
+      ReduceFaceStresses(fTotal, pointIdx, 0, nCases, vbStable, maxStress, minStress);
+      for (int fc = 0; fc < 2; fc++)
+      {
+         sectionResult.fMax[fc] = maxStress[fc].f;
+         sectionResult.MaxStressImpactDirection[fc] = (ImpactDirection)(maxStress[fc].CaseIdx/2);
+         sectionResult.MaxStressWindDirection[fc] = (WindDirection)(maxStress[fc].CaseIdx%2);
+         sectionResult.MaxStressCorner[fc] = maxStress[fc].corner;
+         sectionResult.fMin[fc] = minStress[fc].f;
+         sectionResult.MinStressImpactDirection[fc] = (ImpactDirection)(minStress[fc].CaseIdx/2);
+         sectionResult.MinStressWindDirection[fc] = (WindDirection)(minStress[fc].CaseIdx%2);
+         sectionResult.MinStressCorner[fc] = minStress[fc].corner;
+      }
+   }
 
-                  if (::IsLT(sectionResult.f[+impact][+wind][+corner], sectionResult.fMin[+face]))
-                  {
-                     sectionResult.fMin[+face] = sectionResult.f[+impact][+wind][+corner];
-                     sectionResult.MinStressImpactDirection[+face] = impact;
-                     sectionResult.MinStressWindDirection[+face] = wind;
-                     sectionResult.MinStressCorner[+face] = corner;
-                  }
+   StressExtreme maxStress{ results.MaxDirectStress, results.MaxDirectStressAnalysisPointIndex, (IndexType)results.MaxDirectStressImpactDirection, results.MaxDirectStressCorner };
+   StressExtreme minStress{ results.MinDirectStress, results.MinDirectStressAnalysisPointIndex, (IndexType)results.MinDirectStressImpactDirection, results.MinDirectStressCorner };
+   ReduceStresses(fDirect, nPoints, 0, nDirectCases, vbAllDirect, maxStress, minStress);
+   results.MaxDirectStress = maxStress.f;
+   results.MaxDirectStressAnalysisPointIndex = maxStress.PointIdx;
+   results.MaxDirectStressImpactDirection = (ImpactDirection)maxStress.CaseIdx;
+   results.MaxDirectStressCorner = maxStress.corner;
+   results.MinDirectStress = minStress.f;
+   results.MinDirectStressAnalysisPointIndex = minStress.PointIdx;
+   results.MinDirectStressImpactDirection = (ImpactDirection)minStress.CaseIdx;
+   results.MinDirectStressCorner = minStress.corner;
+
+   maxStress = { results.MaxStress, results.MaxStressAnalysisPointIndex, 2*(IndexType)results.MaxStressImpactDirection + (IndexType)results.MaxStressWindDirection, results.MaxStressCorner };
+   minStress = { results.MinStress, results.MinStressAnalysisPointIndex, 2*(IndexType)results.MinStressImpactDirection + (IndexType)results.MinStressWindDirection, results.MinStressCorner };
+   ReduceStresses(fTotal, nPoints, 0, nCases, vbStable, maxStress, minStress);
+   results.MaxStress = maxStress.f;
+   results.MaxStressAnalysisPointIndex = maxStress.PointIdx;
+   results.MaxStressImpactDirection = (ImpactDirection)(maxStress.CaseIdx/2);
+   results.MaxStressWindDirection = (WindDirection)(maxStress.CaseIdx%2);
+   results.MaxStressCorner = maxStress.corner;
+   results.MinStress = minStress.f;
+   results.MinStressAnalysisPointIndex = minStress.PointIdx;
+   results.MinStressImpactDirection = (ImpactDirection)(minStress.CaseIdx/2);
+   results.MinStressWindDirection = (WindDirection)(minStress.CaseIdx%2);
+   results.MinStressCorner = minStress.corner;
+
+   // evaluate cracking at each analysis point
+   for (IndexType pointIdx = 0; pointIdx < nPoints; pointIdx++)
+   {
+      auto& sectionResult = results.vSectionResults[pointIdx];
+      const auto& [Ixx, Ixy, D, pntStress, shape, rebarSection] = vSections[pointIdx];
 
-                  if (::IsLT(results.MaxStress, sectionResult.f[+impact][+wind][+corner]))
-                  {
-                     results.MaxStress = sectionResult.f[+impact][+wind][+corner];
-                     results.MaxStressAnalysisPointIndex = sectionResult.AnalysisPointIndex;
-                     results.MaxStressImpactDirection = impact;
-                     results.MaxStressWindDirection = wind;
-                     results.MaxStressCorner = corner;
-                  }
+      // copy the stresses into the section results
+      for (int i = 0; i < 3; i++)
+      {
+         std::copy_n(fDirect(pointIdx, i), 4, sectionResult.fDirect[i]);
+         for (int w = 0; w < 2; w++)
+         {
+            std::copy_n(fTilt(pointIdx, 2*i + w), 4, sectionResult.fTilt[i][w]);
+            std::copy_n(fTotal(pointIdx, 2*i + w), 4, sectionResult.f[i][w]);
+         }
+      }
 
-                  if (::IsLT(sectionResult.f[+impact][+wind][+corner], results.MinStress))
-                  {
-                     results.MinStress = sectionResult.f[+impact][+wind][+corner];
-                     results.MinStressAnalysisPointIndex = sectionResult.AnalysisPointIndex;
-                     results.MinStressImpactDirection = impact;
-                     results.MinStressWindDirection = wind;
-                     results.MinStressCorner = corner;
-                  }
+      for ( IndexType i = 0; i < 3; i++ )
+      {
+         ImpactDirection impact = (ImpactDirection)i;
+
+         for (IndexType c = 0; c < 4; c++)
+         {
+            Corner corner = (Corner)c;
+
+            for (IndexType w = 0; w < 2; w++)
+            {
+               WindDirection wind = (WindDirection)w;
+               if (results.bIsStable[+impact][+wind])
+               {
+                  Float64 windSign = (wind == WindDirection::Left ? 1 : -1);
 
                   // compute cracking moment and cracking factor of safety
                   Float64 mcr = 0; // if the direct stress exceeded the modulus of rupture, the beam is cracked before it is tilted
@@ -596,7 +1135,7 @@ void StabilityEngineer::AnalyzeLifting(const IGirder* pGirder,const ILiftingStab
                      }
                   }
 
-                  Float64 m = IM[+impact] * sectionResult.Mg - Plift*results.Zo[+impact];
+                  Float64 m = IM[+impact] * sectionResult.Mg - vPlift[pointIdx]*results.Zo[+impact];
 
                   Float64 theta_crack = (IsZero(m) ? ::BinarySign(results.ThetaEq[+impact][+wind])*THETA_MAX : mcr / m);
 
@@ -731,9 +1270,6 @@ void StabilityEngineer::AnalyzeLifting(const IGirder* pGirder,const ILiftingStab
 #endif // REBAR_FOR_DIRECT_TENSION
          } // if segment
       } // next impact
-
-      results.vSectionResults.push_back(sectionResult);
-      poiID++;
    } // next analysis point
 
    // calculate the factor of safety against failure for all combinations of impact and wind
@@ -928,8 +1464,6 @@ void StabilityEngineer::AnalyzeOneEndSeated(const IGirder * pGirder, const IOneE
       }
    }
 
-   PoiIDType poiID = 0;
-   CComQIPtr<IFem2dModelResults> femResults(model);
    const auto& vAnalysisPoints = pStabilityProblem->GetAnalysisPoints();
    IndexType analysisPointIdx = 0;
    for (const auto& pAnalysisPoint : vAnalysisPoints)
@@ -959,21 +1493,9 @@ void StabilityEngineer::AnalyzeOneEndSeated(const IGirder * pGirder, const IOneE
       }
 
       // Get forces from external loads
-      Float64 fx, fy, mz;
-      femResults->ComputePOIForces(LCID_GIRDER, poiID, mftLeft, lotMember, &fx, &fy, &mz);
-      CHECK(IsZero(fx));
-      mz = IsZero(mz) ? 0 : mz;
-      sectionResult.Mg = mz;
-
-      femResults->ComputePOIForces(LCID_WIND, poiID, mftLeft, lotMember, &fx, &fy, &mz);
-      CHECK(IsZero(fx));
-      mz = IsZero(mz) ? 0 : mz;
-      sectionResult.Mw = mz;
-
-      femResults->ComputePOIForces(LCID_CF, poiID, mftLeft, lotMember, &fx, &fy, &mz);
-      CHECK(IsZero(fx));
-      mz = IsZero(mz) ? 0 : mz;
-      sectionResult.Mcf = mz;
+      sectionResult.Mg = m_UnitLoadResults.Mg[sectionResult.AnalysisPointIndex];
+      sectionResult.Mw = m_UnitLoadResults.Mw[sectionResult.AnalysisPointIndex];
+      sectionResult.Mcf = m_UnitLoadResults.Mcf[sectionResult.AnalysisPointIndex];
 
       Float64 Hg, Ag, Ixx, Iyy, Ixy, Xleft, Ytop, Wbf, Wtf;
       pGirder->GetSectionProperties(X, &Ag, &Ixx, &Iyy, &Ixy, &Xleft, &Ytop, &Hg, &Wtf, &Wbf);
@@ -1248,7 +1770,6 @@ void StabilityEngineer::AnalyzeOneEndSeated(const IGirder * pGirder, const IOneE
       } // next impact
 
       results.vSectionResults.push_back(sectionResult);
-      poiID++;
    } // next analysis point
 
    // calculate the factor of safety against failure and roll over for all combinations of impact and wind
@@ -1486,17 +2007,23 @@ void StabilityEngineer::AnalyzeHauling(const IGirder* pGirder,const IHaulingStab
       } // next impact
    } // next slope
 
-   PoiIDType poiID = 0;
-   CComQIPtr<IFem2dModelResults> femResults(model);
+   // Stresses are computed for all analysis points in three steps. First, the section properties and the stresses due to
+   // unit loads are computed at each analysis point. Second, the direct, tilt, and total stresses for all load cases are computed
+   // by superposition in passes over contiguous stress arrays, and the extreme stresses are found by reductions over those arrays.
+   // Last, cracking is evaluated at each analysis point.
    const auto& vAnalysisPoints = pStabilityProblem->GetAnalysisPoints();
-   IndexType analysisPointIdx = 0;
-   for( const auto& pAnalysisPoint : vAnalysisPoints)
+   IndexType nPoints = vAnalysisPoints.size();
+   StressArray fUnit(nPoints, nUnitStresses);
+   StressArray cTilt(nPoints, 1); // stress at each corner due to a unit lateral moment
+   std::vector<SectionData> vSections;
+   vSections.reserve(nPoints);
+   for (IndexType pointIdx = 0; pointIdx < nPoints; pointIdx++)
    {
-      Float64 X = pAnalysisPoint->GetLocation();
+      Float64 X = vAnalysisPoints[pointIdx]->GetLocation();
 
       HaulingSectionResult sectionResult;
 
-      sectionResult.AnalysisPointIndex = analysisPointIdx++;
+      sectionResult.AnalysisPointIndex = pointIdx;
 
       CComPtr<IRebarSection> rebarSection;
       CComPtr<IShape> shape;
@@ -1517,21 +2044,9 @@ void StabilityEngineer::AnalyzeHauling(const IGirder* pGirder,const IHaulingStab
       }
 
       // Get forces from external loads
-      Float64 fx,fy,mz;
-      femResults->ComputePOIForces(LCID_GIRDER,poiID,mftLeft,lotMember,&fx,&fy,&mz);
-      CHECK(IsZero(fx));
-      mz = IsZero(mz) ? 0 : mz;
-      sectionResult.Mg = mz;
-
-      femResults->ComputePOIForces(LCID_WIND,poiID,mftLeft,lotMember,&fx,&fy,&mz);
-      CHECK(IsZero(fx));
-      mz = IsZero(mz) ? 0 : mz;
-      sectionResult.Mw = mz;
-
-      femResults->ComputePOIForces(LCID_CF,poiID,mftLeft,lotMember,&fx,&fy,&mz);
-      CHECK(IsZero(fx));
-      mz = IsZero(mz) ? 0 : mz;
-      sectionResult.Mcf = mz;
+      sectionResult.Mg = m_UnitLoadResults.Mg[sectionResult.AnalysisPointIndex];
+      sectionResult.Mw = m_UnitLoadResults.Mw[sectionResult.AnalysisPointIndex];
+      sectionResult.Mcf = m_UnitLoadResults.Mcf[sectionResult.AnalysisPointIndex];
 
       Float64 Hg,Ag,Ixx,Iyy,Ixy,Xleft,Ytop,Wbf,Wtf;
       pGirder->GetSectionProperties(X,&Ag,&Ixx,&Iyy,&Ixy,&Xleft,&Ytop,&Hg,&Wtf,&Wbf);
@@ -1581,6 +2096,189 @@ void StabilityEngineer::AnalyzeHauling(const IGirder* pGirder,const IHaulingStab
          sectionResult.fcf[+corner] = ((MyCF*Ixx + MxCF*Ixy)*pntStress[+corner].X() - (MxCF*Iyy + MyCF*Ixy)*pntStress[+corner].Y()) / D;
       } // next corner
 
+      // gather the unit stresses and tilt stress coefficients for the vectorized passes below
+      std::copy(sectionResult.fps.begin(), sectionResult.fps.end(), fUnit(pointIdx, UnitPrestress));
+      std::copy(sectionResult.fg.begin(), sectionResult.fg.end(), fUnit(pointIdx, UnitGirder));
+      std::copy(sectionResult.fw.begin(), sectionResult.fw.end(), fUnit(pointIdx, UnitWind));
+      std::copy(sectionResult.fcf.begin(), sectionResult.fcf.end(), fUnit(pointIdx, UnitCF));
+      Float64* c = cTilt(pointIdx, 0);
+      for (int cn = 0; cn < 4; cn++)
+      {
+         c[cn] = (Ixx*pntStress[cn].X() - Ixy*pntStress[cn].Y()) / D;
+      }
+
+      vSections.push_back({ Ixx, Ixy, D, pntStress, shape, rebarSection });
+      results.vSectionResults.push_back(sectionResult);
+   } // next analysis point
+
+   // Load cases are indexed as [HaulingSlope][ImpactDirection] for direct stresses and [HaulingSlope][ImpactDirection][WindDirection] for total stresses
+   constexpr IndexType nDirectCases = 3; // per slope
+   constexpr IndexType nCases = 6; // per slope
+   std::array<Float64, 2*nDirectCases> imFactor;
+   std::array<Float64, 2*nCases> windFactor, cfFactor, tiltFactor;
+   std::vector<bool> vbStable(2*nCases);
+   for (int s = 0; s < 2; s++)
+   {
+      HaulingSlope slope = (HaulingSlope)s;
+      for (int i = 0; i < 3; i++)
+      {
+         ImpactDirection impact = (ImpactDirection)i;
+         IndexType directCaseIdx = s*nDirectCases + i;
+         imFactor[directCaseIdx] = 1.0;
+         if (impactUsage == HaulingImpact::Both ||
+            (impactUsage == HaulingImpact::NormalCrown && slope == HaulingSlope::CrownSlope) ||
+            (impactUsage == HaulingImpact::MaxSuper && slope == HaulingSlope::Superelevation)
+            )
+         {
+            imFactor[directCaseIdx] = IM[+impact];
+         }
+
+         for (int w = 0; w < 2; w++)
+         {
+            WindDirection wind = (WindDirection)w;
+            IndexType caseIdx = s*nCases + 2*i + w;
+            vbStable[caseIdx] = results.bRotationalStability[+slope][+impact][+wind];
+            windFactor[caseIdx] = (wind == WindDirection::Left ? 1 : -1);
+            cfFactor[caseIdx] = (slope == HaulingSlope::Superelevation ? cfSign : 0);
+
+            // the sign of ThetaEq will take care of the girder rolling to the right.
+            // the tilt stress coefficients assume tilt to the left so flip the sign if the girder is assumed to tilt to the right
+            tiltFactor[caseIdx] = -1 * imFactor[directCaseIdx] * results.ThetaEq[+slope][+impact][+wind] * (results.AssumedTiltDirection == GirderSide::Right ? -1 : 1);
+         }
+      }
+   }
+
+   // compute stresses by superposition of unit load stresses
+   StressArray fDirect(nPoints, 2*nDirectCases);
+   StressArray fTilt(nPoints, 2*nCases);
+   StressArray fTotal(nPoints, 2*nCases);
+   for (IndexType pointIdx = 0; pointIdx < nPoints; pointIdx++)
+   {
+      const Float64* fps = fUnit(pointIdx, UnitPrestress);
+      const Float64* fg = fUnit(pointIdx, UnitGirder);
+      const Float64* fw = fUnit(pointIdx, UnitWind);
+      const Float64* fcf = fUnit(pointIdx, UnitCF);
+      const Float64* c = cTilt(pointIdx, 0);
+      Float64 Mg = results.vSectionResults[pointIdx].Mg;
+
+      // stress due to direct loads (plumb girder)
+      for (IndexType directCaseIdx = 0; directCaseIdx < 2*nDirectCases; directCaseIdx++)
+      {
+         Float64* fd = fDirect(pointIdx, directCaseIdx);
+         for (int cn = 0; cn < 4; cn++)
+         {
+            fd[cn] = fps[cn] + imFactor[directCaseIdx]*fg[cn];
+         }
+      }
+
+      for (IndexType caseIdx = 0; caseIdx < 2*nCases; caseIdx++)
+      {
+         if (!vbStable[caseIdx]) continue;
+
+         // stress due to lateral loads caused by the girder being tilted and total stress
+         const Float64* fd = fDirect(pointIdx, caseIdx/2);
+         Float64* ft = fTilt(pointIdx, caseIdx);
+         Float64* ftotal = fTotal(pointIdx, caseIdx);
+         Float64 My = tiltFactor[caseIdx]*Mg;
+         for (int cn = 0; cn < 4; cn++)
+         {
+            ft[cn] = My*c[cn];
+            ftotal[cn] = fd[cn] + ft[cn] + windFactor[caseIdx]*fw[cn] - cfFactor[caseIdx]*fcf[cn];
+         }
+      }
+   }
+
+   // find the extreme stresses
+   std::vector<bool> vbAllDirect(nDirectCases, true);
+   for (int s = 0; s < 2; s++)
+   {
+      HaulingSlope slope = (HaulingSlope)s;
+      std::vector<bool> vbStableSlope(vbStable.begin() + s*nCases, vbStable.begin() + (s + 1)*nCases);
+
+      for (IndexType pointIdx = 0; pointIdx < nPoints; pointIdx++)
+      {
+         auto& sectionResult = results.vSectionResults[pointIdx];
+
+         std::array<StressExtreme, 2> maxStress, minStress;
+         for (int fc = 0; fc < 2; fc++)
+         {
+            maxStress[fc] = { sectionResult.fMaxDirect[+slope][fc], pointIdx, (IndexType)sectionResult.MaxDirectStressImpactDirection[+slope][fc], sectionResult.MaxDirectStressCorner[+slope][fc] };
+            minStress[fc] = { sectionResult.fMinDirect[+slope][fc], pointIdx, (IndexType)sectionResult.MinDirectStressImpactDirection[+slope][fc], sectionResult.MinDirectStressCorner[+slope][fc] };
+         }
+         ReduceFaceStresses(fDirect, pointIdx, s*nDirectCases, nDirectCases, vbAllDirect, maxStress, minStress);
+         for (int fc = 0; fc < 2; fc++)
+         {
+            sectionResult.fMaxDirect[+slope][fc] = maxStress[fc].f;
+            sectionResult.MaxDirectStressImpactDirection[+slope][fc] = (ImpactDirection)maxStress[fc].CaseIdx;
+            sectionResult.MaxDirectStressCorner[+slope][fc] = maxStress[fc].corner;
+            sectionResult.fMinDirect[+slope][fc] = minStress[fc].f;
+            sectionResult.MinDirectStressImpactDirection[+slope][fc] = (ImpactDirection)minStress[fc].CaseIdx;
+            sectionResult.MinDirectStressCorner[+slope][fc] = minStress[fc].corner;
+
+            maxStress[fc] = { sectionResult.fMax[+slope][fc], pointIdx, 2*(IndexType)sectionResult.MaxStressImpactDirection[+slope][fc] + (IndexType)sectionResult.MaxStressWindDirection[+slope][fc], sectionResult.MaxStressCorner[+slope][fc] };
+            minStress[fc] = { sectionResult.fMin[+slope][fc], pointIdx, 2*(IndexType)sectionResult.MinStressImpactDirection[+slope][fc] + (IndexType)sectionResult.MinStressWindDirection[+slope][fc], sectionResult.MinStressCorner[+slope][fc] };
+         }
+         ReduceFaceStresses(fTotal, pointIdx, s*nCases, nCases, vbStableSlope, maxStress, minStress);
+         for (int fc = 0; fc < 2; fc++)
+         {
+            sectionResult.fMax[+slope][fc] = maxStress[fc].f;
+            sectionResult.MaxStressImpactDirection[+slope][fc] = (ImpactDirection)(maxStress[fc].CaseIdx/2);
+            sectionResult.MaxStressWindDirection[+slope][fc] = (WindDirection)(maxStress[fc].CaseIdx%2);
+            sectionResult.MaxStressCorner[+slope][fc] = maxStress[fc].corner;
+            sectionResult.fMin[+slope][fc] = minStress[fc].f;
+            sectionResult.MinStressImpactDirection[+slope][fc] = (ImpactDirection)(minStress[fc].CaseIdx/2);
+            sectionResult.MinStressWindDirection[+slope][fc] = (WindDirection)(minStress[fc].CaseIdx%2);
+            sectionResult.MinStressCorner[+slope][fc] = minStress[fc].corner;
+         }
+      }
+
+      StressExtreme maxStress{ results.MaxDirectStress[+slope], results.MaxDirectStressAnalysisPointIndex[+slope], (IndexType)results.MaxDirectStressImpactDirection[+slope], results.MaxDirectStressCorner[+slope] };
+      StressExtreme minStress{ results.MinDirectStress[+slope], results.MinDirectStressAnalysisPointIndex[+slope], (IndexType)results.MinDirectStressImpactDirection[+slope], results.MinDirectStressCorner[+slope] };
+      ReduceStresses(fDirect, nPoints, s*nDirectCases, nDirectCases, vbAllDirect, maxStress, minStress);
+      results.MaxDirectStress[+slope] = maxStress.f;
+      results.MaxDirectStressAnalysisPointIndex[+slope] = maxStress.PointIdx;
+      results.MaxDirectStressImpactDirection[+slope] = (ImpactDirection)maxStress.CaseIdx;
+      results.MaxDirectStressCorner[+slope] = maxStress.corner;
+      results.MinDirectStress[+slope] = minStress.f;
+      results.MinDirectStressAnalysisPointIndex[+slope] = minStress.PointIdx;
+      results.MinDirectStressImpactDirection[+slope] = (ImpactDirection)minStress.CaseIdx;
+      results.MinDirectStressCorner[+slope] = minStress.corner;
+
+      maxStress = { results.MaxStress[+slope], results.MaxStressAnalysisPointIndex[+slope], 2*(IndexType)results.MaxStressImpactDirection[+slope] + (IndexType)results.MaxStressWindDirection[+slope], results.MaxStressCorner[+slope] };
+      minStress = { results.MinStress[+slope], results.MinStressAnalysisPointIndex[+slope], 2*(IndexType)results.MinStressImpactDirection[+slope] + (IndexType)results.MinStressWindDirection[+slope], results.MinStressCorner[+slope] };
+      ReduceStresses(fTotal, nPoints, s*nCases, nCases, vbStableSlope, maxStress, minStress);
+      results.MaxStress[+slope] = maxStress.f;
+      results.MaxStressAnalysisPointIndex[+slope] = maxStress.PointIdx;
+      results.MaxStressImpactDirection[+slope] = (ImpactDirection)(maxStress.CaseIdx/2);
+      results.MaxStressWindDirection[+slope] = (WindDirection)(maxStress.CaseIdx%2);
+      results.MaxStressCorner[+slope] = maxStress.corner;
+      results.MinStress[+slope] = minStress.f;
+      results.MinStressAnalysisPointIndex[+slope] = minStress.PointIdx;
+      results.MinStressImpactDirection[+slope] = (ImpactDirection)(minStress.CaseIdx/2);
+      results.MinStressWindDirection[+slope] = (WindDirection)(minStress.CaseIdx%2);
+      results.MinStressCorner[+slope] = minStress.corner;
+   }
+
+   // evaluate cracking at each analysis point
+   for (IndexType pointIdx = 0; pointIdx < nPoints; pointIdx++)
+   {
+      auto& sectionResult = results.vSectionResults[pointIdx];
+      const auto& [Ixx, Ixy, D, pntStress, shape, rebarSection] = vSections[pointIdx];
+
+      // copy the stresses into the section results
+      for (int s = 0; s < 2; s++)
+      {
+         for (int i = 0; i < 3; i++)
+         {
+            std::copy_n(fDirect(pointIdx, s*nDirectCases + i), 4, sectionResult.fDirect[s][i]);
+            for (int w = 0; w < 2; w++)
+            {
+               std::copy_n(fTilt(pointIdx, s*nCases + 2*i + w), 4, sectionResult.fTilt[s][i][w]);
+               std::copy_n(fTotal(pointIdx, s*nCases + 2*i + w), 4, sectionResult.f[s][i][w]);
+            }
+         }
+      }
+
       for (int s = 0; s < 2; s++)
       {
          HaulingSlope slope = (HaulingSlope)s;
@@ -1589,61 +2287,12 @@ void StabilityEngineer::AnalyzeHauling(const IGirder* pGirder,const IHaulingStab
          {
             ImpactDirection impact = (ImpactDirection)i;
       
-            Float64 im = 1.0;
-            if (impactUsage == HaulingImpact::Both ||
-               (impactUsage == HaulingImpact::NormalCrown && slope == HaulingSlope::CrownSlope) ||
-               (impactUsage == HaulingImpact::MaxSuper    && slope == HaulingSlope::Superelevation)
-               )
-            {
-               im = IM[+impact];
-            }
+            Float64 im = imFactor[s*nDirectCases + i];
 
             for (int cn = 0; cn < 4; cn++)
             {
                Corner corner = (Corner)cn;
 
-               GirderFace face = GetFace(corner);
-               Float64 b = (face == GirderFace::Top ? Wtf : Wbf);
-
-               Float64 cornerSign = (corner == Corner::TopLeft || corner == Corner::BottomLeft ? 1 : -1);
-
-               // stress due to direct loads (plumb girder)
-               sectionResult.fDirect[+slope][+impact][+corner] = sectionResult.fps[+corner] + im*sectionResult.fg[+corner];
-
-               // keep track of the max direct stress at this section including the corner where it occurs
-               if (::IsLT(sectionResult.fMaxDirect[+slope][+face], sectionResult.fDirect[+slope][+impact][+corner]))
-               {
-                  sectionResult.fMaxDirect[+slope][+face] = sectionResult.fDirect[+slope][+impact][+corner];
-                  sectionResult.MaxDirectStressImpactDirection[+slope][+face] = impact;
-                  sectionResult.MaxDirectStressCorner[+slope][+face] = corner;
-               }
-
-               // keep track of the min direct stress at this section including the corner where it occurs
-               if (::IsLT(sectionResult.fDirect[+slope][+impact][+corner], sectionResult.fMinDirect[+slope][+face]))
-               {
-                  sectionResult.fMinDirect[+slope][+face] = sectionResult.fDirect[+slope][+impact][+corner];
-                  sectionResult.MinDirectStressImpactDirection[+slope][+face] = impact;
-                  sectionResult.MinDirectStressCorner[+slope][+face] = corner;
-               }
-
-               // keep track of the max direct stress of ALL sections including the corner where it occurs
-               if (::IsLT(results.MaxDirectStress[+slope], sectionResult.fDirect[+slope][+impact][+corner]))
-               {
-                  results.MaxDirectStress[+slope] = sectionResult.fDirect[+slope][+impact][+corner];
-                  results.MaxDirectStressAnalysisPointIndex[+slope] = sectionResult.AnalysisPointIndex;
-                  results.MaxDirectStressImpactDirection[+slope] = impact;
-                  results.MaxDirectStressCorner[+slope] = corner;
-               }
-
-               // keep track of the min direct stress of ALL sections including the corner where it occurs
-               if (::IsLT(sectionResult.fDirect[+slope][+impact][+corner], results.MinDirectStress[+slope]))
-               {
-                  results.MinDirectStress[+slope] = sectionResult.fDirect[+slope][+impact][+corner];
-                  results.MinDirectStressAnalysisPointIndex[+slope] = sectionResult.AnalysisPointIndex;
-                  results.MinDirectStressImpactDirection[+slope] = impact;
-                  results.MinDirectStressCorner[+slope] = corner;
-               }
-
                for ( int w = 0; w < 2; w++ )
                {
                   WindDirection wind = (WindDirection)w;
@@ -1662,63 +2311,6 @@ void StabilityEngineer::AnalyzeHauling(const IGirder* pGirder,const IHaulingStab
 
                      Float64 ei = results.EccLateralSweep[+impact];
 
-                     // stress due to lateral loads caused by the girder being tilted
-                     //Float64 Mx = 0;
-                     Float64 My = -1 * im * sectionResult.Mg*results.ThetaEq[+slope][+impact][+wind]; // this sign of ThetaEq will take care of the girder rolling to the right
-                     Float64 f = ((My*Ixx/* + Mx*Ixy*/)*pntStress[+corner].X() - (/*Mx*Iyy + */My*Ixy)*pntStress[+corner].Y()) / D;
-                     if (results.AssumedTiltDirection == GirderSide::Right)
-                     {
-                        // girder is tilted to the right so flip the sign
-                        // f is computed assuming tilt to the left
-                        f *= -1;
-                     }
-                     sectionResult.fTilt[+slope][+impact][+wind][+corner] = f;
-
-                     // total stress
-                     sectionResult.f[+slope][+impact][+wind][+corner] = sectionResult.fDirect[+slope][+impact][+corner] + sectionResult.fTilt[+slope][+impact][+wind][+corner] + windSign*sectionResult.fw[+corner];
-                     if (slope == HaulingSlope::Superelevation)
-                     {
-                        sectionResult.f[+slope][+impact][+wind][+corner] -= cfSign*sectionResult.fcf[+corner];
-                     }
-
-                     // keep track of max stress at this section including the corner where it occurs
-                     if (::IsLT(sectionResult.fMax[+slope][+face], sectionResult.f[+slope][+impact][+wind][+corner]))
-                     {
-                        sectionResult.fMax[+slope][+face] = sectionResult.f[+slope][+impact][+wind][+corner];
-                        sectionResult.MaxStressImpactDirection[+slope][+face] = impact;
-                        sectionResult.MaxStressWindDirection[+slope][+face] = wind;
-                        sectionResult.MaxStressCorner[+slope][+face] = corner;
-                     }
-
-                     // keep track of min stress at this section including the corner where it occurs
-                     if (::IsLT(sectionResult.f[+slope][+impact][+wind][+corner], sectionResult.fMin[+slope][+face]))
-                     {
-                        sectionResult.fMin[+slope][+face] = sectionResult.f[+slope][+impact][+wind][+corner];
-                        sectionResult.MinStressImpactDirection[+slope][+face] = impact;
-                        sectionResult.MinStressWindDirection[+slope][+face] = wind;
-                        sectionResult.MinStressCorner[+slope][+face] = corner;
-                     }
-
-                     // keep track of max stress of ALL sections including the corner where it occurs
-                     if (::IsLT(results.MaxStress[+slope], sectionResult.f[+slope][+impact][+wind][+corner]))
-                     {
-                        results.MaxStressAnalysisPointIndex[+slope] = sectionResult.AnalysisPointIndex;
-                        results.MaxStress[+slope] = sectionResult.f[+slope][+impact][+wind][+corner];
-                        results.MaxStressImpactDirection[+slope] = impact;
-                        results.MaxStressWindDirection[+slope] = wind;
-                        results.MaxStressCorner[+slope] = corner;
-                     }
-
-                     // keep track of min stress of ALL sections including the corner where it occurs
-                     if (::IsLT(sectionResult.f[+slope][+impact][+wind][+corner], results.MinStress[+slope]))
-                     {
-                        results.MinStressAnalysisPointIndex[+slope] = sectionResult.AnalysisPointIndex;
-                        results.MinStress[+slope] = sectionResult.f[+slope][+impact][+wind][+corner];
-                        results.MinStressImpactDirection[+slope] = impact;
-                        results.MinStressWindDirection[+slope] = wind;
-                        results.MinStressCorner[+slope] = corner;
-                     }
-
                      // compute cracking moment and cracking factor of safety
                      Float64 mcr = 0; // if the direct stress exceeds the modulus of rupture, the beam is cracked before it is tilted...
                      Float64 fscr = 0; // ... and the FScr is 0.
@@ -1832,9 +2424,6 @@ void StabilityEngineer::AnalyzeHauling(const IGirder* pGirder,const IHaulingStab
             } // if segment
          } // next impact
       } // next slope
-
-      results.vSectionResults.push_back(sectionResult);
-      poiID++;
    } // next analysis point
 
    // calculate the factor of safety against failure and roll over for all combinations of impact and wind
@@ -2608,6 +3197,56 @@ void StabilityEngineer::BuildModel(const IGirder* pGirder,const IStabilityProble
    results.Rr = Rright;
 }
 
+void StabilityEngineer::ExtractUnitLoadResults(const IStabilityProblem* pStabilityProblem,IFem2dModel* pModel,Results& results) const
+{
+   // The girder stiffness is the same for every impact, wind, and centrifugal force case. The FEM model
+   // factors the stiffness matrix once and solves all of the unit loadings against it. Here we pull all of the
+   // unit load results out of the model in one pass. The analysis cases are then formed by scaling and superimposing
+   // these results, rather than by going back to the FEM model for every analysis point and load case.
+   CComQIPtr<IFem2dModelResults> femResults(pModel);
+
+   // Centrifugal force only acts on girders during hauling (and when one end is seated on the truck),
+   // the lifting analysis doesn't use it
+   bool bCF = (dynamic_cast<const ILiftingStabilityProblem*>(pStabilityProblem) == nullptr);
+
+   IndexType nAnalysisPoints = pStabilityProblem->GetAnalysisPoints().size();
+   m_UnitLoadResults.Mg.resize(nAnalysisPoints);
+   m_UnitLoadResults.Mw.resize(nAnalysisPoints);
+   m_UnitLoadResults.Mcf.resize(bCF ? nAnalysisPoints : 0);
+
+   // there is a 1 to 1 mapping between analysis points and poi IDs
+   std::array<LoadCaseIDType, 3> lcid{ LCID_GIRDER, LCID_WIND, LCID_CF };
+   std::array<std::vector<Float64>*, 3> vMoments{ &m_UnitLoadResults.Mg, &m_UnitLoadResults.Mw, &m_UnitLoadResults.Mcf };
+   IndexType nLoadCases = (bCF ? lcid.size() : lcid.size() - 1);
+   for (IndexType lc = 0; lc < nLoadCases; lc++)
+   {
+      std::vector<Float64>& vM(*vMoments[lc]);
+      for (IndexType poiIdx = 0; poiIdx < nAnalysisPoints; poiIdx++)
+      {
+         Float64 fx, fy, mz;
+         femResults->ComputePOIForces(lcid[lc], (PoiIDType)poiIdx, mftLeft, lotMember, &fx, &fy, &mz);
+         CHECK(IsZero(fx));
+         vM[poiIdx] = IsZero(mz) ? 0 : mz;
+      }
+   }
+
+   m_UnitLoadResults.Dy.clear();
+   if (results.ZoMethod == CalculationMethod::Approximate)
+   {
+      // POI for computing Zo are numbered in descending order starting with m_FirstPoi
+      IndexType nPoi = m_vPoi.size();
+      m_UnitLoadResults.Dy.resize(nPoi);
+      PoiIDType poiID = m_FirstPoi;
+      for (IndexType i = 0; i < nPoi; i++, poiID--)
+      {
+         Float64 dx, dy, rz;
+         femResults->ComputePOIDeflections(LCID_GIRDER, poiID, lotMember, &dx, &dy, &rz);
+         m_UnitLoadResults.Dy[i] = dy;
+      }
+      CHECK(poiID + 1 == m_LastPoi);
+   }
+}
+
 Float64 StabilityEngineer::ComputeXcg(const IGirder* pGirder, const IStabilityProblem* pStabilityProblem, Results& results) const
 {
    // Location of CG with respect to the roll axis, assuming the roll axis is at the middle of the girder (Wtop/2)
@@ -2731,23 +3370,19 @@ Float64 StabilityEngineer::ComputeZo(const IGirder* pGirder,const IStabilityProb
    else
    {
       CHECK(m_FirstPoi - m_LastPoi + 1 == m_vPoi.size());
-      CComQIPtr<IFem2dModelResults> femResults(pModel);
+      CHECK(m_UnitLoadResults.Dy.size() == m_vPoi.size());
       Float64 g = WBFL::Units::System::GetGravitationalAcceleration();
 
       const auto& concrete = pStabilityProblem->GetConcrete();
       Float64 density = concrete.GetDensityForWeight();
       Float64 unitWeight = density*g;
 
-      PoiIDType poiID1 = m_FirstPoi;
-      PoiIDType poiID2 = m_FirstPoi-1;
-      std::vector<Float64>::const_iterator iter1(m_vPoi.begin());
-      std::vector<Float64>::const_iterator iter2 = iter1+1;
-      std::vector<Float64>::const_iterator end(m_vPoi.end());
+      IndexType nPoi = m_vPoi.size();
       Zo = 0;
-      for ( ; iter2 != end; iter1++, iter2++, poiID1--, poiID2-- )
+      for ( IndexType i = 1; i < nPoi; i++ )
       {
-         Float64 x1 = *iter1;
-         Float64 x2 = *iter2;
+         Float64 x1 = m_vPoi[i-1];
+         Float64 x2 = m_vPoi[i];
 
          Float64 Ag1,Ixx1,Iyy1,Ixy1,Xleft,Ytop,Hg,Wtop,Wbot;
          Float64 Ag2,Ixx2,Iyy2,Ixy2;
@@ -2758,9 +3393,8 @@ Float64 StabilityEngineer::ComputeZo(const IGirder* pGirder,const IStabilityProb
          Float64 w2 = Ag2*unitWeight;
 
          // this is vertical deflection based on Ix...
-         Float64 dx,dy1,dy2,rz;
-         femResults->ComputePOIDeflections(LCID_GIRDER,poiID1,lotMember,&dx,&dy1,&rz);
-         femResults->ComputePOIDeflections(LCID_GIRDER,poiID2,lotMember,&dx,&dy2,&rz);
+         Float64 dy1 = m_UnitLoadResults.Dy[i-1];
+         Float64 dy2 = m_UnitLoadResults.Dy[i];
 
          // we want lateral deflection based on Iy...
          dy1 *= Ixx1/Iyy1;
@@ -2770,8 +3404,6 @@ Float64 StabilityEngineer::ComputeZo(const IGirder* pGirder,const IStabilityProb
          Zo += zo;
       }
 
-      CHECK(poiID1 == m_LastPoi);
-
       Float64 Wg = results.Wg;
       Zo /= -Wg;
    }
@@ -136,5 +136,118 @@ namespace StabilityUnitTest
             }
          }
       }
+
+      TEST_METHOD(CheckHaulingBatch)
+      {
+         // Example 6.2.1 girder checked on two bunk point locations for three criteria variants
+         Girder girder;
+         Float64 Hg = WBFL::Units::ConvertToSysUnits(72, WBFL::Units::Measure::Inch);
+         Float64 Wtf = WBFL::Units::ConvertToSysUnits(42, WBFL::Units::Measure::Inch);
+         Float64 Wbf = WBFL::Units::ConvertToSysUnits(26, WBFL::Units::Measure::Inch);
+         Float64 Ag = WBFL::Units::ConvertToSysUnits(767, WBFL::Units::Measure::Inch2);
+         Float64 Ix = WBFL::Units::ConvertToSysUnits(545894, WBFL::Units::Measure::Inch4);
+         Float64 Iy = WBFL::Units::ConvertToSysUnits(37634, WBFL::Units::Measure::Inch4);
+         Float64 Xleft = Wtf / 2;
+         Float64 Ytop = WBFL::Units::ConvertToSysUnits(36.6 - 72, WBFL::Units::Measure::Inch);
+         Float64 L = WBFL::Units::ConvertToSysUnits(136, WBFL::Units::Measure::Feet);
+         girder.AddSection(L, Ag, Ix, Iy, 0.0, Xleft, Ytop, Hg, Wtf, Wbf);
+
+         WBFL::Materials::SimpleConcrete concrete;
+         Float64 fc = 7.0;
+         concrete.SetFc(WBFL::Units::ConvertToSysUnits(fc, WBFL::Units::Measure::KSI));
+         concrete.SetDensity(WBFL::Units::ConvertToSysUnits(0.150, WBFL::Units::Measure::KipPerFeet3));
+         concrete.SetDensityForWeight(WBFL::Units::ConvertToSysUnits(0.155, WBFL::Units::Measure::KipPerFeet3));
+         concrete.SetE(WBFL::LRFD::ConcreteUtil::ModE(concrete.GetType(), concrete.GetFc(), concrete.GetDensity(), false));
+         concrete.SetFlexureFr(WBFL::Units::ConvertToSysUnits(0.24 * sqrt(fc), WBFL::Units::Measure::KSI));
+
+         std::array<HaulingStabilityProblem, 2> problems;
+         std::array<Float64, 2> bunkPoints{ WBFL::Units::ConvertToSysUnits(10, WBFL::Units::Measure::Feet), WBFL::Units::ConvertToSysUnits(14, WBFL::Units::Measure::Feet) };
+         std::vector<HaulingCheckItem> vItems;
+         for (IndexType i = 0; i < 2; i++)
+         {
+            auto& stabilityProblem = problems[i];
+            stabilityProblem.SetConcrete(concrete);
+            stabilityProblem.AddAnalysisPoint(std::move(std::make_unique<AnalysisPoint>(0.4 * L)));
+            stabilityProblem.AddAnalysisPoint(std::move(std::make_unique<AnalysisPoint>(0.5 * L)));
+            stabilityProblem.AddFpe(_T("Prestress"), 0.0, WBFL::Units::ConvertToSysUnits(1251.5, WBFL::Units::Measure::Kip), Xleft, -Hg + WBFL::Units::ConvertToSysUnits(7.91, WBFL::Units::Measure::Inch));
+            stabilityProblem.SetCamber(WBFL::Units::ConvertToSysUnits(2.92, WBFL::Units::Measure::Inch));
+            stabilityProblem.SetSupportLocations(bunkPoints[i], bunkPoints[i]);
+            stabilityProblem.SetSweepTolerance(2 * 0.000520833333);
+            stabilityProblem.SetSweepGrowth(WBFL::Units::ConvertToSysUnits(1.0, WBFL::Units::Measure::Inch));
+            stabilityProblem.SetSupportPlacementTolerance(WBFL::Units::ConvertToSysUnits(1.0, WBFL::Units::Measure::Inch));
+            stabilityProblem.SetYRollAxis(WBFL::Units::ConvertToSysUnits(-48.0, WBFL::Units::Measure::Inch) - Hg);
+            stabilityProblem.SetImpact(0.0, 0.0);
+            stabilityProblem.SetImpactUsage(HaulingImpact::Both);
+            stabilityProblem.SetRotationalStiffness(WBFL::Units::ConvertToSysUnits(40500., WBFL::Units::Measure::KipInchPerRadian));
+            stabilityProblem.SetSupportSlope(0.06);
+            stabilityProblem.SetSuperelevation(0.06);
+            stabilityProblem.SetSupportWidth(WBFL::Units::ConvertToSysUnits(72., WBFL::Units::Measure::Inch));
+            stabilityProblem.SetHeightOfRollAxis(WBFL::Units::ConvertToSysUnits(24., WBFL::Units::Measure::Inch));
+
+            vItems.push_back({ &girder, &stabilityProblem });
+         }
+
+         HaulingCriteria criteria;
+         criteria.MinFScr = 1.0;
+         criteria.MinFSf = 1.5;
+         criteria.CompressionCoefficient_GlobalStress = 0.6;
+         criteria.CompressionCoefficient_PeakStress = 0.7;
+         criteria.AllowableCompression_GlobalStress = -0.6 * concrete.GetFc();
+         criteria.AllowableCompression_PeakStress = -0.7 * concrete.GetFc();
+         auto pTensionStressLimit = std::make_shared<CCHaulingTensionStressLimit>();
+         pTensionStressLimit->AllowableTension = { WBFL::Units::ConvertToSysUnits(0.6, WBFL::Units::Measure::KSI), WBFL::Units::ConvertToSysUnits(0.6, WBFL::Units::Measure::KSI) };
+         pTensionStressLimit->AllowableTensionWithRebar = pTensionStressLimit->AllowableTension;
+         criteria.TensionStressLimit = pTensionStressLimit;
+         criteria.MaxClearSpan = L;
+         criteria.MaxLeadingOverhang = L;
+         criteria.MaxGirderWeight = Float64_Max;
+
+         std::vector<HaulingCriteriaVariant> vVariants(3);
+         vVariants[0].Criteria = criteria;
+         vVariants[1].Criteria = criteria;
+         vVariants[1].Criteria.MinFScr = 10.0; // cracking check can't pass
+         vVariants[2].Criteria = criteria;
+         vVariants[2].RotationalStiffness = WBFL::Units::ConvertToSysUnits(81000., WBFL::Units::Measure::KipInchPerRadian);
+
+         StabilityEngineer engineer;
+         auto vRecords = engineer.CheckHauling(vItems, vVariants);
+         Assert::AreEqual((size_t)6, vRecords.size());
+
+         for (IndexType itemIdx = 0; itemIdx < 2; itemIdx++)
+         {
+            for (IndexType variantIdx = 0; variantIdx < 3; variantIdx++)
+            {
+               const auto& record = vRecords[itemIdx * 3 + variantIdx];
+               Assert::AreEqual(itemIdx, record.ItemIndex);
+               Assert::AreEqual(variantIdx, record.VariantIndex);
+               Assert::IsTrue(record.Artifact == nullptr);
+
+               // each record matches an individual check
+               auto& stabilityProblem = problems[itemIdx];
+               Float64 Ktheta = stabilityProblem.GetRotationalStiffness();
+               stabilityProblem.SetRotationalStiffness(vVariants[variantIdx].RotationalStiffness.value_or(Ktheta));
+               auto artifact = engineer.CheckHauling(&girder, &stabilityProblem, vVariants[variantIdx].Criteria);
+               stabilityProblem.SetRotationalStiffness(Ktheta);
+
+               const auto& results = artifact.GetHaulingResults();
+               Assert::AreEqual(artifact.Passed(true), record.bPassed);
+               Assert::IsTrue(::IsEqual(record.MinFScr, Min(results.MinFScr[+HaulingSlope::CrownSlope], results.MinFScr[+HaulingSlope::Superelevation])));
+               Assert::IsTrue(::IsEqual(record.MinFsFailure, Min(results.MinAdjFsFailure[+HaulingSlope::CrownSlope], results.MinAdjFsFailure[+HaulingSlope::Superelevation])));
+               Assert::IsTrue(::IsEqual(record.MinFsRollover, Min(results.MinFsRollover[+HaulingSlope::CrownSlope], results.MinFsRollover[+HaulingSlope::Superelevation])));
+            }
+
+            Assert::IsFalse(vRecords[itemIdx * 3 + 1].bPassed);
+            Assert::IsTrue(::IsEqual(vRecords[itemIdx * 3].MinFScr, vRecords[itemIdx * 3 + 1].MinFScr)); // same truck, same analysis
+            Assert::IsFalse(::IsEqual(vRecords[itemIdx * 3].MinFsRollover, vRecords[itemIdx * 3 + 2].MinFsRollover)); // stiffer truck, separate analysis
+         }
+
+         // detailed artifacts on request
+         vRecords = engineer.CheckHauling(vItems, vVariants, true);
+         for (const auto& record : vRecords)
+         {
+            Assert::IsTrue(record.Artifact != nullptr);
+            Assert::AreEqual(record.Artifact->Passed(true), record.bPassed);
+         }
+      }
 	};
 }
@@ -160,5 +160,86 @@ namespace StabilityUnitTest
             }
          }
       }
+
+      TEST_METHOD(SweepLifting)
+      {
+         // Example 6.1.1 girder with the lifting points swept from 5 ft to 25 ft
+         Girder girder;
+         Float64 Hg = WBFL::Units::ConvertToSysUnits(72, WBFL::Units::Measure::Inch);
+         Float64 Wtf = WBFL::Units::ConvertToSysUnits(42, WBFL::Units::Measure::Inch);
+         Float64 Wbf = WBFL::Units::ConvertToSysUnits(26, WBFL::Units::Measure::Inch);
+         Float64 Ag = WBFL::Units::ConvertToSysUnits(767, WBFL::Units::Measure::Inch2);
+         Float64 Ix = WBFL::Units::ConvertToSysUnits(545894, WBFL::Units::Measure::Inch4);
+         Float64 Iy = WBFL::Units::ConvertToSysUnits(37634, WBFL::Units::Measure::Inch4);
+         Float64 Xleft = Wtf / 2;
+         Float64 Ytop = WBFL::Units::ConvertToSysUnits(36.6 - 72, WBFL::Units::Measure::Inch);
+         Float64 L = WBFL::Units::ConvertToSysUnits(136, WBFL::Units::Measure::Feet);
+         girder.AddSection(L, Ag, Ix, Iy, 0.0, Xleft, Ytop, Hg, Wtf, Wbf);
+
+         WBFL::Materials::SimpleConcrete concrete;
+         Float64 fci = 5.5;
+         concrete.SetFc(WBFL::Units::ConvertToSysUnits(fci, WBFL::Units::Measure::KSI));
+         concrete.SetDensity(WBFL::Units::ConvertToSysUnits(0.150, WBFL::Units::Measure::KipPerFeet3));
+         concrete.SetDensityForWeight(WBFL::Units::ConvertToSysUnits(0.155, WBFL::Units::Measure::KipPerFeet3));
+         concrete.SetE(WBFL::LRFD::ConcreteUtil::ModE(concrete.GetType(), concrete.GetFc(), concrete.GetDensity(), false));
+         concrete.SetFlexureFr(WBFL::Units::ConvertToSysUnits(0.24 * sqrt(fci), WBFL::Units::Measure::KSI));
+
+         LiftingStabilityProblem stabilityProblem;
+         stabilityProblem.SetConcrete(concrete);
+         stabilityProblem.AddAnalysisPoint(std::move(std::make_unique<AnalysisPoint>(0.4 * L)));
+         stabilityProblem.AddAnalysisPoint(std::move(std::make_unique<AnalysisPoint>(0.5 * L)));
+         stabilityProblem.AddFpe(_T("Prestress"), 0.0, WBFL::Units::ConvertToSysUnits(1232.0, WBFL::Units::Measure::Kip), Xleft, -Hg + WBFL::Units::ConvertToSysUnits(5.0, WBFL::Units::Measure::Inch));
+         stabilityProblem.SetCamber(WBFL::Units::ConvertToSysUnits(2.92, WBFL::Units::Measure::Inch));
+         stabilityProblem.SetSupportLocations(WBFL::Units::ConvertToSysUnits(9, WBFL::Units::Measure::Feet), WBFL::Units::ConvertToSysUnits(9, WBFL::Units::Measure::Feet));
+         stabilityProblem.SetSweepTolerance(0.000520833333);
+         stabilityProblem.SetSupportPlacementTolerance(WBFL::Units::ConvertToSysUnits(0.25, WBFL::Units::Measure::Inch));
+         stabilityProblem.SetLiftAngle(PI_OVER_2);
+         stabilityProblem.SetImpact(0.0, 0.0);
+
+         SupportLocationSweep sweep;
+         sweep.Start = WBFL::Units::ConvertToSysUnits(5, WBFL::Units::Measure::Feet);
+         sweep.End = WBFL::Units::ConvertToSysUnits(25, WBFL::Units::Measure::Feet);
+         sweep.nLocations = 5;
+
+         StabilityEngineer engineer;
+         auto sweep_results = engineer.SweepLifting(&girder, &stabilityProblem, sweep);
+         Assert::AreEqual((size_t)5, sweep_results.FS.size());
+         Assert::IsTrue(5 < sweep_results.nEvaluations);
+
+         // the stability problem is not changed
+         Float64 Ll, Lr;
+         stabilityProblem.GetSupportLocations(&Ll, &Lr);
+         Assert::IsTrue(::IsEqual(Ll, WBFL::Units::ConvertToSysUnits(9, WBFL::Units::Measure::Feet)));
+
+         // The analysis points of the stability problem don't include the swept support locations. The sweep analyzes
+         // each support location with analysis points at the supports so each point on the curve matches an individual
+         // analysis of a stability problem that has analysis points at the supports
+         auto analyze = [&](Float64 location)
+         {
+            LiftingStabilityProblem problem(stabilityProblem);
+            problem.AddAnalysisPoint(std::move(std::make_unique<AnalysisPoint>(location)));
+            problem.AddAnalysisPoint(std::move(std::make_unique<AnalysisPoint>(L - location)));
+            problem.SetSupportLocations(location, location);
+            return engineer.AnalyzeLifting(&girder, &problem);
+         };
+
+         for (const auto& [location, fs] : sweep_results.FS)
+         {
+            auto results = analyze(location);
+            Assert::IsTrue(::IsEqual(fs, Min(results.FScrMin, results.MinAdjFsFailure)));
+            Assert::IsTrue(fs <= sweep_results.OptimumFS);
+         }
+
+         auto results = analyze(sweep_results.OptimumLocation);
+         Assert::IsTrue(::IsEqual(sweep_results.OptimumFS, Min(results.FScrMin, results.MinAdjFsFailure)));
+
+         // Without analysis points at the supports, the cracking factor of safety is computed from the wrong sections
+         for (const auto& [location, fs] : sweep_results.FS)
+         {
+            stabilityProblem.SetSupportLocations(location, location);
+            auto original_results = engineer.AnalyzeLifting(&girder, &stabilityProblem);
+            Assert::IsTrue(analyze(location).FScrMin <= original_results.FScrMin);
+         }
+      }
 	};
 }
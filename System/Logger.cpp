@@ -28,6 +28,11 @@
 #include <atlconv.h>
 #include <ctime>
 #include <iomanip>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 // Implementation note: There are dual versions of the logging functions based on character/string type
 // This is because most of our system uses unicode strings but exceptions (what() method) only have
@@ -35,9 +40,9 @@
 
 using namespace WBFL::System;
 
-std::ostream* Logger::log = nullptr;
-Logger::Severity Logger::verbosity = Logger::Severity::Info;
-Logger::Severity Logger::max_severity = Logger::Severity::Info;
+std::atomic<std::ostream*> Logger::log = nullptr;
+std::atomic<Logger::Severity> Logger::verbosity = Logger::Severity::Info;
+std::atomic<Logger::Severity> Logger::max_severity = Logger::Severity::Info;
 
 const std::array<std::string, 4> severity_strings{ "Debug", "Info", "Warning", "Error"};
 
@@ -46,26 +51,241 @@ constexpr auto operator+(Logger::Severity type) noexcept
    return std::underlying_type<Logger::Severity>::type(type);
 }
 
-std::string get_time()
+namespace
 {
-   std::ostringstream os;
-   time_t now = time(nullptr);
-   os << std::put_time(localtime(&now), "%F %T");
-   return os.str();
+   // Serializes writing to the output stream
+   std::mutex gs_OutputMutex;
+
+   // Total number of messages dropped because the asynchronous queue was full
+   std::atomic<Uint64> gs_nDropped = 0;
+
+   // Formatting the time with put_time is expensive compared to everything else that
+   // goes into writing a message. Most messages are written within the same second as the
+   // previous message so the text is cached. Must be called while gs_OutputMutex is locked.
+   const std::string& get_time(time_t now)
+   {
+      static time_t last_time = -1;
+      static std::string last_text;
+      if (now != last_time)
+      {
+         std::ostringstream os;
+         os << std::put_time(localtime(&now), "%F %T");
+         last_text = os.str();
+         last_time = now;
+      }
+      return last_text;
+   }
+
+   void plain_text_message(std::ostream& out, Logger::Severity type, time_t time, const std::string& message)
+   {
+      out << "[" << severity_strings[+type] << "] ";
+      out << "[" << get_time(time) << "] ";
+      out << message << "\n";
+   }
+
+   struct LogEntry
+   {
+      Logger::Severity type = Logger::Severity::Info;
+      time_t time = 0;
+      std::string message;
+   };
+
+   // Bounded, lock-free, multi-producer message queue. Each cell has a sequence number that
+   // tells producers and the consumer if the cell is ready to be written or read.
+   // See https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+   class MessageQueue
+   {
+   public:
+      MessageQueue(IndexType capacity)
+      {
+         IndexType size = 2;
+         while (size < capacity) size <<= 1;
+
+         m_Cells = std::make_unique<Cell[]>(size);
+         for (IndexType i = 0; i < size; i++) m_Cells[i].sequence.store(i, std::memory_order_relaxed);
+         m_Mask = size - 1;
+      }
+
+      bool Push(LogEntry&& entry)
+      {
+         IndexType pos = m_PushPos.load(std::memory_order_relaxed);
+         while (true)
+         {
+            Cell& cell = m_Cells[pos & m_Mask];
+            IndexType sequence = cell.sequence.load(std::memory_order_acquire);
+            auto diff = (std::make_signed_t<IndexType>)(sequence - pos);
+            if (diff == 0)
+            {
+               if (m_PushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+               {
+                  cell.entry = std::move(entry);
+                  cell.sequence.store(pos + 1, std::memory_order_release);
+                  return true;
+               }
+            }
+            else if (diff < 0)
+            {
+               return false; // queue is full
+            }
+            else
+            {
+               pos = m_PushPos.load(std::memory_order_relaxed);
+            }
+         }
+      }
+
+      // Only called by the writer thread
+      bool Pop(LogEntry& entry)
+      {
+         Cell& cell = m_Cells[m_PopPos & m_Mask];
+         IndexType sequence = cell.sequence.load(std::memory_order_acquire);
+         if (sequence != m_PopPos + 1) return false; // queue is empty
+
+         entry = std::move(cell.entry);
+         cell.sequence.store(m_PopPos + m_Mask + 1, std::memory_order_release);
+         m_PopPos++;
+         return true;
+      }
+
+   private:
+      struct Cell
+      {
+         std::atomic<IndexType> sequence;
+         LogEntry entry;
+      };
+      std::unique_ptr<Cell[]> m_Cells;
+      IndexType m_Mask = 0;
+      alignas(64) std::atomic<IndexType> m_PushPos = 0;
+      alignas(64) IndexType m_PopPos = 0;
+   };
+
+   // Writes queued messages on a background thread. Messages are written in batches
+   // and the output stream is flushed once per batch.
+   class AsyncWriter
+   {
+   public:
+      AsyncWriter(IndexType capacity) : m_Queue(capacity)
+      {
+         m_Thread = std::thread([this] {Run(); });
+      }
+
+      ~AsyncWriter()
+      {
+         {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_bStop = true;
+         }
+         m_cvWork.notify_one();
+         m_Thread.join();
+      }
+
+      void Push(Logger::Severity type, std::string&& message)
+      {
+         if (m_Queue.Push({ type, time(nullptr), std::move(message) }))
+         {
+            m_nPushed.fetch_add(1, std::memory_order_release);
+
+            // Producers don't take the mutex so this notification can be missed while the writer is
+            // going to sleep. The writer wakes up periodically so the message is written a little later.
+            m_cvWork.notify_one();
+         }
+         else
+         {
+            m_nUnreported.fetch_add(1, std::memory_order_relaxed);
+            gs_nDropped.fetch_add(1, std::memory_order_relaxed);
+         }
+      }
+
+      void Flush()
+      {
+         std::unique_lock<std::mutex> lock(m_Mutex);
+         Uint64 target = m_nPushed.load(std::memory_order_acquire);
+         m_cvWork.notify_one();
+         m_cvWritten.wait(lock, [this, target] {return target <= m_nWritten; });
+      }
+
+   private:
+      MessageQueue m_Queue;
+      std::thread m_Thread;
+      std::mutex m_Mutex;
+      std::condition_variable m_cvWork;
+      std::condition_variable m_cvWritten;
+      bool m_bStop = false;
+      std::atomic<Uint64> m_nPushed = 0;
+      Uint64 m_nWritten = 0; // guarded by m_Mutex
+      std::atomic<Uint64> m_nUnreported = 0;
+
+      void Run()
+      {
+         std::vector<LogEntry> batch;
+         while (true)
+         {
+            bool bStop;
+            {
+               std::unique_lock<std::mutex> lock(m_Mutex);
+               m_cvWork.wait_for(lock, std::chrono::milliseconds(100), [this] {return m_bStop || m_nWritten < m_nPushed.load(std::memory_order_acquire) || 0 < m_nUnreported.load(std::memory_order_relaxed); });
+               bStop = m_bStop;
+            }
+
+            LogEntry entry;
+            while (m_Queue.Pop(entry))
+            {
+               batch.emplace_back(std::move(entry));
+            }
+            Uint64 nDropped = m_nUnreported.exchange(0, std::memory_order_relaxed);
+
+            if (!batch.empty() || 0 < nDropped)
+            {
+               std::lock_guard<std::mutex> output_lock(gs_OutputMutex);
+               std::ostream* log = Logger::GetOutput();
+               if (log != nullptr)
+               {
+                  for (const auto& e : batch)
+                  {
+                     plain_text_message(*log, e.type, e.time, e.message);
+                  }
+
+                  if (0 < nDropped)
+                  {
+                     std::ostringstream os;
+                     os << nDropped << " log messages were dropped";
+                     plain_text_message(*log, Logger::Severity::Warning, time(nullptr), os.str());
+                  }
+
+                  log->flush();
+               }
+            }
+
+            {
+               std::lock_guard<std::mutex> lock(m_Mutex);
+               m_nWritten += batch.size();
+            }
+            m_cvWritten.notify_all();
+            batch.clear();
+
+            if (bStop && m_nPushed.load(std::memory_order_acquire) <= m_nWritten)
+            {
+               break;
+            }
+         }
+      }
+   };
+
+   // The writer is not destroyed during static destruction because its thread can't be joined
+   // while the DLL is unloading. Call Logger::EnableAsync(false) before exiting.
+   AsyncWriter* gs_pAsyncWriter = nullptr;
 }
 
-void plain_text_message(std::ostream& out, Logger::Severity type, const std::string& message)
+std::ostream* Logger::SetOutput(std::ostream* stream1)
 {
-   out << "[" << severity_strings[+type] << "] ";
-   out << "[" << get_time().c_str() << "] ";
-   out << message.c_str() << std::endl;
+   Flush();
+   std::lock_guard<std::mutex> lock(gs_OutputMutex);
+   return log.exchange(stream1);
 }
 
-std::ostream* Logger::SetOutput(std::ostream* stream1)
+std::ostream* Logger::GetOutput()
 {
-   std::ostream* old = log;
-   log = stream1;
-   return old;
+   return log;
 }
 
 void Logger::Verbosity(Severity v)
@@ -83,35 +303,96 @@ Logger::Severity Logger::MaxVerbosity()
    return max_severity;
 }
 
-void Logger::Message(Logger::Severity type, const std::wstring& message)
+void Logger::EnableAsync(bool bAsync, IndexType queueSize)
 {
-   if (type < verbosity) 
+   if (bAsync == IsAsync())
    {
-      // skip lower level messages
       return;
    }
 
-   if (max_severity < type) {
-      max_severity = type;
+   if (bAsync)
+   {
+      gs_pAsyncWriter = new AsyncWriter(queueSize);
+   }
+   else
+   {
+      delete gs_pAsyncWriter; // writes all remaining messages
+      gs_pAsyncWriter = nullptr;
+   }
+}
+
+bool Logger::IsAsync()
+{
+   return gs_pAsyncWriter != nullptr;
+}
+
+void Logger::Flush()
+{
+   if (gs_pAsyncWriter)
+   {
+      gs_pAsyncWriter->Flush();
    }
 
+   std::lock_guard<std::mutex> lock(gs_OutputMutex);
    if (log != nullptr)
    {
-      USES_CONVERSION;
-      plain_text_message(*log, type, T2A(message.c_str()));
+      log.load()->flush();
    }
 }
 
-void Logger::Message(Logger::Severity type, const std::string& message)
+Uint64 Logger::GetDroppedMessageCount()
+{
+   return gs_nDropped;
+}
+
+bool Logger::Accept(Logger::Severity type)
+{
+   if (!IsLogged(type))
+   {
+      // skip lower level messages
+      return false;
+   }
+
+   Severity severity = max_severity.load(std::memory_order_relaxed);
+   while (severity < type && !max_severity.compare_exchange_weak(severity, type, std::memory_order_relaxed));
+
+   return log.load(std::memory_order_relaxed) != nullptr;
+}
+
+void Logger::Write(Logger::Severity type, std::string&& message)
+{
+   if (gs_pAsyncWriter)
+   {
+      gs_pAsyncWriter->Push(type, std::move(message));
+   }
+   else
+   {
+      std::lock_guard<std::mutex> lock(gs_OutputMutex);
+      std::ostream* out = log;
+      if (out != nullptr)
+      {
+         plain_text_message(*out, type, time(nullptr), message);
+         out->flush();
+      }
+   }
+}
+
+void Logger::Message(Logger::Severity type, const std::wstring& message)
 {
-   if (type < verbosity) {
+   if (!Accept(type))
+   {
       return;
    }
 
-   if (max_severity < type) {
-      max_severity = type;
+   USES_CONVERSION;
+   Write(type, T2A(message.c_str()));
+}
+
+void Logger::Message(Logger::Severity type, const std::string& message)
+{
+   if (!Accept(type)) {
+      return;
    }
 
-   if (log != nullptr)
-      plain_text_message(*log, type, message);
+   Write(type, std::string(message));
 }
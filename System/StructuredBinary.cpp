@@ -0,0 +1,941 @@
+///////////////////////////////////////////////////////////////////////
+// System - WBFL low level system services
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#include <System\SysExp.h>
+#include <System\Checks.h>
+#include <System\XStructuredLoad.h>
+#include <System\XStructuredSave.h>
+#include "StructuredBinary.h"
+#include "StructuredText.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace WBFL::System;
+using namespace WBFL::System::StructuredBinary;
+
+namespace
+{
+   constexpr std::array<char, 6> Signature{ 'W','B','F','L','S','B' };
+   constexpr Uint8 FormatVersion = 1;
+   constexpr Uint8 Compressed = 0x01; // header flag
+
+   // Payload is buffered and compressed in blocks of this size. All match
+   // distances in a block are less than the block size.
+   constexpr std::size_t BlockSize = 64 * 1024;
+
+   // Block compression is a byte oriented LZ77 scheme. A compressed block is a sequence of
+   // varint(literal count), literals, varint(match length - MinMatch), varint(match distance)
+   // commands. The last command has literals only.
+   constexpr std::size_t MinMatch = 4;
+   constexpr int HashBits = 14;
+
+   void PutVarint(std::string& buffer, Uint64 value)
+   {
+      while (0x80 <= value)
+      {
+         buffer.push_back((char)(value | 0x80));
+         value >>= 7;
+      }
+      buffer.push_back((char)value);
+   }
+
+   bool GetVarint(const char*& pBegin, const char* pEnd, Uint64* pValue)
+   {
+      Uint64 value = 0;
+      for (int shift = 0; pBegin < pEnd && shift < 64; shift += 7)
+      {
+         Uint8 byte = (Uint8)(*pBegin++);
+         value |= (Uint64)(byte & 0x7F) << shift;
+         if ((byte & 0x80) == 0)
+         {
+            *pValue = value;
+            return true;
+         }
+      }
+      return false;
+   }
+
+   void Compress(const char* pSource, std::size_t size, std::string& compressed, std::vector<Uint32>& table)
+   {
+      table.assign((std::size_t)1 << HashBits, Uint32_Max);
+      compressed.clear();
+
+      std::size_t anchor = 0; // start of pending literals
+      std::size_t i = 0;
+      while (i + MinMatch <= size)
+      {
+         Uint32 sequence;
+         std::memcpy(&sequence, pSource + i, sizeof(sequence));
+         Uint32 hash = (sequence * 2654435761u) >> (32 - HashBits);
+         Uint32 candidate = table[hash];
+         table[hash] = (Uint32)i;
+
+         if (candidate != Uint32_Max && std::memcmp(pSource + candidate, pSource + i, MinMatch) == 0)
+         {
+            std::size_t length = MinMatch;
+            while (i + length < size && pSource[candidate + length] == pSource[i + length])
+               length++;
+
+            PutVarint(compressed, i - anchor);
+            compressed.append(pSource + anchor, i - anchor);
+            PutVarint(compressed, length - MinMatch);
+            PutVarint(compressed, i - candidate);
+
+            i += length;
+            anchor = i;
+         }
+         else
+         {
+            i++;
+         }
+      }
+
+      PutVarint(compressed, size - anchor);
+      compressed.append(pSource + anchor, size - anchor);
+   }
+
+   bool Decompress(const char* pBegin, const char* pEnd, char* pDestination, std::size_t size)
+   {
+      std::size_t nBytes = 0;
+      while (true)
+      {
+         Uint64 nLiterals;
+         if (!GetVarint(pBegin, pEnd, &nLiterals) || (Uint64)(pEnd - pBegin) < nLiterals || size - nBytes < nLiterals)
+            return false;
+
+         std::memcpy(pDestination + nBytes, pBegin, (std::size_t)nLiterals);
+         pBegin += nLiterals;
+         nBytes += (std::size_t)nLiterals;
+         if (nBytes == size)
+            return pBegin == pEnd;
+
+         Uint64 length, distance;
+         if (!GetVarint(pBegin, pEnd, &length) || !GetVarint(pBegin, pEnd, &distance))
+            return false;
+
+         length += MinMatch;
+         if (distance == 0 || nBytes < distance || size - nBytes < length)
+            return false;
+
+         // byte by byte because the match can overlap the bytes being written
+         const char* pMatch = pDestination + nBytes - distance;
+         for (std::size_t j = 0; j < length; j++)
+            pDestination[nBytes + j] = pMatch[j];
+
+         nBytes += (std::size_t)length;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Writer
+////////////////////////////////////////////////////////////////////////////
+void Writer::Begin(std::ostream* pos, bool bCompress)
+{
+   PRECONDITION(pos != nullptr);
+   CHECK(m_pOS == nullptr); // previously used and not cleaned up?
+
+   m_pOS = pos;
+   m_bCompress = bCompress;
+   m_Buffer.clear();
+   m_Buffer.reserve(BlockSize + 1024);
+   m_Names.clear();
+
+   m_pOS->write(Signature.data(), Signature.size());
+   m_pOS->put((char)FormatVersion);
+   m_pOS->put((char)(bCompress ? Compressed : 0));
+   if (!m_pOS->good())
+      THROW(XStructuredSave, BadWrite);
+}
+
+void Writer::End()
+{
+   PRECONDITION(m_pOS != nullptr);
+   m_Buffer.push_back((char)Tag::EndOfData);
+   Flush();
+   if (m_bCompress)
+      m_pOS->put(0); // end of blocks
+
+   m_pOS->flush();
+   bool bGood = m_pOS->good();
+   m_pOS = nullptr;
+   m_Names.clear();
+   if (!bGood)
+      THROW(XStructuredSave, BadWrite);
+}
+
+void Writer::BeginUnit(const std::string& name, Float64 version)
+{
+   if (version == 0.0)
+   {
+      Name(Tag::BeginUnit, name);
+   }
+   else
+   {
+      Name(Tag::BeginVersionedUnit, name);
+      Uint64 bits = std::bit_cast<Uint64>(version);
+      for (int i = 0; i < 8; i++, bits >>= 8)
+         m_Buffer.push_back((char)(bits & 0xFF));
+   }
+}
+
+void Writer::EndUnit()
+{
+   m_Buffer.push_back((char)Tag::EndUnit);
+   if (BlockSize <= m_Buffer.size())
+      Flush();
+}
+
+void Writer::String(const std::string& name, std::string_view value)
+{
+   Name(Tag::String, name);
+   Varint(value.size());
+   m_Buffer.append(value);
+   if (BlockSize <= m_Buffer.size())
+      Flush();
+}
+
+void Writer::Real(const std::string& name, Float64 value)
+{
+   Name(Tag::Real, name);
+   Uint64 bits = std::bit_cast<Uint64>(value);
+   for (int i = 0; i < 8; i++, bits >>= 8)
+      m_Buffer.push_back((char)(bits & 0xFF));
+   if (BlockSize <= m_Buffer.size())
+      Flush();
+}
+
+void Writer::Integer(const std::string& name, Int64 value)
+{
+   Name(Tag::Integer, name);
+   Varint(((Uint64)value << 1) ^ (Uint64)(value >> 63)); // zig-zag so small negative numbers are short
+   if (BlockSize <= m_Buffer.size())
+      Flush();
+}
+
+void Writer::Unsigned(const std::string& name, Uint64 value)
+{
+   Name(Tag::Unsigned, name);
+   Varint(value);
+   if (BlockSize <= m_Buffer.size())
+      Flush();
+}
+
+void Writer::Bool(const std::string& name, bool value)
+{
+   Name(value ? Tag::True : Tag::False, name);
+   if (BlockSize <= m_Buffer.size())
+      Flush();
+}
+
+void Writer::Name(Tag tag, const std::string& name)
+{
+   auto found = m_Names.find(name);
+   if (found != m_Names.end())
+   {
+      m_Buffer.push_back((char)tag);
+      Varint(found->second);
+      return;
+   }
+
+   // same rule as the xml format, names become element names
+   if (name.empty() || std::any_of(name.begin(), name.end(), StructuredText::IsWhitespace))
+      THROW(XStructuredSave, BadWrite);
+
+   m_Names.emplace(name, m_Names.size() + 1);
+   m_Buffer.push_back((char)tag);
+   Varint(0);
+   Varint(name.size());
+   m_Buffer.append(name);
+}
+
+void Writer::Varint(Uint64 value)
+{
+   PutVarint(m_Buffer, value);
+}
+
+void Writer::Flush()
+{
+   if (m_bCompress)
+   {
+      // the buffer can run past the block size by the last record written
+      thread_local std::vector<Uint32> table;
+      for (std::size_t offset = 0; offset < m_Buffer.size(); offset += BlockSize)
+      {
+         const char* pBlock = m_Buffer.data() + offset;
+         std::size_t size = std::min(BlockSize, m_Buffer.size() - offset);
+         Compress(pBlock, size, m_Compressed, table);
+
+         // store the block as is if it didn't compress
+         bool bStored = size <= m_Compressed.size();
+         const char* pStored = bStored ? pBlock : m_Compressed.data();
+         std::size_t nStored = bStored ? size : m_Compressed.size();
+
+         std::string header;
+         PutVarint(header, size);
+         PutVarint(header, nStored);
+         m_pOS->write(header.data(), header.size());
+         m_pOS->write(pStored, nStored);
+      }
+   }
+   else
+   {
+      m_pOS->write(m_Buffer.data(), m_Buffer.size());
+   }
+
+   m_Buffer.clear();
+
+   if (!m_pOS->good())
+      THROW(XStructuredSave, BadWrite);
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Reader
+////////////////////////////////////////////////////////////////////////////
+void Reader::Begin(std::istream* pis)
+{
+   PRECONDITION(pis != nullptr);
+   CHECK(m_pIS == nullptr); // previously used and not cleaned up?
+
+   m_pIS = pis;
+
+   char header[Signature.size() + 2];
+   m_pIS->read(header, sizeof(header));
+   if (m_pIS->gcount() != sizeof(header) || !std::equal(Signature.begin(), Signature.end(), header))
+   {
+      m_pIS = nullptr;
+      THROW_LOAD(InvalidFileFormat, nullptr);
+   }
+
+   if (FormatVersion < (Uint8)header[Signature.size()])
+   {
+      m_pIS = nullptr;
+      THROW_LOAD(BadVersion, nullptr);
+   }
+
+   m_bCompressed = ((Uint8)header[Signature.size() + 1] & Compressed) != 0;
+   m_Buffer.resize(BlockSize);
+   m_Size = 0;
+   m_Offset = 0;
+   m_Block = m_pIS->tellg();
+   m_Names.clear();
+   m_TNames.clear();
+   m_NameCount = 0;
+}
+
+void Reader::End()
+{
+   m_pIS = nullptr;
+   m_Names.clear();
+   m_TNames.clear();
+   m_NameCount = 0;
+}
+
+void Reader::Read(Record* pRecord)
+{
+   pRecord->tag = (Tag)Byte();
+   pRecord->name = INVALID_INDEX;
+   switch (pRecord->tag)
+   {
+   case Tag::EndOfData:
+   case Tag::EndUnit:
+      break;
+
+   case Tag::BeginUnit:
+      pRecord->name = Name();
+      pRecord->real = 0.0;
+      break;
+
+   case Tag::BeginVersionedUnit:
+   case Tag::Real:
+      {
+         pRecord->name = Name();
+         Uint8 bytes[8];
+         Bytes((char*)bytes, sizeof(bytes));
+         Uint64 bits = 0;
+         for (int i = 7; 0 <= i; i--)
+            bits = (bits << 8) | bytes[i];
+         pRecord->real = std::bit_cast<Float64>(bits);
+      }
+      break;
+
+   case Tag::String:
+      {
+         pRecord->name = Name();
+         Uint64 length = Varint();
+         if (std::numeric_limits<Uint32>::max() < length)
+            THROW_LOAD(InvalidFileFormat, nullptr);
+         pRecord->text.resize((std::size_t)length);
+         Bytes(pRecord->text.data(), (std::size_t)length);
+      }
+      break;
+
+   case Tag::Integer:
+      {
+         pRecord->name = Name();
+         Uint64 value = Varint();
+         pRecord->integer = (Int64)(value >> 1) ^ -(Int64)(value & 1);
+      }
+      break;
+
+   case Tag::Unsigned:
+      pRecord->name = Name();
+      pRecord->unsigned_integer = Varint();
+      break;
+
+   case Tag::True:
+   case Tag::False:
+      pRecord->name = Name();
+      break;
+
+   default:
+      THROW_LOAD(InvalidFileFormat, nullptr);
+   }
+}
+
+Position Reader::GetPosition() const
+{
+   return Position{ m_Block, m_Offset, m_NameCount };
+}
+
+void Reader::SetPosition(const Position& position)
+{
+   PRECONDITION(m_pIS != nullptr);
+   m_pIS->clear();
+   if (m_bCompressed)
+   {
+      m_pIS->seekg(position.Block);
+      if (!ReadBlock())
+         THROW_LOAD(BadRead, nullptr);
+      m_Offset = position.Offset;
+   }
+   else
+   {
+      m_pIS->seekg(position.Block + (std::streamoff)position.Offset);
+      m_Block = position.Block + (std::streamoff)position.Offset;
+      m_Size = 0;
+      m_Offset = 0;
+   }
+
+   if (m_pIS->fail())
+      THROW_LOAD(BadRead, nullptr);
+
+   m_NameCount = position.NameCount;
+}
+
+Uint8 Reader::Byte()
+{
+   if (m_Offset == m_Size)
+      Fill();
+
+   return (Uint8)m_Buffer[m_Offset++];
+}
+
+void Reader::Bytes(char* pBytes, std::size_t count)
+{
+   while (0 < count)
+   {
+      if (m_Offset == m_Size)
+         Fill();
+
+      std::size_t n = std::min(count, m_Size - m_Offset);
+      std::memcpy(pBytes, m_Buffer.data() + m_Offset, n);
+      m_Offset += n;
+      pBytes += n;
+      count -= n;
+   }
+}
+
+Uint64 Reader::Varint()
+{
+   Uint64 value = 0;
+   for (int shift = 0; shift < 64; shift += 7)
+   {
+      Uint8 byte = Byte();
+      value |= (Uint64)(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0)
+         return value;
+   }
+
+   THROW_LOAD(InvalidFileFormat, nullptr);
+   return 0;
+}
+
+IndexType Reader::Name()
+{
+   Uint64 reference = Varint();
+   if (reference == 0)
+   {
+      Uint64 length = Varint();
+      if (std::numeric_limits<Uint16>::max() < length)
+         THROW_LOAD(InvalidFileFormat, nullptr);
+
+      std::string name((std::size_t)length, '\0');
+      Bytes(name.data(), name.size());
+
+      // names are defined again when a unit is read a second time with GetUnit
+      IndexType index = m_NameCount++;
+      if (index == m_Names.size())
+      {
+         m_TNames.emplace_back(StructuredText::FromUtf8(name));
+         m_Names.emplace_back(std::move(name));
+      }
+      return index;
+   }
+
+   if (m_NameCount < reference)
+      THROW_LOAD(InvalidFileFormat, nullptr);
+
+   return (IndexType)(reference - 1);
+}
+
+void Reader::Fill()
+{
+   if (m_bCompressed)
+   {
+      if (!ReadBlock())
+         THROW_LOAD(EndOfFile, nullptr);
+      m_Offset = 0;
+   }
+   else
+   {
+      m_Block += (std::streamoff)m_Size;
+      m_pIS->read(m_Buffer.data(), m_Buffer.size());
+      m_Size = (std::size_t)m_pIS->gcount();
+      m_Offset = 0;
+      if (m_Size == 0)
+         THROW_LOAD(EndOfFile, nullptr);
+   }
+}
+
+bool Reader::ReadBlock()
+{
+   m_Block = m_pIS->tellg();
+
+   auto read_varint = [this](Uint64* pValue)
+   {
+      Uint64 value = 0;
+      for (int shift = 0; shift < 64; shift += 7)
+      {
+         int byte = m_pIS->get();
+         if (byte == std::char_traits<char>::eof())
+            return false;
+         value |= (Uint64)(byte & 0x7F) << shift;
+         if ((byte & 0x80) == 0)
+         {
+            *pValue = value;
+            return true;
+         }
+      }
+      return false;
+   };
+
+   Uint64 size, stored;
+   if (!read_varint(&size) || size == 0)
+      return false;
+
+   if (!read_varint(&stored) || BlockSize < size || size < stored)
+      THROW_LOAD(InvalidFileFormat, nullptr);
+
+   m_Size = (std::size_t)size;
+   if (stored == size)
+   {
+      m_pIS->read(m_Buffer.data(), m_Size);
+      if (m_pIS->gcount() != (std::streamsize)m_Size)
+         THROW_LOAD(EndOfFile, nullptr);
+   }
+   else
+   {
+      m_Compressed.resize((std::size_t)stored);
+      m_pIS->read(m_Compressed.data(), m_Compressed.size());
+      if (m_pIS->gcount() != (std::streamsize)m_Compressed.size())
+         THROW_LOAD(EndOfFile, nullptr);
+
+      if (!Decompress(m_Compressed.data(), m_Compressed.data() + m_Compressed.size(), m_Buffer.data(), m_Size))
+         THROW_LOAD(InvalidFileFormat, nullptr);
+   }
+
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Property values
+////////////////////////////////////////////////////////////////////////////
+std::string StructuredBinary::GetText(const Record& record)
+{
+   switch (record.tag)
+   {
+   case Tag::String:   return record.text;
+   case Tag::Real:     return StructuredText::Format(record.real);
+   case Tag::Integer:  return StructuredText::Format(record.integer);
+   case Tag::Unsigned: return StructuredText::Format(record.unsigned_integer);
+   case Tag::True:     return "-1"; // same as a VARIANT_BOOL coerced to text
+   case Tag::False:    return "0";
+   default:            CHECK(false); return std::string();
+   }
+}
+
+bool StructuredBinary::GetReal(const Record& record, Float64* pValue)
+{
+   switch (record.tag)
+   {
+   case Tag::String:   return StructuredText::ToReal(record.text, pValue);
+   case Tag::Real:     *pValue = record.real; return true;
+   case Tag::Integer:  *pValue = (Float64)record.integer; return true;
+   case Tag::Unsigned: *pValue = (Float64)record.unsigned_integer; return true;
+   case Tag::True:     *pValue = -1.0; return true;
+   case Tag::False:    *pValue = 0.0; return true;
+   default:            return false;
+   }
+}
+
+bool StructuredBinary::GetInteger(const Record& record, Int64* pValue)
+{
+   switch (record.tag)
+   {
+   case Tag::String:   return StructuredText::ToInteger(record.text, pValue);
+
+   case Tag::Real:
+      if (!(-9.2233720368547758e18 <= record.real && record.real < 9.2233720368547758e18))
+         return false;
+      *pValue = std::llround(record.real);
+      return true;
+
+   case Tag::Integer:  *pValue = record.integer; return true;
+   case Tag::Unsigned:
+      if ((Uint64)std::numeric_limits<Int64>::max() < record.unsigned_integer)
+         return false;
+      *pValue = (Int64)record.unsigned_integer;
+      return true;
+
+   case Tag::True:     *pValue = -1; return true;
+   case Tag::False:    *pValue = 0; return true;
+   default:            return false;
+   }
+}
+
+bool StructuredBinary::GetUnsigned(const Record& record, Uint64* pValue)
+{
+   if (record.tag == Tag::Unsigned)
+   {
+      *pValue = record.unsigned_integer;
+      return true;
+   }
+
+   if (record.tag == Tag::String)
+      return StructuredText::ToUnsigned(record.text, pValue);
+
+   Int64 value;
+   if (!GetInteger(record, &value) || value < 0)
+      return false;
+
+   *pValue = (Uint64)value;
+   return true;
+}
+
+bool StructuredBinary::GetBool(const Record& record, bool* pValue)
+{
+   switch (record.tag)
+   {
+   case Tag::True:  *pValue = true; return true;
+   case Tag::False: *pValue = false; return true;
+   case Tag::String: return StructuredText::ToBool(record.text, pValue);
+   default:
+      {
+         Float64 value;
+         if (!GetReal(record, &value))
+            return false;
+         *pValue = (value != 0.0);
+         return true;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Xml
+////////////////////////////////////////////////////////////////////////////
+void StructuredBinary::WriteXml(Reader& reader, const Record& record, std::string& xml)
+{
+   PRECONDITION(IsUnit(record.tag) || IsProperty(record.tag));
+   std::string name(reader.GetName(record.name)); // copy, reading the content can grow the name table
+   xml.push_back('<');
+   xml.append(name);
+
+   if (IsUnit(record.tag))
+   {
+      if (record.real != 0.0)
+      {
+         xml.append(" version=\"");
+         xml.append(StructuredText::Format(record.real));
+         xml.push_back('"');
+      }
+
+      Record child;
+      reader.Read(&child);
+      if (child.tag == Tag::EndUnit)
+      {
+         xml.append("/>");
+         return;
+      }
+
+      xml.push_back('>');
+      while (child.tag != Tag::EndUnit)
+      {
+         if (child.tag == Tag::EndOfData)
+            THROW_LOAD(InvalidFileFormat, nullptr);
+
+         WriteXml(reader, child, xml);
+         reader.Read(&child);
+      }
+   }
+   else
+   {
+      std::string text(GetText(record));
+      if (text.empty())
+      {
+         xml.append("/>");
+         return;
+      }
+
+      if (record.tag == Tag::String)
+         StructuredText::EscapePropertyText(text);
+
+      xml.push_back('>');
+      xml.append(text);
+   }
+
+   xml.append("</");
+   xml.append(name);
+   xml.push_back('>');
+}
+
+namespace
+{
+   // Reads the subset of xml written by StructuredSaveXml. An element with a version
+   // attribute or child elements is a unit, otherwise it is a property.
+   class XmlParser
+   {
+   public:
+      XmlParser(std::string_view xml, Writer& writer) : m_Xml(xml), m_Writer(writer) {}
+
+      void Parse()
+      {
+         if (m_Xml.substr(0, 3) == "\xEF\xBB\xBF")
+            m_Pos = 3; // UTF-8 byte order mark
+
+         SkipMisc();
+         while (m_Pos < m_Xml.size())
+         {
+            ParseElement();
+            SkipMisc();
+         }
+      }
+
+   private:
+      std::string_view m_Xml;
+      Writer& m_Writer;
+      std::size_t m_Pos = 0;
+
+      bool StartsWith(std::string_view str) const
+      {
+         return m_Xml.substr(m_Pos, str.size()) == str;
+      }
+
+      void SkipPast(std::string_view terminator)
+      {
+         auto pos = m_Xml.find(terminator, m_Pos);
+         if (pos == std::string_view::npos)
+            THROW_LOAD(InvalidFileFormat, nullptr);
+         m_Pos = pos + terminator.size();
+      }
+
+      void SkipWhitespace()
+      {
+         while (m_Pos < m_Xml.size() && StructuredText::IsWhitespace(m_Xml[m_Pos]))
+            m_Pos++;
+      }
+
+      void SkipMisc()
+      {
+         while (true)
+         {
+            SkipWhitespace();
+            if (StartsWith("<?"))
+               SkipPast("?>");
+            else if (StartsWith("<!--"))
+               SkipPast("-->");
+            else if (StartsWith("<!"))
+               SkipPast(">");
+            else
+               break;
+         }
+      }
+
+      void Expect(char c)
+      {
+         if (m_Xml.size() <= m_Pos || m_Xml[m_Pos] != c)
+            THROW_LOAD(InvalidFileFormat, nullptr);
+         m_Pos++;
+      }
+
+      std::string_view ParseName()
+      {
+         std::size_t start = m_Pos;
+         while (m_Pos < m_Xml.size() && !StructuredText::IsWhitespace(m_Xml[m_Pos]) && m_Xml[m_Pos] != '/' && m_Xml[m_Pos] != '>' && m_Xml[m_Pos] != '=')
+            m_Pos++;
+
+         if (start == m_Pos)
+            THROW_LOAD(InvalidFileFormat, nullptr);
+
+         return m_Xml.substr(start, m_Pos - start);
+      }
+
+      void ParseElement()
+      {
+         Expect('<');
+         std::string name(ParseName());
+
+         Float64 version = 0.0;
+         bool bEmpty = false;
+         while (true)
+         {
+            SkipWhitespace();
+            if (StartsWith("/>"))
+            {
+               m_Pos += 2;
+               bEmpty = true;
+               break;
+            }
+            else if (StartsWith(">"))
+            {
+               m_Pos++;
+               break;
+            }
+
+            std::string_view attribute = ParseName();
+            SkipWhitespace();
+            Expect('=');
+            SkipWhitespace();
+            if (m_Xml.size() <= m_Pos || (m_Xml[m_Pos] != '"' && m_Xml[m_Pos] != '\''))
+               THROW_LOAD(InvalidFileFormat, nullptr);
+
+            char quote = m_Xml[m_Pos++];
+            auto end = m_Xml.find(quote, m_Pos);
+            if (end == std::string_view::npos)
+               THROW_LOAD(InvalidFileFormat, nullptr);
+
+            std::string value;
+            StructuredText::AppendXmlText(value, m_Xml.substr(m_Pos, end - m_Pos));
+            m_Pos = end + 1;
+
+            if (attribute == "version")
+            {
+               // the version attribute is formatted for the locale
+               std::replace(value.begin(), value.end(), ',', '.');
+               if (!StructuredText::ToReal(value, &version))
+                  THROW_LOAD(InvalidFileFormat, nullptr);
+            }
+         }
+
+         bool bUnit = false;
+         std::string text;
+         while (!bEmpty)
+         {
+            if (m_Xml.size() <= m_Pos)
+               THROW_LOAD(InvalidFileFormat, nullptr);
+
+            if (m_Xml[m_Pos] != '<')
+            {
+               auto end = m_Xml.find('<', m_Pos);
+               if (end == std::string_view::npos)
+                  THROW_LOAD(InvalidFileFormat, nullptr);
+               StructuredText::AppendXmlText(text, m_Xml.substr(m_Pos, end - m_Pos));
+               m_Pos = end;
+            }
+            else if (StartsWith("</"))
+            {
+               m_Pos += 2;
+               if (ParseName() != name)
+                  THROW_LOAD(InvalidFileFormat, nullptr);
+               SkipWhitespace();
+               Expect('>');
+               break;
+            }
+            else if (StartsWith("<!--"))
+            {
+               SkipPast("-->");
+            }
+            else if (StartsWith("<![CDATA["))
+            {
+               m_Pos += 9;
+               auto end = m_Xml.find("]]>", m_Pos);
+               if (end == std::string_view::npos)
+                  THROW_LOAD(InvalidFileFormat, nullptr);
+               text.append(m_Xml.substr(m_Pos, end - m_Pos));
+               m_Pos = end + 3;
+            }
+            else if (StartsWith("<?"))
+            {
+               SkipPast("?>");
+            }
+            else
+            {
+               if (!bUnit)
+               {
+                  m_Writer.BeginUnit(name, version);
+                  bUnit = true;
+               }
+               ParseElement();
+            }
+         }
+
+         if (bUnit || version != 0.0)
+         {
+            if (!bUnit)
+               m_Writer.BeginUnit(name, version);
+            m_Writer.EndUnit();
+         }
+         else
+         {
+            StructuredText::RestorePropertyText(text);
+            m_Writer.String(name, text);
+         }
+      }
+   };
+}
+
+void StructuredBinary::ReadXml(std::string_view xml, Writer& writer)
+{
+   XmlParser parser(xml, writer);
+   parser.Parse();
+}
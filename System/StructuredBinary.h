@@ -0,0 +1,177 @@
+///////////////////////////////////////////////////////////////////////
+// System - WBFL low level system services
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDED_STRUCTUREDBINARY_H_
+#define INCLUDED_STRUCTUREDBINARY_H_
+
+// Implementation details of the binary structured storage format shared by
+// StructuredSaveBinary, StructuredLoadBinary, and StructuredStorageConverter.
+// This header is private to the System library.
+//
+// Stream layout
+//    Header  - "WBFLSB", format version byte, flags byte
+//    Payload - sequence of records ending with an EndOfData record
+//
+// When the Compressed flag is set, the payload is broken into blocks. Each block
+// is written as varint(raw size), varint(stored size), stored bytes. A block whose
+// stored size equals its raw size is not compressed. A raw size of zero ends the payload.
+//
+// Records are a tag byte followed by a name reference (except for EndUnit and EndOfData)
+// and a value. A name reference of varint(0) defines the next entry of the name table
+// as varint(length) followed by UTF-8 characters, varint(n) refers to entry n-1.
+// Integers are zig-zag/LEB128 varints and reals are 8 byte little endian IEEE values.
+
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace WBFL
+{
+   namespace System
+   {
+      namespace StructuredBinary
+      {
+         enum class Tag : Uint8
+         {
+            EndOfData          = 0x00,
+            BeginUnit          = 0x01,
+            BeginVersionedUnit = 0x02,
+            EndUnit            = 0x03,
+            String             = 0x10,
+            Real               = 0x11,
+            Integer            = 0x12,
+            Unsigned           = 0x13,
+            True               = 0x14,
+            False              = 0x15
+         };
+
+         inline bool IsUnit(Tag tag) { return tag == Tag::BeginUnit || tag == Tag::BeginVersionedUnit; }
+         inline bool IsProperty(Tag tag) { return Tag::String <= tag && tag <= Tag::False; }
+
+         /// A decoded record
+         struct Record
+         {
+            Tag tag = Tag::EndOfData;
+            IndexType name = INVALID_INDEX; // index into the reader's name table
+            Float64 real = 0.0; // unit version or real value
+            Int64 integer = 0;
+            Uint64 unsigned_integer = 0;
+            std::string text;
+         };
+
+         /// Location of a record in the stream
+         struct Position
+         {
+            std::streamoff Block = 0; // stream offset of the buffered block
+            std::size_t Offset = 0; // offset of the record within the block
+            IndexType NameCount = 0; // number of names defined before the record
+         };
+
+         /// Encodes records and writes them to a stream
+         class Writer
+         {
+         public:
+            void Begin(std::ostream* pos, bool bCompress);
+            void End();
+
+            void BeginUnit(const std::string& name, Float64 version);
+            void EndUnit();
+            void String(const std::string& name, std::string_view value);
+            void Real(const std::string& name, Float64 value);
+            void Integer(const std::string& name, Int64 value);
+            void Unsigned(const std::string& name, Uint64 value);
+            void Bool(const std::string& name, bool value);
+
+         private:
+            std::ostream* m_pOS = nullptr;
+            bool m_bCompress = false;
+            std::string m_Buffer;
+            std::string m_Compressed;
+            std::unordered_map<std::string, Uint64> m_Names;
+
+            void Name(Tag tag, const std::string& name); // writes the record tag and name reference
+            void Varint(Uint64 value);
+            void Flush();
+         };
+
+         /// Reads records from a stream
+         class Reader
+         {
+         public:
+            void Begin(std::istream* pis);
+            void End();
+
+            /// Decodes the next record
+            void Read(Record* pRecord);
+
+            /// Returns the position of the next record. The position can be restored
+            /// with SetPosition if the stream is seekable.
+            Position GetPosition() const;
+            void SetPosition(const Position& position);
+
+            const std::string& GetName(IndexType index) const { return m_Names[index]; }
+            const std::_tstring& GetTName(IndexType index) const { return m_TNames[index]; }
+
+         private:
+            std::istream* m_pIS = nullptr;
+            bool m_bCompressed = false;
+            std::vector<char> m_Buffer;
+            std::vector<char> m_Compressed;
+            std::size_t m_Size = 0; // number of valid bytes in m_Buffer
+            std::size_t m_Offset = 0;
+            std::streamoff m_Block = 0;
+            std::vector<std::string> m_Names;
+            std::vector<std::_tstring> m_TNames;
+            IndexType m_NameCount = 0;
+
+            Uint8 Byte();
+            void Bytes(char* pBytes, std::size_t count);
+            Uint64 Varint();
+            IndexType Name();
+            void Fill();
+            bool ReadBlock();
+         };
+
+         /// Returns the text of a property record as it is written in xml
+         std::string GetText(const Record& record);
+
+         /// Property value conversions. These return false if the record value cannot be
+         /// represented by the requested type.
+         bool GetReal(const Record& record, Float64* pValue);
+         bool GetInteger(const Record& record, Int64* pValue);
+         bool GetUnsigned(const Record& record, Uint64* pValue);
+         bool GetBool(const Record& record, bool* pValue);
+
+         /// Appends record, and its content if it is a unit, to xml as formatted by StructuredSaveXml
+         void WriteXml(Reader& reader, const Record& record, std::string& xml);
+
+         /// Parses xml written by StructuredSaveXml and writes its units and properties.
+         /// Property values are written as strings.
+         void ReadXml(std::string_view xml, Writer& writer);
+      };
+   };
+};
+
+#endif // INCLUDED_STRUCTUREDBINARY_H_
@@ -0,0 +1,460 @@
+///////////////////////////////////////////////////////////////////////
+// System - WBFL low level system services
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+#include <System\SysExp.h>
+#include <System\StructuredLoadBinary.h>
+#include "StructuredBinary.h"
+#include "StructuredText.h"
+
+#include <istream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace WBFL::System;
+
+// This class is implemented with the famous PIMPL idiom.
+// This is the implementation class
+namespace WBFL
+{
+   namespace System
+   {
+      class StructuredLoadBinary_Impl : public IStructuredLoad
+      {
+      public:
+         StructuredLoadBinary_Impl() = default;
+         virtual ~StructuredLoadBinary_Impl() = default;
+
+         StructuredLoadBinary_Impl(const StructuredLoadBinary_Impl&) = delete;
+         StructuredLoadBinary_Impl& operator=(const StructuredLoadBinary_Impl&) = delete;
+
+         void BeginLoad(std::istream* pis);
+         void EndLoad();
+         virtual bool BeginUnit(LPCTSTR name) override;
+         virtual bool EndUnit() override;
+         virtual Float64 GetVersion() override;
+         virtual Float64 GetParentVersion() override;
+         virtual std::_tstring GetParentUnit() override;
+         virtual Float64 GetTopVersion() override;
+         virtual bool Property(LPCTSTR name, std::_tstring* pvalue) override;
+         virtual bool Property(LPCTSTR name, Float64* pvalue) override;
+         virtual bool Property(LPCTSTR name, Int16* pvalue) override;
+         virtual bool Property(LPCTSTR name, Uint16* pvalue) override;
+         virtual bool Property(LPCTSTR name, Int32* pvalue) override;
+         virtual bool Property(LPCTSTR name, Uint32* pvalue) override;
+         virtual bool Property(LPCTSTR name, Int64* pvalue) override;
+         virtual bool Property(LPCTSTR name, Uint64* pvalue) override;
+         virtual bool Property(LPCTSTR name, LONG* pvalue) override;
+         virtual bool Property(LPCTSTR name, ULONG* pvalue) override;
+         virtual bool Property(LPCTSTR name, bool* pvalue) override;
+         virtual bool Eof() const override;
+         virtual std::_tstring GetStateDump() const override;
+         virtual std::_tstring GetUnit() const override;
+
+      private:
+         mutable StructuredBinary::Reader m_Reader; // GetUnit reads ahead and then restores the reader position
+         bool m_bLoading = false;
+
+         StructuredBinary::Record m_Current; // the next record in the stream
+         StructuredBinary::Position m_CurrentPosition; // location of m_Current
+
+         struct ListItem
+         {
+            std::_tstring Name;
+            Float64 Version;
+            StructuredBinary::Position Start; // location of the BeginUnit record
+         };
+         std::vector<ListItem> m_UnitList; // stack of information about current units.
+
+         bool IsCurrent(LPCTSTR name) const;
+         void ReadNext();
+
+         template <class T> bool GetIntegral(LPCTSTR name, T* pvalue);
+      };
+   };
+};
+
+
+StructuredLoadBinary::StructuredLoadBinary():
+m_pImp(std::make_unique<StructuredLoadBinary_Impl>())
+{
+   PRECONDITION(m_pImp.get() != nullptr);
+}
+
+// why is this declared here? It is what you need to do to get the PIMPL idiom
+// to work with std::unique_ptr<>. See https://www.fluentcpp.com/2017/09/22/make-pimpl-using-unique_ptr/.
+StructuredLoadBinary::~StructuredLoadBinary() = default;
+
+void StructuredLoadBinary::BeginLoad(std::istream* pis)
+{
+   m_pImp->BeginLoad(pis);
+}
+
+void StructuredLoadBinary::EndLoad()
+{
+   m_pImp->EndLoad();
+}
+
+bool StructuredLoadBinary::BeginUnit(LPCTSTR name)
+{
+   return m_pImp->BeginUnit(name);
+}
+
+bool StructuredLoadBinary::EndUnit()
+{
+   return m_pImp->EndUnit();
+}
+
+Float64 StructuredLoadBinary::GetVersion()
+{
+   return m_pImp->GetVersion();
+}
+
+Float64 StructuredLoadBinary::GetParentVersion()
+{
+   return m_pImp->GetParentVersion();
+}
+
+std::_tstring StructuredLoadBinary::GetParentUnit()
+{
+   return m_pImp->GetParentUnit();
+}
+
+Float64 StructuredLoadBinary::GetTopVersion()
+{
+   return m_pImp->GetTopVersion();
+}
+
+bool StructuredLoadBinary::Property(LPCTSTR name, std::_tstring* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadBinary::Property(LPCTSTR name, Float64* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadBinary::Property(LPCTSTR name, Int16* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadBinary::Property(LPCTSTR name, Uint16* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadBinary::Property(LPCTSTR name, Int32* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadBinary::Property(LPCTSTR name, Uint32* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadBinary::Property(LPCTSTR name, Int64* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadBinary::Property(LPCTSTR name, Uint64* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadBinary::Property(LPCTSTR name, LONG* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadBinary::Property(LPCTSTR name, ULONG* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadBinary::Property(LPCTSTR name, bool* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadBinary::Eof() const
+{
+   return m_pImp->Eof();
+}
+
+std::_tstring StructuredLoadBinary::GetStateDump() const
+{
+   return m_pImp->GetStateDump();
+}
+
+std::_tstring StructuredLoadBinary::GetUnit() const
+{
+   return m_pImp->GetUnit();
+}
+
+
+void StructuredLoadBinary_Impl::BeginLoad(std::istream* pis)
+{
+   PRECONDITION(pis != nullptr);
+   CHECK(!m_bLoading); // previously used and not cleaned up?
+
+   m_Reader.Begin(pis);
+   m_bLoading = true;
+   m_UnitList.clear();
+   ReadNext();
+}
+
+void StructuredLoadBinary_Impl::EndLoad()
+{
+   m_Reader.End();
+   m_bLoading = false;
+   m_UnitList.clear();
+   m_Current = StructuredBinary::Record();
+}
+
+bool StructuredLoadBinary_Impl::BeginUnit(LPCTSTR name)
+{
+   PRECONDITION(m_bLoading);
+   if (!IsCurrent(name))
+      return false;
+
+   if (StructuredBinary::IsUnit(m_Current.tag))
+   {
+      m_UnitList.push_back({ name, m_Current.real, m_CurrentPosition });
+      ReadNext();
+      return true;
+   }
+
+   if (m_Current.tag == StructuredBinary::Tag::String && m_Current.text.empty())
+   {
+      // an empty xml element is converted to an empty string, but it could also be a unit without content
+      m_UnitList.push_back({ name, 0.0, m_CurrentPosition });
+      m_Current = StructuredBinary::Record();
+      m_Current.tag = StructuredBinary::Tag::EndUnit;
+      return true;
+   }
+
+   return false;
+}
+
+bool StructuredLoadBinary_Impl::EndUnit()
+{
+   PRECONDITION(m_bLoading);
+
+   // can't go negative here.
+   if (m_UnitList.empty())
+      THROW_LOAD(InvalidFileFormat,this);
+
+   // skip anything in the unit that wasn't read
+   IndexType level = 0;
+   while (m_Current.tag != StructuredBinary::Tag::EndUnit || 0 < level)
+   {
+      if (m_Current.tag == StructuredBinary::Tag::EndOfData)
+      {
+         THROW_LOAD(InvalidFileFormat,this);
+      }
+      else if (StructuredBinary::IsUnit(m_Current.tag))
+         level++;
+      else if (m_Current.tag == StructuredBinary::Tag::EndUnit)
+         level--;
+
+      ReadNext();
+   }
+
+   m_UnitList.pop_back();
+   ReadNext(); // go on to next record
+   return true;
+}
+
+Float64 StructuredLoadBinary_Impl::GetVersion()
+{
+   return m_UnitList.empty() ? 0.0 : m_UnitList.back().Version;
+}
+
+Float64 StructuredLoadBinary_Impl::GetParentVersion()
+{
+   return m_UnitList.size() < 2 ? 0.0 : m_UnitList[m_UnitList.size() - 2].Version;
+}
+
+std::_tstring StructuredLoadBinary_Impl::GetParentUnit()
+{
+   return m_UnitList.size() < 2 ? std::_tstring() : m_UnitList[m_UnitList.size() - 2].Name;
+}
+
+Float64 StructuredLoadBinary_Impl::GetTopVersion()
+{
+   return m_UnitList.empty() ? 0.0 : m_UnitList.front().Version;
+}
+
+bool StructuredLoadBinary_Impl::Property(LPCTSTR name, std::_tstring* pvalue)
+{
+   if (!IsCurrent(name) || !StructuredBinary::IsProperty(m_Current.tag))
+      return false;
+
+   *pvalue = StructuredText::FromUtf8(StructuredBinary::GetText(m_Current));
+   ReadNext();
+   return true;
+}
+
+bool StructuredLoadBinary_Impl::Property(LPCTSTR name, Float64* pvalue)
+{
+   if (!IsCurrent(name) || !StructuredBinary::IsProperty(m_Current.tag))
+      return false;
+
+   if (!StructuredBinary::GetReal(m_Current, pvalue))
+      THROW_LOAD(InvalidFileFormat,this);
+
+   ReadNext();
+   return true;
+}
+
+bool StructuredLoadBinary_Impl::Property(LPCTSTR name, Int16* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadBinary_Impl::Property(LPCTSTR name, Uint16* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadBinary_Impl::Property(LPCTSTR name, Int32* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadBinary_Impl::Property(LPCTSTR name, Uint32* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadBinary_Impl::Property(LPCTSTR name, Int64* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadBinary_Impl::Property(LPCTSTR name, Uint64* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadBinary_Impl::Property(LPCTSTR name, LONG* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadBinary_Impl::Property(LPCTSTR name, ULONG* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadBinary_Impl::Property(LPCTSTR name, bool* pvalue)
+{
+   if (!IsCurrent(name) || !StructuredBinary::IsProperty(m_Current.tag))
+      return false;
+
+   if (!StructuredBinary::GetBool(m_Current, pvalue))
+      THROW_LOAD(InvalidFileFormat,this);
+
+   ReadNext();
+   return true;
+}
+
+bool StructuredLoadBinary_Impl::Eof() const
+{
+   return m_Current.tag == StructuredBinary::Tag::EndOfData;
+}
+
+std::_tstring StructuredLoadBinary_Impl::GetStateDump() const
+{
+   std::_tostringstream os;
+   os << _T("Dump for StructuredLoadBinary_Impl") << std::endl;
+   os << _T("  Level       = ") << m_UnitList.size() << std::endl;
+   os << _T("  Units: <name, version> ") << std::endl;
+   for (const auto& item : m_UnitList)
+      os <<_T("    <")<<item.Name<<_T(", ")<<item.Version<<_T(">")<<std::endl;
+   return os.str();
+}
+
+std::_tstring StructuredLoadBinary_Impl::GetUnit() const
+{
+   PRECONDITION(!m_UnitList.empty());
+
+   // read the unit again from its beginning, then pick up where we left off
+   auto resume = m_Reader.GetPosition();
+   m_Reader.SetPosition(m_UnitList.back().Start);
+
+   StructuredBinary::Record unit;
+   m_Reader.Read(&unit);
+   std::string xml;
+   StructuredBinary::WriteXml(m_Reader, unit, xml);
+
+   m_Reader.SetPosition(resume);
+
+   return StructuredText::FromUtf8(xml);
+}
+
+bool StructuredLoadBinary_Impl::IsCurrent(LPCTSTR name) const
+{
+   return m_Current.name != INVALID_INDEX && m_Reader.GetTName(m_Current.name) == name;
+}
+
+void StructuredLoadBinary_Impl::ReadNext()
+{
+   m_CurrentPosition = m_Reader.GetPosition();
+   m_Reader.Read(&m_Current);
+}
+
+template <class T>
+bool StructuredLoadBinary_Impl::GetIntegral(LPCTSTR name, T* pvalue)
+{
+   if (!IsCurrent(name) || !StructuredBinary::IsProperty(m_Current.tag))
+      return false;
+
+   if constexpr (std::is_signed_v<T>)
+   {
+      Int64 value;
+      if (!StructuredBinary::GetInteger(m_Current, &value))
+         THROW_LOAD(InvalidFileFormat,this);
+
+      CHECK(std::numeric_limits<T>::min() <= value && value <= std::numeric_limits<T>::max()); // check for overflows
+      *pvalue = (T)value;
+   }
+   else
+   {
+      Uint64 value;
+      if (!StructuredBinary::GetUnsigned(m_Current, &value))
+         THROW_LOAD(InvalidFileFormat,this);
+
+      CHECK(value <= std::numeric_limits<T>::max()); // check for overflows
+      *pvalue = (T)value;
+   }
+
+   ReadNext();
+   return true;
+}
@@ -0,0 +1,788 @@
+///////////////////////////////////////////////////////////////////////
+// System - WBFL low level system services
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+#include <System\SysExp.h>
+#include <System\StructuredLoadXmlStream.h>
+#include "StructuredText.h"
+
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace WBFL::System;
+
+// This class is implemented with the famous PIMPL idiom.
+// This is the implementation class
+namespace WBFL
+{
+   namespace System
+   {
+      class StructuredLoadXmlStream_Impl : public IStructuredLoad
+      {
+      public:
+         StructuredLoadXmlStream_Impl() = default;
+         virtual ~StructuredLoadXmlStream_Impl() = default;
+
+         StructuredLoadXmlStream_Impl(const StructuredLoadXmlStream_Impl&) = delete;
+         StructuredLoadXmlStream_Impl& operator=(const StructuredLoadXmlStream_Impl&) = delete;
+
+         void BeginLoad(std::istream* pis);
+         void EndLoad();
+         virtual bool BeginUnit(LPCTSTR name) override;
+         virtual bool EndUnit() override;
+         virtual Float64 GetVersion() override;
+         virtual Float64 GetParentVersion() override;
+         virtual std::_tstring GetParentUnit() override;
+         virtual Float64 GetTopVersion() override;
+         virtual bool Property(LPCTSTR name, std::_tstring* pvalue) override;
+         virtual bool Property(LPCTSTR name, Float64* pvalue) override;
+         virtual bool Property(LPCTSTR name, Int16* pvalue) override;
+         virtual bool Property(LPCTSTR name, Uint16* pvalue) override;
+         virtual bool Property(LPCTSTR name, Int32* pvalue) override;
+         virtual bool Property(LPCTSTR name, Uint32* pvalue) override;
+         virtual bool Property(LPCTSTR name, Int64* pvalue) override;
+         virtual bool Property(LPCTSTR name, Uint64* pvalue) override;
+         virtual bool Property(LPCTSTR name, LONG* pvalue) override;
+         virtual bool Property(LPCTSTR name, ULONG* pvalue) override;
+         virtual bool Property(LPCTSTR name, bool* pvalue) override;
+         virtual bool Eof() const override;
+         virtual std::_tstring GetStateDump() const override;
+         virtual std::_tstring GetUnit() const override;
+
+      private:
+         // GetUnit reads ahead and then returns to where it was, so the
+         // input state is mutable
+         mutable std::istream* m_pIStream = nullptr;
+         mutable std::vector<char> m_Buffer;
+         mutable std::size_t m_Size = 0; // number of characters in m_Buffer
+         mutable std::size_t m_Offset = 0; // offset of the next character in m_Buffer
+         mutable std::streamoff m_BufferStart = 0; // stream offset of m_Buffer
+         mutable std::string* m_pCapture = nullptr; // receives the characters that are read
+
+         // the next element start or end tag in the stream
+         struct Node
+         {
+            enum class Type { Element, EndElement, EndOfFile } Type = Type::EndOfFile;
+            std::string Name;
+            Float64 Version = 0.0;
+            bool bEmpty = false; // element is written as <Name/>
+            std::streamoff Start = 0; // location of the tag
+         };
+         mutable Node m_Node;
+
+         struct ListItem
+         {
+            std::_tstring Name;
+            std::string Utf8Name;
+            Float64 Version;
+            std::streamoff Start; // location of the unit's start tag
+         };
+         std::vector<ListItem> m_UnitList; // stack of information about current units.
+
+         std::size_t Fill(std::size_t count) const;
+         int Peek() const;
+         bool StartsWith(std::string_view str) const;
+         void Consume(std::size_t count) const;
+         void Expect(char c) const;
+         void SkipWhitespace() const;
+         void SkipPast(std::string_view terminator) const;
+         void ReadUntil(char c, std::string* pText) const;
+         void ReadName(std::string* pName) const;
+         std::streamoff GetPosition() const;
+         void SetPosition(std::streamoff position) const;
+
+         void ReadNode() const;
+         void SkipElement() const;
+         bool GetProperty(LPCTSTR name, std::string* pText);
+
+         template <class T> bool GetIntegral(LPCTSTR name, T* pvalue);
+      };
+   };
+};
+
+
+StructuredLoadXmlStream::StructuredLoadXmlStream():
+m_pImp(std::make_unique<StructuredLoadXmlStream_Impl>())
+{
+   PRECONDITION(m_pImp.get() != nullptr);
+}
+
+// why is this declared here? It is what you need to do to get the PIMPL idiom
+// to work with std::unique_ptr<>. See https://www.fluentcpp.com/2017/09/22/make-pimpl-using-unique_ptr/.
+StructuredLoadXmlStream::~StructuredLoadXmlStream() = default;
+
+void StructuredLoadXmlStream::BeginLoad(std::istream* pis)
+{
+   m_pImp->BeginLoad(pis);
+}
+
+void StructuredLoadXmlStream::EndLoad()
+{
+   m_pImp->EndLoad();
+}
+
+bool StructuredLoadXmlStream::BeginUnit(LPCTSTR name)
+{
+   return m_pImp->BeginUnit(name);
+}
+
+bool StructuredLoadXmlStream::EndUnit()
+{
+   return m_pImp->EndUnit();
+}
+
+Float64 StructuredLoadXmlStream::GetVersion()
+{
+   return m_pImp->GetVersion();
+}
+
+Float64 StructuredLoadXmlStream::GetParentVersion()
+{
+   return m_pImp->GetParentVersion();
+}
+
+std::_tstring StructuredLoadXmlStream::GetParentUnit()
+{
+   return m_pImp->GetParentUnit();
+}
+
+Float64 StructuredLoadXmlStream::GetTopVersion()
+{
+   return m_pImp->GetTopVersion();
+}
+
+bool StructuredLoadXmlStream::Property(LPCTSTR name, std::_tstring* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadXmlStream::Property(LPCTSTR name, Float64* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadXmlStream::Property(LPCTSTR name, Int16* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadXmlStream::Property(LPCTSTR name, Uint16* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadXmlStream::Property(LPCTSTR name, Int32* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadXmlStream::Property(LPCTSTR name, Uint32* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadXmlStream::Property(LPCTSTR name, Int64* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadXmlStream::Property(LPCTSTR name, Uint64* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadXmlStream::Property(LPCTSTR name, LONG* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadXmlStream::Property(LPCTSTR name, ULONG* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadXmlStream::Property(LPCTSTR name, bool* pvalue)
+{
+   return m_pImp->Property(name,pvalue);
+}
+
+bool StructuredLoadXmlStream::Eof() const
+{
+   return m_pImp->Eof();
+}
+
+std::_tstring StructuredLoadXmlStream::GetStateDump() const
+{
+   return m_pImp->GetStateDump();
+}
+
+std::_tstring StructuredLoadXmlStream::GetUnit() const
+{
+   return m_pImp->GetUnit();
+}
+
+
+void StructuredLoadXmlStream_Impl::BeginLoad(std::istream* pis)
+{
+   PRECONDITION(pis != nullptr);
+   CHECK(m_pIStream == nullptr); // previously used and not cleaned up?
+
+   m_pIStream = pis;
+   m_Buffer.resize(64 * 1024);
+   m_Size = 0;
+   m_Offset = 0;
+   m_BufferStart = std::max((std::streamoff)m_pIStream->tellg(), (std::streamoff)0);
+   m_UnitList.clear();
+
+   if (StartsWith("\xEF\xBB\xBF"))
+      Consume(3); // UTF-8 byte order mark
+
+   ReadNode();
+   if (m_Node.Type != Node::Type::Element)
+      THROW_LOAD(InvalidFileFormat,this);
+}
+
+void StructuredLoadXmlStream_Impl::EndLoad()
+{
+   m_pIStream = nullptr;
+   m_UnitList.clear();
+   m_Node = Node();
+}
+
+bool StructuredLoadXmlStream_Impl::BeginUnit(LPCTSTR name)
+{
+   PRECONDITION(m_pIStream != nullptr);
+   if (m_Node.Type != Node::Type::Element || !StructuredText::IsEqual(m_Node.Name, name))
+      return false;
+
+   m_UnitList.push_back({ name, m_Node.Name, m_Node.Version, m_Node.Start });
+
+   if (m_Node.bEmpty)
+      m_Node.Type = Node::Type::EndElement; // <Name/> is its own end tag
+   else
+      ReadNode();
+
+   return true;
+}
+
+bool StructuredLoadXmlStream_Impl::EndUnit()
+{
+   PRECONDITION(m_pIStream != nullptr);
+
+   // can't go negative here.
+   if (m_UnitList.empty())
+      THROW_LOAD(InvalidFileFormat,this);
+
+   // skip anything in the unit that wasn't read
+   while (m_Node.Type == Node::Type::Element)
+   {
+      if (!m_Node.bEmpty)
+         SkipElement();
+
+      ReadNode();
+   }
+
+   if (m_Node.Type != Node::Type::EndElement || m_Node.Name != m_UnitList.back().Utf8Name)
+      THROW_LOAD(InvalidFileFormat,this);
+
+   m_UnitList.pop_back();
+   ReadNode(); // go on to next node
+   return true;
+}
+
+Float64 StructuredLoadXmlStream_Impl::GetVersion()
+{
+   return m_UnitList.empty() ? 0.0 : m_UnitList.back().Version;
+}
+
+Float64 StructuredLoadXmlStream_Impl::GetParentVersion()
+{
+   return m_UnitList.size() < 2 ? 0.0 : m_UnitList[m_UnitList.size() - 2].Version;
+}
+
+std::_tstring StructuredLoadXmlStream_Impl::GetParentUnit()
+{
+   return m_UnitList.size() < 2 ? std::_tstring() : m_UnitList[m_UnitList.size() - 2].Name;
+}
+
+Float64 StructuredLoadXmlStream_Impl::GetTopVersion()
+{
+   return m_UnitList.empty() ? 0.0 : m_UnitList.front().Version;
+}
+
+bool StructuredLoadXmlStream_Impl::Property(LPCTSTR name, std::_tstring* pvalue)
+{
+   std::string text;
+   if (!GetProperty(name, &text))
+      return false;
+
+   StructuredText::RestorePropertyText(text);
+   *pvalue = StructuredText::FromUtf8(text);
+   return true;
+}
+
+bool StructuredLoadXmlStream_Impl::Property(LPCTSTR name, Float64* pvalue)
+{
+   std::string text;
+   if (!GetProperty(name, &text))
+      return false;
+
+   if (!StructuredText::ToReal(text, pvalue))
+      THROW_LOAD(InvalidFileFormat,this);
+
+   return true;
+}
+
+bool StructuredLoadXmlStream_Impl::Property(LPCTSTR name, Int16* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadXmlStream_Impl::Property(LPCTSTR name, Uint16* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadXmlStream_Impl::Property(LPCTSTR name, Int32* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadXmlStream_Impl::Property(LPCTSTR name, Uint32* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadXmlStream_Impl::Property(LPCTSTR name, Int64* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadXmlStream_Impl::Property(LPCTSTR name, Uint64* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadXmlStream_Impl::Property(LPCTSTR name, LONG* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadXmlStream_Impl::Property(LPCTSTR name, ULONG* pvalue)
+{
+   return GetIntegral(name, pvalue);
+}
+
+bool StructuredLoadXmlStream_Impl::Property(LPCTSTR name, bool* pvalue)
+{
+   std::string text;
+   if (!GetProperty(name, &text))
+      return false;
+
+   if (!StructuredText::ToBool(text, pvalue))
+      THROW_LOAD(InvalidFileFormat,this);
+
+   return true;
+}
+
+bool StructuredLoadXmlStream_Impl::Eof() const
+{
+   return m_Node.Type == Node::Type::EndOfFile;
+}
+
+std::_tstring StructuredLoadXmlStream_Impl::GetStateDump() const
+{
+   std::_tostringstream os;
+   os << _T("Dump for StructuredLoadXmlStream_Impl") << std::endl;
+   os << _T("  Level       = ") << m_UnitList.size() << std::endl;
+   os << _T("  Units: <name, version> ") << std::endl;
+   for (const auto& item : m_UnitList)
+      os <<_T("    <")<<item.Name<<_T(", ")<<item.Version<<_T(">")<<std::endl;
+   return os.str();
+}
+
+std::_tstring StructuredLoadXmlStream_Impl::GetUnit() const
+{
+   PRECONDITION(!m_UnitList.empty());
+
+   // read the unit again from its start tag, capturing the text, then pick up where we left off
+   auto resume = GetPosition();
+   Node node(m_Node);
+
+   std::string xml;
+   SetPosition(m_UnitList.back().Start);
+   m_pCapture = &xml;
+   try
+   {
+      ReadNode();
+      if (!m_Node.bEmpty)
+         SkipElement();
+   }
+   catch (...)
+   {
+      m_pCapture = nullptr;
+      throw;
+   }
+   m_pCapture = nullptr;
+
+   SetPosition(resume);
+   m_Node = std::move(node);
+
+   return StructuredText::FromUtf8(xml);
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Input
+////////////////////////////////////////////////////////////////////////////
+std::size_t StructuredLoadXmlStream_Impl::Fill(std::size_t count) const
+{
+   if (m_Size - m_Offset < count)
+   {
+      // keep the unread characters and read more after them
+      std::memmove(m_Buffer.data(), m_Buffer.data() + m_Offset, m_Size - m_Offset);
+      m_BufferStart += (std::streamoff)m_Offset;
+      m_Size -= m_Offset;
+      m_Offset = 0;
+
+      while (m_Size < count)
+      {
+         m_pIStream->read(m_Buffer.data() + m_Size, m_Buffer.size() - m_Size);
+         std::size_t nRead = (std::size_t)m_pIStream->gcount();
+         if (nRead == 0)
+            break;
+
+         m_Size += nRead;
+      }
+   }
+
+   return m_Size - m_Offset;
+}
+
+int StructuredLoadXmlStream_Impl::Peek() const
+{
+   return Fill(1) == 0 ? -1 : (unsigned char)m_Buffer[m_Offset];
+}
+
+bool StructuredLoadXmlStream_Impl::StartsWith(std::string_view str) const
+{
+   return str.size() <= Fill(str.size()) && std::equal(str.begin(), str.end(), m_Buffer.data() + m_Offset);
+}
+
+void StructuredLoadXmlStream_Impl::Consume(std::size_t count) const
+{
+   CHECK(count <= m_Size - m_Offset);
+   if (m_pCapture)
+      m_pCapture->append(m_Buffer.data() + m_Offset, count);
+
+   m_Offset += count;
+}
+
+void StructuredLoadXmlStream_Impl::Expect(char c) const
+{
+   if (Peek() != (unsigned char)c)
+      THROW_LOAD(InvalidFileFormat,this);
+
+   Consume(1);
+}
+
+void StructuredLoadXmlStream_Impl::SkipWhitespace() const
+{
+   int c;
+   while ((c = Peek()) != -1 && StructuredText::IsWhitespace((char)c))
+      Consume(1);
+}
+
+void StructuredLoadXmlStream_Impl::SkipPast(std::string_view terminator) const
+{
+   while (!StartsWith(terminator))
+   {
+      if (Peek() == -1)
+         THROW_LOAD(InvalidFileFormat,this);
+
+      Consume(1);
+   }
+
+   Consume(terminator.size());
+}
+
+void StructuredLoadXmlStream_Impl::ReadUntil(char c, std::string* pText) const
+{
+   // reads characters up to, but not including, c or the end of the stream
+   while (0 < Fill(1))
+   {
+      const char* pBegin = m_Buffer.data() + m_Offset;
+      const char* pFound = (const char*)std::memchr(pBegin, c, m_Size - m_Offset);
+      std::size_t count = (pFound ? pFound : m_Buffer.data() + m_Size) - pBegin;
+      if (pText)
+         pText->append(pBegin, count);
+
+      Consume(count);
+
+      if (pFound)
+         break;
+   }
+}
+
+void StructuredLoadXmlStream_Impl::ReadName(std::string* pName) const
+{
+   pName->clear();
+   int c;
+   while ((c = Peek()) != -1 && !StructuredText::IsWhitespace((char)c) && c != '/' && c != '>' && c != '=')
+   {
+      pName->push_back((char)c);
+      Consume(1);
+   }
+
+   if (pName->empty())
+      THROW_LOAD(InvalidFileFormat,this);
+}
+
+std::streamoff StructuredLoadXmlStream_Impl::GetPosition() const
+{
+   return m_BufferStart + (std::streamoff)m_Offset;
+}
+
+void StructuredLoadXmlStream_Impl::SetPosition(std::streamoff position) const
+{
+   m_pIStream->clear();
+   m_pIStream->seekg(position);
+   if (m_pIStream->fail())
+      THROW_LOAD(BadRead,this);
+
+   m_BufferStart = position;
+   m_Size = 0;
+   m_Offset = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Xml
+////////////////////////////////////////////////////////////////////////////
+void StructuredLoadXmlStream_Impl::ReadNode() const
+{
+   while (true)
+   {
+      // character data between elements is not significant
+      ReadUntil('<', nullptr);
+      if (Peek() == -1)
+      {
+         m_Node.Type = Node::Type::EndOfFile;
+         m_Node.Name.clear();
+         return;
+      }
+
+      if (StartsWith("<!--"))
+         SkipPast("-->");
+      else if (StartsWith("<![CDATA["))
+         SkipPast("]]>");
+      else if (StartsWith("<?"))
+         SkipPast("?>");
+      else if (StartsWith("<!"))
+         SkipPast(">"); // DOCTYPE
+      else
+         break;
+   }
+
+   m_Node.Start = GetPosition();
+   m_Node.Version = 0.0;
+   m_Node.bEmpty = false;
+
+   if (StartsWith("</"))
+   {
+      Consume(2);
+      ReadName(&m_Node.Name);
+      SkipWhitespace();
+      Expect('>');
+      m_Node.Type = Node::Type::EndElement;
+      return;
+   }
+
+   Consume(1);
+   ReadName(&m_Node.Name);
+   m_Node.Type = Node::Type::Element;
+
+   while (true)
+   {
+      SkipWhitespace();
+      if (StartsWith("/>"))
+      {
+         Consume(2);
+         m_Node.bEmpty = true;
+         break;
+      }
+      else if (StartsWith(">"))
+      {
+         Consume(1);
+         break;
+      }
+
+      std::string attribute;
+      ReadName(&attribute);
+      SkipWhitespace();
+      Expect('=');
+      SkipWhitespace();
+
+      int quote = Peek();
+      if (quote != '"' && quote != '\'')
+         THROW_LOAD(InvalidFileFormat,this);
+      Consume(1);
+
+      std::string raw;
+      ReadUntil((char)quote, &raw);
+      Expect((char)quote);
+
+      if (attribute == "version")
+      {
+         // the version attribute is formatted for the locale
+         std::string value;
+         StructuredText::AppendXmlText(value, raw);
+         std::replace(value.begin(), value.end(), ',', '.');
+         if (!StructuredText::ToReal(value, &m_Node.Version))
+            THROW_LOAD(InvalidFileFormat,this);
+      }
+   }
+}
+
+void StructuredLoadXmlStream_Impl::SkipElement() const
+{
+   // skips the content and end tag of the current element
+   std::vector<std::string> elements{ m_Node.Name };
+   while (!elements.empty())
+   {
+      ReadNode();
+      if (m_Node.Type == Node::Type::EndOfFile)
+      {
+         THROW_LOAD(InvalidFileFormat,this);
+      }
+      else if (m_Node.Type == Node::Type::EndElement)
+      {
+         if (m_Node.Name != elements.back())
+            THROW_LOAD(InvalidFileFormat,this);
+
+         elements.pop_back();
+      }
+      else if (!m_Node.bEmpty)
+      {
+         elements.push_back(m_Node.Name);
+      }
+   }
+}
+
+bool StructuredLoadXmlStream_Impl::GetProperty(LPCTSTR name, std::string* pText)
+{
+   PRECONDITION(m_pIStream != nullptr);
+   if (m_Node.Type != Node::Type::Element || !StructuredText::IsEqual(m_Node.Name, name))
+      return false;
+
+   pText->clear();
+   if (!m_Node.bEmpty)
+   {
+      // read the character data through the end tag
+      std::string raw;
+      while (true)
+      {
+         ReadUntil('<', &raw);
+         if (Peek() == -1)
+            THROW_LOAD(InvalidFileFormat,this);
+
+         if (StartsWith("</"))
+         {
+            Consume(2);
+            std::string endName;
+            ReadName(&endName);
+            SkipWhitespace();
+            Expect('>');
+            if (endName != m_Node.Name)
+               THROW_LOAD(InvalidFileFormat,this);
+            break;
+         }
+         else if (StartsWith("<!--"))
+         {
+            SkipPast("-->");
+         }
+         else if (StartsWith("<![CDATA["))
+         {
+            StructuredText::AppendXmlText(*pText, raw);
+            raw.clear();
+
+            Consume(9);
+            while (!StartsWith("]]>"))
+            {
+               int c = Peek();
+               if (c == -1)
+                  THROW_LOAD(InvalidFileFormat,this);
+               pText->push_back((char)c);
+               Consume(1);
+            }
+            Consume(3);
+         }
+         else if (StartsWith("<?"))
+         {
+            SkipPast("?>");
+         }
+         else
+         {
+            // a unit, not a property
+            THROW_LOAD(InvalidFileFormat,this);
+         }
+      }
+      StructuredText::AppendXmlText(*pText, raw);
+   }
+
+   ReadNode(); // go on to next node
+   return true;
+}
+
+template <class T>
+bool StructuredLoadXmlStream_Impl::GetIntegral(LPCTSTR name, T* pvalue)
+{
+   std::string text;
+   if (!GetProperty(name, &text))
+      return false;
+
+   if constexpr (std::is_signed_v<T>)
+   {
+      Int64 value;
+      if (!StructuredText::ToInteger(text, &value))
+         THROW_LOAD(InvalidFileFormat,this);
+
+      CHECK(std::numeric_limits<T>::min() <= value && value <= std::numeric_limits<T>::max()); // check for overflows
+      *pvalue = (T)value;
+   }
+   else
+   {
+      Uint64 value;
+      if (!StructuredText::ToUnsigned(text, &value))
+         THROW_LOAD(InvalidFileFormat,this);
+
+      CHECK(value <= std::numeric_limits<T>::max()); // check for overflows
+      *pvalue = (T)value;
+   }
+
+   return true;
+}
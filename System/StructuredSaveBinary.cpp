@@ -0,0 +1,324 @@
+///////////////////////////////////////////////////////////////////////
+// System - WBFL low level system services
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#include <System\SysExp.h>
+#include <System\StructuredSaveBinary.h>
+#include <System\XStructuredLoad.h>
+#include <System\XStructuredSave.h>
+#include "StructuredBinary.h"
+#include "StructuredText.h"
+
+#include <memory>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+using namespace WBFL::System;
+
+// This class is implemented with the famous PIMPL idiom.
+// This is the implementation class
+namespace WBFL
+{
+   namespace System
+   {
+      class StructuredSaveBinary_Impl : public IStructuredSave
+      {
+      public:
+         StructuredSaveBinary_Impl() = default;
+         virtual ~StructuredSaveBinary_Impl() = default;
+
+         StructuredSaveBinary_Impl(const StructuredSaveBinary_Impl&) = delete;
+         StructuredSaveBinary_Impl& operator=(const StructuredSaveBinary_Impl&) = delete;
+
+         void BeginSave(std::ostream* pos, bool bCompress);
+         void EndSave();
+         virtual void BeginUnit(LPCTSTR name, Float64 version = 0.0) override;
+         virtual void EndUnit() override;
+         virtual Float64 GetVersion() override;
+         virtual Float64 GetParentVersion();
+         virtual std::_tstring GetParentUnit();
+         virtual Float64 GetTopVersion() override;
+         virtual void Property(LPCTSTR name, LPCTSTR value) override;
+         virtual void Property(LPCTSTR name, Float64 value) override;
+         virtual void Property(LPCTSTR name, Int16 value) override;
+         virtual void Property(LPCTSTR name, Uint16 value) override;
+         virtual void Property(LPCTSTR name, Int32 value) override;
+         virtual void Property(LPCTSTR name, Uint32 value) override;
+         virtual void Property(LPCTSTR name, Int64 value) override;
+         virtual void Property(LPCTSTR name, Uint64 value) override;
+         virtual void Property(LPCTSTR name, LONG value) override;
+         virtual void Property(LPCTSTR name, ULONG value) override;
+         virtual void Property(LPCTSTR name, bool value) override;
+
+         virtual void PutUnit(LPCTSTR xml);
+
+      private:
+         StructuredBinary::Writer m_Writer;
+         bool m_bSaving = false;
+
+         using ListItem = std::pair<std::_tstring, Float64>;
+         std::vector<ListItem> m_UnitList; // stack of information about current units.
+      };
+   };
+};
+
+StructuredSaveBinary::StructuredSaveBinary():
+m_pImp(std::make_unique<StructuredSaveBinary_Impl>())
+{
+   PRECONDITION(m_pImp.get() != nullptr);
+}
+
+// why is this declared here? It is what you need to do to get the PIMPL idiom
+// to work with std::unique_ptr<>. See https://www.fluentcpp.com/2017/09/22/make-pimpl-using-unique_ptr/.
+StructuredSaveBinary::~StructuredSaveBinary() = default;
+
+void StructuredSaveBinary::BeginSave(std::ostream* pos, bool bCompress)
+{
+   m_pImp->BeginSave(pos, bCompress);
+}
+
+void StructuredSaveBinary::EndSave()
+{
+   m_pImp->EndSave();
+}
+
+void StructuredSaveBinary::BeginUnit(LPCTSTR name, Float64 version)
+{
+   m_pImp->BeginUnit(name,version);
+}
+
+void StructuredSaveBinary::EndUnit()
+{
+   m_pImp->EndUnit();
+}
+
+Float64 StructuredSaveBinary::GetVersion()
+{
+   return m_pImp->GetVersion();
+}
+
+Float64 StructuredSaveBinary::GetParentVersion()
+{
+   return m_pImp->GetParentVersion();
+}
+
+std::_tstring StructuredSaveBinary::GetParentUnit()
+{
+   return m_pImp->GetParentUnit();
+}
+
+Float64 StructuredSaveBinary::GetTopVersion()
+{
+   return m_pImp->GetTopVersion();
+}
+
+void StructuredSaveBinary::Property(LPCTSTR name, LPCTSTR value)
+{
+   m_pImp->Property(name,value);
+}
+
+void StructuredSaveBinary::Property(LPCTSTR name, Float64 value)
+{
+   m_pImp->Property(name,value);
+}
+
+void StructuredSaveBinary::Property(LPCTSTR name, Int16 value)
+{
+   m_pImp->Property(name,value);
+}
+
+void StructuredSaveBinary::Property(LPCTSTR name, Uint16 value)
+{
+   m_pImp->Property(name,value);
+}
+
+void StructuredSaveBinary::Property(LPCTSTR name, Int32 value)
+{
+   m_pImp->Property(name,value);
+}
+
+void StructuredSaveBinary::Property(LPCTSTR name, Uint32 value)
+{
+   m_pImp->Property(name,value);
+}
+
+void StructuredSaveBinary::Property(LPCTSTR name, Int64 value)
+{
+   m_pImp->Property(name,value);
+}
+
+void StructuredSaveBinary::Property(LPCTSTR name, Uint64 value)
+{
+   m_pImp->Property(name,value);
+}
+
+void StructuredSaveBinary::Property(LPCTSTR name, LONG value)
+{
+   m_pImp->Property(name,value);
+}
+
+void StructuredSaveBinary::Property(LPCTSTR name, ULONG value)
+{
+   m_pImp->Property(name,value);
+}
+
+void StructuredSaveBinary::Property(LPCTSTR name, bool value)
+{
+   m_pImp->Property(name,value);
+}
+
+void StructuredSaveBinary::PutUnit(LPCTSTR xml)
+{
+   m_pImp->PutUnit(xml);
+}
+
+
+void StructuredSaveBinary_Impl::BeginSave(std::ostream* pos, bool bCompress)
+{
+   PRECONDITION(pos != nullptr);
+   CHECK(!m_bSaving); // previously used and not cleaned up?
+
+   m_Writer.Begin(pos, bCompress);
+   m_UnitList.clear();
+   m_bSaving = true;
+}
+
+void StructuredSaveBinary_Impl::EndSave()
+{
+   CHECKX(m_UnitList.empty(),_T("Error: BeginUnit-EndUnit mismatch in structured save"));
+   m_bSaving = false;
+   m_Writer.End();
+}
+
+void StructuredSaveBinary_Impl::BeginUnit(LPCTSTR name, Float64 version)
+{
+   PRECONDITION(m_bSaving);
+   m_Writer.BeginUnit(StructuredText::ToUtf8(name), version);
+   m_UnitList.emplace_back(name, version);
+}
+
+void StructuredSaveBinary_Impl::EndUnit()
+{
+   PRECONDITION(m_bSaving);
+   if (m_UnitList.empty())
+   {
+      CHECKX(0,_T("Popped too far - no parent for child node"));
+      THROW(XStructuredSave,BadWrite);
+   }
+
+   m_Writer.EndUnit();
+   m_UnitList.pop_back();
+}
+
+Float64 StructuredSaveBinary_Impl::GetVersion()
+{
+   return m_UnitList.empty() ? 0.0 : m_UnitList.back().second;
+}
+
+Float64 StructuredSaveBinary_Impl::GetParentVersion()
+{
+   return m_UnitList.size() < 2 ? 0.0 : m_UnitList[m_UnitList.size() - 2].second;
+}
+
+std::_tstring StructuredSaveBinary_Impl::GetParentUnit()
+{
+   return m_UnitList.size() < 2 ? std::_tstring() : m_UnitList[m_UnitList.size() - 2].first;
+}
+
+Float64 StructuredSaveBinary_Impl::GetTopVersion()
+{
+   return m_UnitList.empty() ? 0.0 : m_UnitList.front().second;
+}
+
+void StructuredSaveBinary_Impl::Property(LPCTSTR name, LPCTSTR value)
+{
+   PRECONDITION(m_bSaving);
+   m_Writer.String(StructuredText::ToUtf8(name), StructuredText::ToUtf8(value));
+}
+
+void StructuredSaveBinary_Impl::Property(LPCTSTR name, Float64 value)
+{
+   PRECONDITION(m_bSaving);
+   m_Writer.Real(StructuredText::ToUtf8(name), value);
+}
+
+void StructuredSaveBinary_Impl::Property(LPCTSTR name, Int16 value)
+{
+   Property(name, (Int64)value);
+}
+
+void StructuredSaveBinary_Impl::Property(LPCTSTR name, Uint16 value)
+{
+   Property(name, (Uint64)value);
+}
+
+void StructuredSaveBinary_Impl::Property(LPCTSTR name, Int32 value)
+{
+   Property(name, (Int64)value);
+}
+
+void StructuredSaveBinary_Impl::Property(LPCTSTR name, Uint32 value)
+{
+   Property(name, (Uint64)value);
+}
+
+void StructuredSaveBinary_Impl::Property(LPCTSTR name, Int64 value)
+{
+   PRECONDITION(m_bSaving);
+   m_Writer.Integer(StructuredText::ToUtf8(name), value);
+}
+
+void StructuredSaveBinary_Impl::Property(LPCTSTR name, Uint64 value)
+{
+   PRECONDITION(m_bSaving);
+   m_Writer.Unsigned(StructuredText::ToUtf8(name), value);
+}
+
+void StructuredSaveBinary_Impl::Property(LPCTSTR name, LONG value)
+{
+   Property(name, (Int64)value);
+}
+
+void StructuredSaveBinary_Impl::Property(LPCTSTR name, ULONG value)
+{
+   Property(name, (Uint64)value);
+}
+
+void StructuredSaveBinary_Impl::Property(LPCTSTR name, bool value)
+{
+   PRECONDITION(m_bSaving);
+   m_Writer.Bool(StructuredText::ToUtf8(name), value);
+}
+
+void StructuredSaveBinary_Impl::PutUnit(LPCTSTR xml)
+{
+   PRECONDITION(m_bSaving);
+   try
+   {
+      StructuredBinary::ReadXml(StructuredText::ToUtf8(xml), m_Writer);
+   }
+   catch (XStructuredLoad&)
+   {
+      THROW(XStructuredSave,BadWrite);
+   }
+}
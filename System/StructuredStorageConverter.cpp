@@ -0,0 +1,68 @@
+///////////////////////////////////////////////////////////////////////
+// System - WBFL low level system services
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#include <System\SysExp.h>
+#include <System\StructuredStorageConverter.h>
+#include <System\XStructuredLoad.h>
+#include <System\XStructuredSave.h>
+#include "StructuredBinary.h"
+
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <string>
+
+using namespace WBFL::System;
+
+void StructuredStorageConverter::XmlToBinary(std::istream& xml, std::ostream& binary, bool bCompress)
+{
+   std::string text{ std::istreambuf_iterator<char>(xml), std::istreambuf_iterator<char>() };
+
+   StructuredBinary::Writer writer;
+   writer.Begin(&binary, bCompress);
+   StructuredBinary::ReadXml(text, writer);
+   writer.End();
+}
+
+void StructuredStorageConverter::BinaryToXml(std::istream& binary, std::ostream& xml)
+{
+   StructuredBinary::Reader reader;
+   reader.Begin(&binary);
+
+   std::string text("<?xml version=\"1.0\"?>\r\n");
+   StructuredBinary::Record record;
+   reader.Read(&record);
+   while (record.tag != StructuredBinary::Tag::EndOfData)
+   {
+      if (record.tag == StructuredBinary::Tag::EndUnit)
+         THROW_LOAD(InvalidFileFormat, nullptr);
+
+      StructuredBinary::WriteXml(reader, record, text);
+      reader.Read(&record);
+   }
+   reader.End();
+
+   xml.write(text.data(), text.size());
+   if (!xml.good())
+      THROW(XStructuredSave, BadWrite);
+}
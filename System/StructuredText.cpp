@@ -0,0 +1,336 @@
+///////////////////////////////////////////////////////////////////////
+// System - WBFL low level system services
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#include <System\SysExp.h>
+#include <System\XStructuredLoad.h>
+#include "StructuredText.h"
+
+#include <charconv>
+#include <cmath>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+using namespace WBFL::System;
+
+namespace
+{
+   void AppendUtf8(std::string& utf8, Uint32 c)
+   {
+      if (c < 0x80)
+      {
+         utf8.push_back((char)c);
+      }
+      else if (c < 0x800)
+      {
+         utf8.push_back((char)(0xC0 | (c >> 6)));
+         utf8.push_back((char)(0x80 | (c & 0x3F)));
+      }
+      else if (c < 0x10000)
+      {
+         utf8.push_back((char)(0xE0 | (c >> 12)));
+         utf8.push_back((char)(0x80 | ((c >> 6) & 0x3F)));
+         utf8.push_back((char)(0x80 | (c & 0x3F)));
+      }
+      else
+      {
+         utf8.push_back((char)(0xF0 | (c >> 18)));
+         utf8.push_back((char)(0x80 | ((c >> 12) & 0x3F)));
+         utf8.push_back((char)(0x80 | ((c >> 6) & 0x3F)));
+         utf8.push_back((char)(0x80 | (c & 0x3F)));
+      }
+   }
+
+   // Same substitution as the find_replace_all helper used by the xml save/load classes
+   void ReplaceAll(std::string& target, std::string_view find, std::string_view replace)
+   {
+      std::string::size_type spos = 0;
+      std::string::size_type epos;
+      while ((epos = target.find(find, spos)) != std::string::npos)
+      {
+         target.replace(epos, find.size(), replace);
+         spos = epos + 1;
+      }
+   }
+
+   template <class T>
+   bool ParseNumber(std::string_view text, T* pValue)
+   {
+      text = StructuredText::Trim(text);
+      if (!text.empty() && text.front() == '+')
+         text.remove_prefix(1);
+
+      auto result = std::from_chars(text.data(), text.data() + text.size(), *pValue);
+      return result.ec == std::errc() && result.ptr == text.data() + text.size() && !text.empty();
+   }
+
+   template <class T>
+   std::string FormatNumber(T value)
+   {
+      char buffer[32];
+      auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+      return std::string(buffer, result.ptr);
+   }
+}
+
+bool StructuredText::IsWhitespace(char c)
+{
+   return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+std::string_view StructuredText::Trim(std::string_view text)
+{
+   auto first = text.find_first_not_of(" \t\r\n");
+   if (first == std::string_view::npos)
+      return std::string_view();
+
+   auto last = text.find_last_not_of(" \t\r\n");
+   return text.substr(first, last - first + 1);
+}
+
+std::string StructuredText::ToUtf8(LPCTSTR str)
+{
+#if defined _UNICODE
+   std::string utf8;
+   for (; *str != 0; str++)
+   {
+      Uint32 c = (Uint32)(std::make_unsigned_t<wchar_t>)(*str);
+      if constexpr (sizeof(wchar_t) == 2)
+      {
+         if (0xD800 <= c && c < 0xDC00 && 0xDC00 <= (Uint32)str[1] && (Uint32)str[1] < 0xE000)
+         {
+            c = 0x10000 + ((c - 0xD800) << 10) + ((Uint32)str[1] - 0xDC00);
+            str++;
+         }
+      }
+      AppendUtf8(utf8, c);
+   }
+   return utf8;
+#else
+   return std::string(str);
+#endif
+}
+
+std::_tstring StructuredText::FromUtf8(std::string_view str)
+{
+#if defined _UNICODE
+   std::_tstring result;
+   result.reserve(str.size());
+   for (std::size_t i = 0; i < str.size(); )
+   {
+      Uint8 lead = (Uint8)str[i];
+      Uint32 c = 0;
+      std::size_t nTrail = 0;
+      if (lead < 0x80)      { c = lead;        nTrail = 0; }
+      else if (lead < 0xC0) { THROW_LOAD(InvalidFileFormat, nullptr); }
+      else if (lead < 0xE0) { c = lead & 0x1F; nTrail = 1; }
+      else if (lead < 0xF0) { c = lead & 0x0F; nTrail = 2; }
+      else if (lead < 0xF8) { c = lead & 0x07; nTrail = 3; }
+      else                  { THROW_LOAD(InvalidFileFormat, nullptr); }
+
+      if (str.size() - i <= nTrail)
+         THROW_LOAD(InvalidFileFormat, nullptr);
+
+      for (std::size_t j = 1; j <= nTrail; j++)
+      {
+         Uint8 trail = (Uint8)str[i + j];
+         if ((trail & 0xC0) != 0x80)
+            THROW_LOAD(InvalidFileFormat, nullptr);
+         c = (c << 6) | (trail & 0x3F);
+      }
+      i += nTrail + 1;
+
+      if constexpr (sizeof(wchar_t) == 2)
+      {
+         if (0x10000 <= c)
+         {
+            c -= 0x10000;
+            result.push_back((wchar_t)(0xD800 + (c >> 10)));
+            result.push_back((wchar_t)(0xDC00 + (c & 0x3FF)));
+            continue;
+         }
+      }
+      result.push_back((wchar_t)c);
+   }
+   return result;
+#else
+   return std::_tstring(str);
+#endif
+}
+
+bool StructuredText::IsEqual(std::string_view utf8, LPCTSTR str)
+{
+   // names are almost always ASCII so compare without converting if possible
+   std::size_t i = 0;
+   for (; i < utf8.size() && str[i] != 0; i++)
+   {
+      if ((Uint8)utf8[i] < 0x80 && (Uint32)str[i] < 0x80)
+      {
+         if (utf8[i] != (char)str[i])
+            return false;
+      }
+      else
+      {
+         return FromUtf8(utf8) == str;
+      }
+   }
+
+   return i == utf8.size() && str[i] == 0;
+}
+
+void StructuredText::AppendXmlText(std::string& text, std::string_view raw)
+{
+   for (std::size_t i = 0; i < raw.size(); i++)
+   {
+      if (raw[i] != '&')
+      {
+         text.push_back(raw[i]);
+         continue;
+      }
+
+      auto end = raw.find(';', i);
+      if (end == std::string_view::npos)
+         THROW_LOAD(InvalidFileFormat, nullptr);
+
+      std::string_view entity = raw.substr(i + 1, end - i - 1);
+      if (entity == "amp")       text.push_back('&');
+      else if (entity == "lt")   text.push_back('<');
+      else if (entity == "gt")   text.push_back('>');
+      else if (entity == "quot") text.push_back('"');
+      else if (entity == "apos") text.push_back('\'');
+      else if (1 < entity.size() && entity[0] == '#')
+      {
+         Uint32 c;
+         bool bHex = (entity[1] == 'x' || entity[1] == 'X');
+         std::string_view digits = entity.substr(bHex ? 2 : 1);
+         auto result = std::from_chars(digits.data(), digits.data() + digits.size(), c, bHex ? 16 : 10);
+         if (result.ec != std::errc() || result.ptr != digits.data() + digits.size() || 0x10FFFF < c)
+            THROW_LOAD(InvalidFileFormat, nullptr);
+         AppendUtf8(text, c);
+      }
+      else
+      {
+         THROW_LOAD(InvalidFileFormat, nullptr);
+      }
+
+      i = end;
+   }
+}
+
+void StructuredText::EscapePropertyText(std::string& text)
+{
+   ReplaceAll(text, "&", "&amp;");
+   ReplaceAll(text, "<", "&lt;");
+   ReplaceAll(text, ">", "&gt;");
+   ReplaceAll(text, "'", "&sq;");
+   ReplaceAll(text, "\"", "&dq;");
+
+   // the only markup character left is the & of the replacements
+   ReplaceAll(text, "&", "&amp;");
+}
+
+void StructuredText::RestorePropertyText(std::string& text)
+{
+   if (Trim(text).empty())
+   {
+      text.clear();
+      return;
+   }
+
+   ReplaceAll(text, "&amp;", "&");
+   ReplaceAll(text, "&lt;", "<");
+   ReplaceAll(text, "&gt;", ">");
+   ReplaceAll(text, "&sq;", "'");
+   ReplaceAll(text, "&dq;", "\"");
+}
+
+std::string StructuredText::Format(Float64 value)
+{
+   return FormatNumber(value);
+}
+
+std::string StructuredText::Format(Int64 value)
+{
+   return FormatNumber(value);
+}
+
+std::string StructuredText::Format(Uint64 value)
+{
+   return FormatNumber(value);
+}
+
+bool StructuredText::ToReal(std::string_view text, Float64* pValue)
+{
+   return ParseNumber(text, pValue);
+}
+
+bool StructuredText::ToInteger(std::string_view text, Int64* pValue)
+{
+   if (ParseNumber(text, pValue))
+      return true;
+
+   // text written from a real number
+   Float64 value;
+   if (!ParseNumber(text, &value) || !(-9.2233720368547758e18 <= value && value < 9.2233720368547758e18))
+      return false;
+
+   *pValue = std::llround(value);
+   return true;
+}
+
+bool StructuredText::ToUnsigned(std::string_view text, Uint64* pValue)
+{
+   if (ParseNumber(text, pValue))
+      return true;
+
+   Int64 value;
+   if (!ToInteger(text, &value) || value < 0)
+      return false;
+
+   *pValue = (Uint64)value;
+   return true;
+}
+
+bool StructuredText::ToBool(std::string_view text, bool* pValue)
+{
+   // a VARIANT_BOOL coerced to text is True/False or -1/0
+   text = Trim(text);
+   if (text == "True" || text == "true")
+   {
+      *pValue = true;
+      return true;
+   }
+   else if (text == "False" || text == "false")
+   {
+      *pValue = false;
+      return true;
+   }
+
+   Float64 value;
+   if (!ParseNumber(text, &value))
+      return false;
+
+   *pValue = (value != 0.0);
+   return true;
+}
@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////
+// System - WBFL low level system services
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDED_STRUCTUREDTEXT_H_
+#define INCLUDED_STRUCTUREDTEXT_H_
+
+// Text handling shared by the structured storage classes that don't use MSXML.
+// This header is private to the System library.
+
+#include <string>
+#include <string_view>
+
+namespace WBFL
+{
+   namespace System
+   {
+      namespace StructuredText
+      {
+         bool IsWhitespace(char c);
+         std::string_view Trim(std::string_view text);
+
+         std::string ToUtf8(LPCTSTR str);
+         std::_tstring FromUtf8(std::string_view str);
+
+         /// Returns true if a UTF-8 string and a TCHAR string are the same
+         bool IsEqual(std::string_view utf8, LPCTSTR str);
+
+         /// Appends xml character data to text, replacing entity and character references
+         void AppendXmlText(std::string& text, std::string_view raw);
+
+         /// Replaces special characters in a string property the same way as StructuredSaveXml
+         /// and escapes the result as xml character data
+         void EscapePropertyText(std::string& text);
+
+         /// Undoes the special character replacement of StructuredSaveXml the same way as StructuredLoadXml.
+         /// Text that is only whitespace is not significant and becomes an empty string.
+         void RestorePropertyText(std::string& text);
+
+         /// Property values formatted as text. Real numbers are formatted with the shortest text that
+         /// reads back to the same value.
+         std::string Format(Float64 value);
+         std::string Format(Int64 value);
+         std::string Format(Uint64 value);
+
+         /// Property values parsed from text. These return false if the text is not a value
+         /// of the requested type.
+         bool ToReal(std::string_view text, Float64* pValue);
+         bool ToInteger(std::string_view text, Int64* pValue);
+         bool ToUnsigned(std::string_view text, Uint64* pValue);
+         bool ToBool(std::string_view text, bool* pValue);
+      };
+   };
+};
+
+#endif // INCLUDED_STRUCTUREDTEXT_H_
@@ -0,0 +1,81 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include <sstream>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace WBFL::System;
+
+namespace SystemUnitTest
+{
+	TEST_CLASS(TestLogger)
+	{
+	public:
+
+		TEST_METHOD(Synchronous)
+		{
+         std::ostringstream os;
+         std::ostream* old = Logger::SetOutput(&os);
+         Logger::Severity verbosity = Logger::Verbosity();
+
+         Logger::Verbosity(Logger::Severity::Info);
+         Assert::IsFalse(Logger::IsLogged(Logger::Severity::Debug));
+         Assert::IsTrue(Logger::IsLogged(Logger::Severity::Warning));
+
+         Logger::Debug("Debug Message");
+         Logger::Info(_T("Info Message"));
+         Assert::IsTrue(os.str().find("Debug Message") == std::string::npos);
+         Assert::IsTrue(os.str().find("[Info] [") == 0);
+         Assert::IsTrue(os.str().find("] Info Message\n") != std::string::npos);
+
+         Logger::Verbosity(verbosity);
+         Logger::SetOutput(old);
+      }
+
+		TEST_METHOD(Asynchronous)
+		{
+         std::ostringstream os;
+         std::ostream* old = Logger::SetOutput(&os);
+
+         Logger::EnableAsync(true);
+         Assert::IsTrue(Logger::IsAsync());
+
+         std::vector<std::thread> threads;
+         for (int i = 0; i < 4; i++)
+         {
+            threads.emplace_back([i] {for (int j = 0; j < 100; j++) Logger::Info("Thread " + std::to_string(i) + " Message " + std::to_string(j)); });
+         }
+         for (auto& thread : threads) thread.join();
+
+         Logger::Flush();
+         std::string log = os.str();
+         Assert::AreEqual((size_t)400, (size_t)std::count(log.begin(), log.end(), '\n'));
+         Assert::IsTrue(log.find("] Thread 3 Message 99\n") != std::string::npos);
+
+         // messages are dropped, and reported, when the queue is full
+         Logger::EnableAsync(false);
+         Logger::EnableAsync(true, 4);
+         Uint64 nDropped = Logger::GetDroppedMessageCount();
+         for (int i = 0; i < 1000; i++)
+         {
+            Logger::Info("Message");
+         }
+         Logger::EnableAsync(false);
+         Assert::IsFalse(Logger::IsAsync());
+
+         nDropped = Logger::GetDroppedMessageCount() - nDropped;
+         log = os.str();
+         Uint64 nWritten = 0;
+         for (auto pos = log.find("] Message\n"); pos != std::string::npos; pos = log.find("] Message\n", pos + 1)) nWritten++;
+         Assert::AreEqual((Uint64)1000, nWritten + nDropped);
+         if (0 < nDropped)
+         {
+            Assert::IsTrue(log.find(" log messages were dropped\n") != std::string::npos);
+         }
+
+         Logger::SetOutput(old);
+      }
+	};
+}
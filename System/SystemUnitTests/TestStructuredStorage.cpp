@@ -1,12 +1,94 @@
 #include "pch.h"
 #include "CppUnitTest.h"
 
+#include <fstream>
+#include <sstream>
+
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
 using namespace WBFL::System;
 
 namespace SystemUnitTest
 {
+   namespace
+   {
+      const std::_tstring special(_T("A string with \"special char's < > && & things><"));
+
+      void SaveLibrary(IStructuredSave& save, IndexType nEntries)
+      {
+         save.BeginUnit(_T("LIBRARY_MANAGER"), 1.0);
+         save.BeginUnit(_T("LIBRARY"), 2.1);
+         save.Property(_T("NAME"), _T("ConcreteLibrary"));
+         for (IndexType i = 0; i < nEntries; i++)
+         {
+            save.BeginUnit(_T("CONCRETE_ENTRY"));
+            save.Property(_T("Special"), special.c_str());
+            save.Property(_T("Density"), 150.20 + i);
+            save.Property(_T("IsLightWeight"), i % 2 == 0);
+            save.Property(_T("Int32_Min"), (Int32)Int32_Min);
+            save.Property(_T("Uint32_Max"), (Uint32)Uint32_Max);
+            save.Property(_T("Int16_Min"), (Int16)Int16_Min);
+            save.Property(_T("Uint16_Max"), (Uint16)Uint16_Max);
+            save.EndUnit();
+         }
+         save.BeginUnit(_T("EMPTY"), 3.0);
+         save.EndUnit();
+         save.EndUnit();
+         save.EndUnit();
+      }
+
+      void LoadLibrary(IStructuredLoad& load, IndexType nEntries)
+      {
+         Float64 d;
+         bool b;
+         Int32 lmin;
+         Uint32 ulmax;
+         Int16 smin;
+         Uint16 usmax;
+         std::_tstring str;
+
+         Assert::IsTrue(load.BeginUnit(_T("LIBRARY_MANAGER")));
+         Assert::IsFalse(load.BeginUnit(_T("CONCRETE_ENTRY")));
+         Assert::IsTrue(load.BeginUnit(_T("LIBRARY")));
+         Assert::IsTrue(load.GetVersion() == 2.1);
+         Assert::IsTrue(load.GetParentVersion() == 1.0);
+         Assert::IsTrue(load.Property(_T("NAME"), &str));
+         Assert::IsTrue(str == _T("ConcreteLibrary"));
+         for (IndexType i = 0; i < nEntries; i++)
+         {
+            Assert::IsTrue(load.BeginUnit(_T("CONCRETE_ENTRY")));
+            Assert::IsFalse(load.Property(_T("Density"), &d));
+            Assert::IsTrue(load.Property(_T("Special"), &str));
+            Assert::IsTrue(str == special);
+            Assert::IsTrue(load.Property(_T("Density"), &d));
+            Assert::IsTrue(d == 150.20 + i);
+            if (i % 3 == 2)
+            {
+               // skip the rest of the unit
+               Assert::IsTrue(load.EndUnit());
+               continue;
+            }
+            Assert::IsTrue(load.Property(_T("IsLightWeight"), &b));
+            Assert::IsTrue(b == (i % 2 == 0));
+            Assert::IsTrue(load.Property(_T("Int32_Min"), &lmin));
+            Assert::IsTrue(lmin == Int32_Min);
+            Assert::IsTrue(load.Property(_T("Uint32_Max"), &ulmax));
+            Assert::IsTrue(ulmax == Uint32_Max);
+            Assert::IsTrue(load.Property(_T("Int16_Min"), &smin));
+            Assert::IsTrue(smin == Int16_Min);
+            Assert::IsTrue(load.Property(_T("Uint16_Max"), &usmax));
+            Assert::IsTrue(usmax == Uint16_Max);
+            Assert::IsTrue(load.EndUnit());
+         }
+         Assert::IsTrue(load.BeginUnit(_T("EMPTY")));
+         Assert::IsTrue(load.GetVersion() == 3.0);
+         Assert::IsTrue(load.EndUnit());
+         Assert::IsTrue(load.EndUnit());
+         Assert::IsTrue(load.GetTopVersion() == 1.0);
+         Assert::IsTrue(load.EndUnit());
+      }
+   }
+
 	TEST_CLASS(TestStructuredStorage)
 	{
 	public:
@@ -120,5 +202,150 @@ namespace SystemUnitTest
             Assert::Fail(ex.GetErrorMessage().c_str());
          }
       }
+
+		TEST_METHOD(Binary)
+		{
+         for (auto bCompress : { false, true })
+         {
+            // enough entries to span several compressed blocks
+            const IndexType nEntries = 5000;
+            std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+
+            StructuredSaveBinary save;
+            save.BeginSave(&stream, bCompress);
+            Assert::ExpectException<XStructuredSave>([&]() {save.BeginUnit(_T("Invalid name"), 1.0); });
+            SaveLibrary(save, nEntries);
+            save.EndSave();
+
+            try
+            {
+               StructuredLoadBinary load;
+               load.BeginLoad(&stream);
+               LoadLibrary(load, nEntries);
+               Assert::IsTrue(load.Eof());
+               load.EndLoad();
+
+               // GetUnit reads ahead and must leave the loader where it was
+               stream.clear();
+               stream.seekg(0);
+               load.BeginLoad(&stream);
+               Assert::IsTrue(load.BeginUnit(_T("LIBRARY_MANAGER")));
+               Assert::IsTrue(load.BeginUnit(_T("LIBRARY")));
+               std::_tstring name;
+               Assert::IsTrue(load.Property(_T("NAME"), &name));
+               Assert::IsTrue(load.BeginUnit(_T("CONCRETE_ENTRY")));
+               Assert::IsTrue(load.GetUnit() == _T("<CONCRETE_ENTRY><Special>A string with &amp;dq;special char&amp;sq;s &amp;lt; &amp;gt; &amp;amp;&amp;amp; &amp;amp; things&amp;gt;&amp;lt;</Special><Density>150.2</Density><IsLightWeight>-1</IsLightWeight><Int32_Min>-2147483648</Int32_Min><Uint32_Max>4294967295</Uint32_Max><Int16_Min>-32768</Int16_Min><Uint16_Max>65535</Uint16_Max></CONCRETE_ENTRY>"));
+               std::_tstring str;
+               Assert::IsTrue(load.Property(_T("Special"), &str));
+               Assert::IsTrue(str == special);
+               load.EndLoad();
+            }
+            catch (WBFL::System::XStructuredLoad& ex)
+            {
+               Assert::Fail(ex.GetErrorMessage().c_str());
+            }
+         }
+      }
+
+		TEST_METHOD(XmlConversion)
+		{
+         const IndexType nEntries = 10;
+         {
+            FileStream os;
+            if (!os.open(_T("TestConversion.xml"), false)) Assert::Fail(_T("Error creating TestConversion.xml"));
+
+            StructuredSaveXml save;
+            save.BeginSave(&os);
+            SaveLibrary(save, nEntries);
+            save.EndSave();
+         }
+
+         try
+         {
+            // xml to binary
+            std::stringstream binary(std::ios::in | std::ios::out | std::ios::binary);
+            {
+               std::ifstream xml(_T("TestConversion.xml"), std::ios::binary);
+               StructuredStorageConverter::XmlToBinary(xml, binary, true);
+            }
+
+            StructuredLoadBinary loadBinary;
+            loadBinary.BeginLoad(&binary);
+            LoadLibrary(loadBinary, nEntries);
+            loadBinary.EndLoad();
+
+            // and back to xml
+            binary.clear();
+            binary.seekg(0);
+            {
+               std::ofstream xml(_T("TestConversion.xml"), std::ios::binary);
+               StructuredStorageConverter::BinaryToXml(binary, xml);
+            }
+
+            FileStream is;
+            if (!is.open(_T("TestConversion.xml"), true)) Assert::Fail(_T("Error opening TestConversion.xml"));
+            StructuredLoadXml loadXml;
+            loadXml.BeginLoad(&is);
+            LoadLibrary(loadXml, nEntries);
+            loadXml.EndLoad();
+         }
+         catch (WBFL::System::XStructuredLoad& ex)
+         {
+            Assert::Fail(ex.GetErrorMessage().c_str());
+         }
+      }
+
+		TEST_METHOD(XmlStream)
+		{
+         const IndexType nEntries = 1000;
+         {
+            FileStream os;
+            if (!os.open(_T("TestXmlStream.xml"), false)) Assert::Fail(_T("Error creating TestXmlStream.xml"));
+
+            StructuredSaveXml save;
+            save.BeginSave(&os);
+            SaveLibrary(save, nEntries);
+            save.EndSave();
+         }
+
+         try
+         {
+            std::ifstream is(_T("TestXmlStream.xml"), std::ios::binary);
+            StructuredLoadXmlStream load;
+            load.BeginLoad(&is);
+            LoadLibrary(load, nEntries);
+            Assert::IsTrue(load.Eof());
+            load.EndLoad();
+
+            // GetUnit reads ahead and must leave the loader where it was
+            is.clear();
+            is.seekg(0);
+            load.BeginLoad(&is);
+            Assert::IsTrue(load.BeginUnit(_T("LIBRARY_MANAGER")));
+            Assert::IsTrue(load.BeginUnit(_T("LIBRARY")));
+            std::_tstring name;
+            Assert::IsTrue(load.Property(_T("NAME"), &name));
+            Assert::IsTrue(load.BeginUnit(_T("CONCRETE_ENTRY")));
+            std::_tstring unit = load.GetUnit();
+            Assert::IsTrue(unit.find(_T("<CONCRETE_ENTRY>")) == 0);
+            Assert::IsTrue(unit.rfind(_T("</CONCRETE_ENTRY>")) == unit.size() - 17);
+            std::_tstring str;
+            Assert::IsTrue(load.Property(_T("Special"), &str));
+            Assert::IsTrue(str == special);
+            load.EndLoad();
+         }
+         catch (WBFL::System::XStructuredLoad& ex)
+         {
+            Assert::Fail(ex.GetErrorMessage().c_str());
+         }
+
+         // malformed xml reports the same error as StructuredLoadXml
+         std::stringstream bad("<LIBRARY_MANAGER><LIBRARY><NAME>Concrete</NAME></LIBRARY_MANAGER>", std::ios::in | std::ios::binary);
+         StructuredLoadXmlStream load;
+         load.BeginLoad(&bad);
+         Assert::IsTrue(load.BeginUnit(_T("LIBRARY_MANAGER")));
+         Assert::IsTrue(load.BeginUnit(_T("LIBRARY")));
+         Assert::ExpectException<XStructuredLoad>([&]() {load.EndUnit(); });
+      }
 	};
 }
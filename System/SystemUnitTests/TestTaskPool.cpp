@@ -0,0 +1,125 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace WBFL::System;
+
+namespace SystemUnitTest
+{
+	TEST_CLASS(TestTaskPool)
+	{
+	public:
+
+		TEST_METHOD(ParallelFor)
+		{
+         const IndexType nItems = 100000;
+         std::vector<int> vCount(nItems, 0);
+         TaskPool::ParallelFor(0, nItems, [&vCount](IndexType begin, IndexType end)
+            {
+               for (IndexType i = begin; i < end; i++) vCount[i]++;
+            }, 100);
+         Assert::IsTrue(std::all_of(vCount.begin(), vCount.end(), [](int count) {return count == 1; }));
+
+         // nested loops share the pool
+         std::atomic<IndexType> count = 0;
+         TaskPool::ParallelFor(0, 100, [&count](IndexType begin, IndexType end)
+            {
+               for (IndexType i = begin; i < end; i++)
+               {
+                  TaskPool::ParallelFor(0, 1000, [&count](IndexType b, IndexType e) {count += e - b; }, 10);
+               }
+            }, 1);
+         Assert::AreEqual((IndexType)100000, (IndexType)count);
+
+         // empty range
+         TaskPool::ParallelFor(10, 10, [](IndexType begin, IndexType end) {Assert::Fail(); });
+      }
+
+		TEST_METHOD(ParallelReduce)
+		{
+         const IndexType nItems = 1000000;
+         auto sum = [](IndexType begin, IndexType end)
+            {
+               Float64 s = 0;
+               for (IndexType i = begin; i < end; i++) s += 1.0 / (i + 1);
+               return s;
+            };
+
+         IndexType concurrency = TaskPool::GetConcurrency();
+
+         // the result does not depend on the number of threads
+         TaskPool::SetConcurrency(1);
+         Float64 serial = TaskPool::ParallelReduce(0, nItems, 0.0, sum, std::plus<Float64>(), 1000);
+         TaskPool::SetConcurrency(4);
+         Float64 parallel = TaskPool::ParallelReduce(0, nItems, 0.0, sum, std::plus<Float64>(), 1000);
+         TaskPool::SetConcurrency(concurrency);
+         Assert::IsTrue(serial == parallel);
+         Assert::AreEqual(sum(0, nItems), serial, 1e-9);
+
+         Assert::AreEqual(5.0, TaskPool::ParallelReduce(0, 0, 5.0, sum, std::plus<Float64>()));
+      }
+
+		TEST_METHOD(TaskGroup)
+		{
+         std::atomic<int> count = 0;
+         WBFL::System::TaskGroup group;
+         for (int i = 0; i < 100; i++)
+         {
+            group.Run([&count] {count++; });
+         }
+         group.Wait();
+         Assert::AreEqual(100, (int)count);
+
+         // exceptions are passed to the waiting thread
+         for (int i = 0; i < 10; i++)
+         {
+            group.Run([i] {if (i == 5) throw std::runtime_error("task failed"); });
+         }
+         Assert::ExpectException<std::runtime_error>([&group]() {group.Wait(); });
+
+         Assert::AreEqual((IndexType)1000, TaskPool::GetChunkSize(1000, 1000));
+         Assert::AreEqual((IndexType)750, TaskPool::GetChunkSize(1500, 1000));
+      }
+
+		TEST_METHOD(WaitRunsOwnTasks)
+		{
+         IndexType concurrency = TaskPool::GetConcurrency();
+         TaskPool::SetConcurrency(1); // all tasks run in the waiting thread
+
+         // waiting on a group does not run the tasks of an unrelated group
+         bool bRanA = false;
+         bool bRanB = false;
+         WBFL::System::TaskGroup groupA;
+         WBFL::System::TaskGroup groupB;
+         groupA.Run([&bRanA] {bRanA = true; });
+         groupB.Run([&bRanB] {bRanB = true; });
+         groupA.Wait();
+         Assert::IsTrue(bRanA);
+         Assert::IsFalse(bRanB);
+         groupB.Wait();
+         Assert::IsTrue(bRanB);
+
+         // but it does run the tasks of groups created by its tasks
+         int count = 0;
+         groupA.Run([&count]
+            {
+               WBFL::System::TaskGroup nested;
+               for (int i = 0; i < 10; i++)
+               {
+                  nested.Run([&count] {count++; });
+               }
+               nested.Wait();
+            });
+         groupA.Wait();
+         Assert::AreEqual(10, count);
+
+         TaskPool::SetConcurrency(concurrency);
+      }
+	};
+}
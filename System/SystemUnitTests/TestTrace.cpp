@@ -0,0 +1,57 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include <sstream>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace WBFL::System;
+
+namespace SystemUnitTest
+{
+	TEST_CLASS(TestTrace)
+	{
+	public:
+
+		TEST_METHOD(Test)
+		{
+         Trace::Clear();
+
+         // nothing is recorded while tracing is disabled
+         {
+            WBFL_TRACE_ZONE("Disabled Zone");
+         }
+
+         Trace::Enable(true);
+         {
+            WBFL_TRACE_ZONE("Outer Zone");
+            TaskPool::ParallelFor(0, 100, [](IndexType begin, IndexType end) {WBFL_TRACE_ZONE("Inner \"Zone\""); }, 1);
+            WBFL_TRACE_COUNTER("Count", 100);
+         }
+         Trace::Enable(false);
+
+         std::ostringstream os;
+         Trace::Write(os);
+         std::string json = os.str();
+         Assert::IsTrue(json.find("{\"traceEvents\":[") == 0);
+         Assert::IsTrue(json.find("Disabled Zone") == std::string::npos);
+         Assert::IsTrue(json.find(R"({"name":"Outer Zone","ph":"X")") != std::string::npos);
+         Assert::IsTrue(json.find(R"({"name":"Inner \"Zone\"","ph":"X")") != std::string::npos);
+         Assert::IsTrue(json.find(R"({"name":"Count","ph":"C")") != std::string::npos);
+         Assert::IsTrue(json.find(R"("args":{"value":100}})") != std::string::npos);
+
+         // the macros are single statements
+         bool bElse = false;
+         if (json.empty())
+            WBFL_TRACE_COUNTER("Count", 100);
+         else
+            bElse = true;
+         Assert::IsTrue(bElse);
+
+         Trace::Clear();
+         os.str("");
+         Trace::Write(os);
+         Assert::IsTrue(os.str().find("Outer Zone") == std::string::npos);
+      }
+	};
+}
@@ -0,0 +1,370 @@
+///////////////////////////////////////////////////////////////////////
+// System - WBFL low level system services
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#include <System\SysLib.h>
+#include <System\TaskPool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+using namespace WBFL::System;
+
+namespace WBFL
+{
+   namespace System
+   {
+      class TaskGroup_Impl
+      {
+      public:
+         TaskGroup_Impl* m_pParent = nullptr; // group of the task that created this group, if any
+         std::atomic<IndexType> m_nPending = 0; // number of tasks that have not completed
+
+         std::mutex m_Mutex;
+         std::exception_ptr m_Exception; // first exception thrown by a task
+      };
+   };
+};
+
+namespace
+{
+   struct Task
+   {
+      std::function<void()> Work;
+      TaskGroup_Impl* pGroup;
+   };
+
+   // Returns true if pGroup is pWaitGroup or was created, directly or indirectly, by one of its tasks.
+   // A null pWaitGroup matches any group.
+   bool IsPartOf(const TaskGroup_Impl* pGroup, const TaskGroup_Impl* pWaitGroup)
+   {
+      if (pWaitGroup == nullptr)
+         return true;
+
+      // the chain is safe to walk because a parent group has a pending task until its child groups are done
+      for (; pGroup != nullptr; pGroup = pGroup->m_pParent)
+      {
+         if (pGroup == pWaitGroup)
+            return true;
+      }
+      return false;
+   }
+
+   // Task queue for one thread. The owner pushes and pops at the back. Other threads steal from the front,
+   // taking the oldest tasks, which are usually the largest remaining pieces of work.
+   class TaskQueue
+   {
+   public:
+      void Push(Task&& task)
+      {
+         std::lock_guard<std::mutex> lock(m_Mutex);
+         m_Tasks.push_back(std::move(task));
+      }
+
+      // Takes the newest task that is part of pWaitGroup
+      bool Pop(Task& task, const TaskGroup_Impl* pWaitGroup)
+      {
+         std::lock_guard<std::mutex> lock(m_Mutex);
+         auto found = std::find_if(m_Tasks.rbegin(), m_Tasks.rend(), [pWaitGroup](const auto& t) {return IsPartOf(t.pGroup, pWaitGroup); });
+         if (found == m_Tasks.rend())
+            return false;
+
+         task = std::move(*found);
+         m_Tasks.erase(std::next(found).base());
+         return true;
+      }
+
+      // Takes the oldest task that is part of pWaitGroup
+      bool Steal(Task& task, const TaskGroup_Impl* pWaitGroup)
+      {
+         std::lock_guard<std::mutex> lock(m_Mutex);
+         auto found = std::find_if(m_Tasks.begin(), m_Tasks.end(), [pWaitGroup](const auto& t) {return IsPartOf(t.pGroup, pWaitGroup); });
+         if (found == m_Tasks.end())
+            return false;
+
+         task = std::move(*found);
+         m_Tasks.erase(found);
+         return true;
+      }
+
+   private:
+      std::mutex m_Mutex;
+      std::deque<Task> m_Tasks;
+   };
+
+   class Pool
+   {
+   public:
+      Pool();
+
+      static Pool& Instance();
+
+      void SetConcurrency(IndexType nThreads);
+      IndexType GetConcurrency() const { return m_nThreads; }
+      bool IsWorkerThread() const { return ms_WorkerIdx != INVALID_INDEX; }
+      TaskGroup_Impl* GetCurrentGroup() const { return ms_pCurrentGroup; }
+
+      void Submit(Task&& task);
+      void Wait(TaskGroup_Impl* pGroup);
+      void Notify(bool bAll);
+
+   private:
+      IndexType m_nThreads = 1;
+      std::vector<std::thread> m_Workers;
+      std::vector<std::unique_ptr<TaskQueue>> m_Queues; // one queue per worker plus one for threads outside of the pool
+      std::atomic<IndexType> m_nQueued = 0;
+      std::atomic<Uint64> m_nSubmitted = 0; // total number of tasks submitted. lets a waiting thread detect new tasks
+
+      std::mutex m_Mutex;
+      std::condition_variable m_cv; // signaled when a task is queued, a task group completes, or the workers stop
+      bool m_bStop = false;
+
+      static thread_local IndexType ms_WorkerIdx;
+      static thread_local TaskGroup_Impl* ms_pCurrentGroup; // group of the task running in this thread
+
+      void Start(IndexType nThreads);
+      void Stop();
+      void WorkerThread(IndexType workerIdx);
+      bool RunTask(const TaskGroup_Impl* pWaitGroup); // runs one pending task that is part of pWaitGroup (any task if nullptr) in the calling thread. returns false if there aren't any
+   };
+
+   thread_local IndexType Pool::ms_WorkerIdx = INVALID_INDEX;
+   thread_local TaskGroup_Impl* Pool::ms_pCurrentGroup = nullptr;
+
+   Pool::Pool()
+   {
+      Start(0);
+   }
+
+   Pool& Pool::Instance()
+   {
+      // The pool is never destroyed. Joining the worker threads while the DLL is unloading would deadlock on the loader lock.
+      static Pool* pPool = new Pool;
+      return *pPool;
+   }
+
+   void Pool::SetConcurrency(IndexType nThreads)
+   {
+      PRECONDITION(!IsWorkerThread());
+      Stop();
+      Start(nThreads);
+   }
+
+   void Pool::Start(IndexType nThreads)
+   {
+      if (nThreads == 0)
+      {
+         nThreads = std::thread::hardware_concurrency();
+         nThreads = (nThreads == 0 ? 2 : nThreads);
+      }
+
+      m_nThreads = nThreads;
+      m_bStop = false;
+
+      // the calling thread is one of the threads, so there is one less worker
+      IndexType nWorkers = m_nThreads - 1;
+      m_Queues.clear();
+      for (IndexType i = 0; i <= nWorkers; i++)
+      {
+         m_Queues.emplace_back(std::make_unique<TaskQueue>());
+      }
+
+      for (IndexType i = 0; i < nWorkers; i++)
+      {
+         m_Workers.emplace_back(&Pool::WorkerThread, this, i);
+      }
+   }
+
+   void Pool::Stop()
+   {
+      {
+         std::lock_guard<std::mutex> lock(m_Mutex);
+         m_bStop = true;
+      }
+      m_cv.notify_all();
+
+      for (auto& worker : m_Workers)
+      {
+         worker.join();
+      }
+      m_Workers.clear();
+   }
+
+   void Pool::Submit(Task&& task)
+   {
+      // tasks created by a worker go into its own queue, otherwise into the shared queue at the end
+      IndexType queueIdx = (IsWorkerThread() ? ms_WorkerIdx : m_Queues.size() - 1);
+      m_nQueued++; // counted first so the count is never less than the number of tasks in the queues
+      m_Queues[queueIdx]->Push(std::move(task));
+      m_nSubmitted++; // counted after the push so a thread that sees the new count will find the task
+      Notify(true); // waiting threads only take tasks from their own group so they all have to check
+   }
+
+   void Pool::Wait(TaskGroup_Impl* pGroup)
+   {
+      // help with the work instead of blocking. this keeps nested task groups from tying up worker threads.
+      // only tasks of this group, and of groups created by its tasks, are run here. an unrelated task would
+      // run with this thread's thread local state and on top of this thread's stack.
+      while (0 < pGroup->m_nPending)
+      {
+         Uint64 nSubmitted = m_nSubmitted;
+         if (RunTask(pGroup))
+            continue;
+
+         std::unique_lock<std::mutex> lock(m_Mutex);
+         m_cv.wait(lock, [this, pGroup, nSubmitted] {return pGroup->m_nPending == 0 || nSubmitted != m_nSubmitted; });
+      }
+   }
+
+   void Pool::Notify(bool bAll)
+   {
+      // acquiring the mutex makes sure a waiting thread has either evaluated its wait
+      // condition after the change or is blocked and will receive the notification
+      {
+         std::lock_guard<std::mutex> lock(m_Mutex);
+      }
+
+      if (bAll)
+         m_cv.notify_all();
+      else
+         m_cv.notify_one();
+   }
+
+   void Pool::WorkerThread(IndexType workerIdx)
+   {
+      ms_WorkerIdx = workerIdx;
+      while (true)
+      {
+         if (RunTask(nullptr))
+            continue;
+
+         std::unique_lock<std::mutex> lock(m_Mutex);
+         m_cv.wait(lock, [this] {return m_bStop || 0 < m_nQueued; });
+         if (m_bStop && m_nQueued == 0)
+            break;
+      }
+      ms_WorkerIdx = INVALID_INDEX;
+   }
+
+   bool Pool::RunTask(const TaskGroup_Impl* pWaitGroup)
+   {
+      // the calling thread's own queue first, then the shared queue, then steal from the other workers
+      IndexType nQueues = m_Queues.size();
+      IndexType firstIdx = (IsWorkerThread() ? ms_WorkerIdx : nQueues - 1);
+
+      Task task;
+      bool bFound = m_Queues[firstIdx]->Pop(task, pWaitGroup);
+      for (IndexType i = 1; !bFound && i < nQueues; i++)
+      {
+         IndexType queueIdx = (firstIdx + nQueues - i) % nQueues; // visits the shared queue next
+         bFound = m_Queues[queueIdx]->Steal(task, pWaitGroup);
+      }
+
+      if (!bFound)
+         return false;
+
+      m_nQueued--;
+
+      TaskGroup_Impl* pGroup = task.pGroup;
+      TaskGroup_Impl* pPrevGroup = ms_pCurrentGroup; // this task may be running inside of another task's wait
+      ms_pCurrentGroup = pGroup;
+      try
+      {
+         task.Work();
+      }
+      catch (...)
+      {
+         std::lock_guard<std::mutex> lock(pGroup->m_Mutex);
+         if (!pGroup->m_Exception)
+            pGroup->m_Exception = std::current_exception();
+      }
+      ms_pCurrentGroup = pPrevGroup;
+
+      // the group can be destroyed as soon as the count reaches zero so it must not be used after this
+      if (--pGroup->m_nPending == 0)
+         Notify(true);
+
+      return true;
+   }
+}
+
+TaskGroup::TaskGroup():
+m_pImp(std::make_unique<TaskGroup_Impl>())
+{
+   m_pImp->m_pParent = Pool::Instance().GetCurrentGroup();
+}
+
+TaskGroup::~TaskGroup()
+{
+   Pool::Instance().Wait(m_pImp.get());
+}
+
+void TaskGroup::Run(std::function<void()>&& task)
+{
+   m_pImp->m_nPending++;
+   Pool::Instance().Submit({ std::move(task), m_pImp.get() });
+}
+
+void TaskGroup::Wait()
+{
+   Pool::Instance().Wait(m_pImp.get());
+
+   std::exception_ptr exception;
+   std::swap(exception, m_pImp->m_Exception);
+   if (exception)
+      std::rethrow_exception(exception);
+}
+
+void TaskPool::SetConcurrency(IndexType nThreads)
+{
+   Pool::Instance().SetConcurrency(nThreads);
+}
+
+IndexType TaskPool::GetConcurrency()
+{
+   return Pool::Instance().GetConcurrency();
+}
+
+bool TaskPool::IsWorkerThread()
+{
+   return Pool::Instance().IsWorkerThread();
+}
+
+IndexType TaskPool::GetChunkSize(IndexType nItems, IndexType grainSize)
+{
+   // limits the number of tasks when the grain size is small compared to the number of items
+   const IndexType maxChunks = 256;
+
+   if (grainSize == 0)
+      grainSize = Threads::GetMinItemsPerThread();
+
+   grainSize = (grainSize == 0 ? 1 : grainSize);
+
+   IndexType nChunks = (nItems + grainSize - 1) / grainSize;
+   nChunks = (maxChunks < nChunks ? maxChunks : nChunks);
+   return nChunks == 0 ? 1 : (nItems + nChunks - 1) / nChunks;
+}
@@ -0,0 +1,232 @@
+///////////////////////////////////////////////////////////////////////
+// System - WBFL low level system services
+// Copyright  1999-2026  Washington State Department of Transportation
+//                        Bridge and Structures Office
+//
+// This library is a part of the Washington Bridge Foundation Libraries
+// and was developed as part of the Alternate Route Project
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the Alternate Route Library Open Source License as published by 
+// the Washington State Department of Transportation, Bridge and Structures Office.
+//
+// This program is distributed in the hope that it will be useful, but is distributed 
+// AS IS, WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+// or FITNESS FOR A PARTICULAR PURPOSE. See the Alternate Route Library Open Source 
+// License for more details.
+//
+// You should have received a copy of the Alternate Route Library Open Source License 
+// along with this program; if not, write to the Washington State Department of 
+// Transportation, Bridge and Structures Office, P.O. Box  47340, 
+// Olympia, WA 98503, USA or e-mail Bridge_Support@wsdot.wa.gov
+///////////////////////////////////////////////////////////////////////
+
+#include <System\SysLib.h>
+#include <System\Trace.h>
+
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+using namespace WBFL::System;
+
+std::atomic<bool> Trace::m_bEnabled = false;
+
+namespace
+{
+   enum class EventType { Zone, Counter };
+
+   struct Event
+   {
+      EventType Type;
+      const char* Name;
+      Uint64 Start; // nanoseconds
+      Uint64 Duration; // nanoseconds
+      Float64 Value;
+   };
+
+   // Events recorded by one thread. Only the owning thread adds events. An event is published
+   // by incrementing the event count of its block, so a reader never sees a partially written event.
+   class ThreadBuffer
+   {
+   public:
+      ThreadBuffer(IndexType threadID) :
+         m_ThreadID(threadID),
+         m_pFirst(std::make_unique<Block>()),
+         m_pLast(m_pFirst.get())
+      {
+      }
+
+      IndexType GetThreadID() const { return m_ThreadID; }
+
+      void Add(const Event& event)
+      {
+         IndexType nEvents = m_pLast->m_nEvents.load(std::memory_order_relaxed);
+         if (nEvents == BlockSize)
+         {
+            // this block is full. start a new one
+            m_pLast->m_pNext = std::make_unique<Block>();
+            m_pLast->m_bHasNext.store(true, std::memory_order_release);
+            m_pLast = m_pLast->m_pNext.get();
+            nEvents = 0;
+         }
+
+         m_pLast->m_Events[nEvents] = event;
+         m_pLast->m_nEvents.store(nEvents + 1, std::memory_order_release);
+      }
+
+      template <class F>
+      void ForEach(F f) const
+      {
+         const Block* pBlock = m_pFirst.get();
+         while (pBlock)
+         {
+            IndexType nEvents = pBlock->m_nEvents.load(std::memory_order_acquire);
+            for (IndexType i = 0; i < nEvents; i++)
+            {
+               f(pBlock->m_Events[i]);
+            }
+
+            pBlock = (pBlock->m_bHasNext.load(std::memory_order_acquire) ? pBlock->m_pNext.get() : nullptr);
+         }
+      }
+
+      void Clear()
+      {
+         m_pFirst = std::make_unique<Block>();
+         m_pLast = m_pFirst.get();
+      }
+
+   private:
+      static const IndexType BlockSize = 4096;
+      struct Block
+      {
+         std::array<Event, BlockSize> m_Events;
+         std::atomic<IndexType> m_nEvents = 0;
+         std::atomic<bool> m_bHasNext = false;
+         std::unique_ptr<Block> m_pNext;
+      };
+
+      IndexType m_ThreadID;
+      std::unique_ptr<Block> m_pFirst;
+      Block* m_pLast;
+   };
+
+   // Buffers are kept after their thread ends so its events can still be written
+   std::mutex gs_Mutex;
+   std::vector<std::unique_ptr<ThreadBuffer>> gs_Buffers;
+   thread_local ThreadBuffer* gs_pBuffer = nullptr;
+
+   const auto gs_Epoch = std::chrono::steady_clock::now();
+
+   ThreadBuffer* GetBuffer()
+   {
+      if (gs_pBuffer == nullptr)
+      {
+         std::lock_guard<std::mutex> lock(gs_Mutex);
+         gs_Buffers.emplace_back(std::make_unique<ThreadBuffer>(gs_Buffers.size() + 1));
+         gs_pBuffer = gs_Buffers.back().get();
+      }
+      return gs_pBuffer;
+   }
+
+   void WriteString(std::ostream& os, const char* str)
+   {
+      os << '"';
+      for (const char* p = str; *p != 0; p++)
+      {
+         char c = *p;
+         if (c == '"' || c == '\\')
+            os << '\\' << c;
+         else if (0 <= c && c < 0x20)
+            os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)c << std::dec;
+         else
+            os << c;
+      }
+      os << '"';
+   }
+
+   void WriteMicroseconds(std::ostream& os, Uint64 ns)
+   {
+      // Chrome trace times are in microseconds
+      os << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000;
+   }
+}
+
+void Trace::Enable(bool bEnable)
+{
+   m_bEnabled = bEnable;
+}
+
+void Trace::Clear()
+{
+   std::lock_guard<std::mutex> lock(gs_Mutex);
+   for (auto& buffer : gs_Buffers)
+   {
+      buffer->Clear();
+   }
+}
+
+Uint64 Trace::Now()
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - gs_Epoch).count();
+}
+
+void Trace::Zone(const char* name, Uint64 start, Uint64 end)
+{
+   GetBuffer()->Add({ EventType::Zone, name, start, end - start, 0.0 });
+}
+
+void Trace::Counter(const char* name, Float64 value)
+{
+   GetBuffer()->Add({ EventType::Counter, name, Now(), 0, value });
+}
+
+void Trace::Write(std::ostream& os)
+{
+   std::lock_guard<std::mutex> lock(gs_Mutex);
+
+   auto flags = os.flags();
+   auto fill = os.fill();
+   auto precision = os.precision();
+
+   os << "{\"traceEvents\":[" << std::endl;
+   bool bFirst = true;
+   for (const auto& buffer : gs_Buffers)
+   {
+      auto tid = buffer->GetThreadID();
+
+      os << (bFirst ? "" : ",\n");
+      os << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << tid << R"(,"args":{"name":"Thread )" << tid << R"("}})";
+      bFirst = false;
+
+      buffer->ForEach([&os, tid](const Event& event)
+         {
+            os << ",\n{\"name\":";
+            WriteString(os, event.Name);
+            if (event.Type == EventType::Zone)
+            {
+               os << R"(,"ph":"X","ts":)";
+               WriteMicroseconds(os, event.Start);
+               os << R"(,"dur":)";
+               WriteMicroseconds(os, event.Duration);
+               os << R"(,"pid":1,"tid":)" << tid << "}";
+            }
+            else
+            {
+               os << R"(,"ph":"C","ts":)";
+               WriteMicroseconds(os, event.Start);
+               os << R"(,"pid":1,"tid":)" << tid << R"(,"args":{"value":)" << std::setprecision(17) << event.Value << "}}";
+            }
+         });
+   }
+   os << std::endl << R"(],"displayTimeUnit":"ns"})" << std::endl;
+
+   os.flags(flags);
+   os.fill(fill);
+   os.precision(precision);
+}